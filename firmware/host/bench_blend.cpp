@@ -0,0 +1,260 @@
+// Host benchmark for the rgb565_blend kernels against LVGL's own software blend of
+// masked fills and masked or translucent images, from the LVGL tree the host tools build
+// against. The vendored 8.1 has no draw context; its _lv_blend_fill() and _lv_blend_map()
+// draw into the buffer of a display registered over the bench buffer. 8.1 takes a masked
+// fill or an unmasked image as opaque only above LV_OPA_MAX, the kernels (like 8.3 and
+// later) from LV_OPA_MAX, so those cases at LV_OPA_MAX are counted as unchecked rather
+// than compared. With -DLVGL_DIR at 8.3 or later the reference is lv_draw_sw_blend_basic(),
+// the function the blend hook in lv_port_disp.cpp hands everything else to, and every case
+// is checked; that branch has not been built against the firmware's 8.4 yet.
+// Checks every dst, src and mask alignment for widths up to 40 with text-like masks at a
+// range of opacities, every mask value against every weight, then prints pixels/us for a
+// few UI-sized cases. Exits non-zero on a mismatch. The host has no DSP instructions, so
+// the kernels run their plain C form here; whether to enable LV_PORT_DISP_SIMD_BLEND is
+// decided by the BLEND lines of DISP_RENDER_BENCH on the target, not by these timings.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <lvgl.h>
+
+#include "bench_harness.h"
+#include "rgb565_blend.h"
+
+namespace {
+static_assert(kRgb565BlendOpaMax == LV_OPA_MAX, "kRgb565BlendOpaMax must be LV_OPA_MAX");
+
+lv_area_t s_bufArea = {0, 0, kBenchStride - 1, kBenchRows - 1};  // The whole buffer.
+lv_disp_t *s_disp = nullptr;
+int s_unchecked = 0;  // Cases without a reference in this LVGL.
+
+void flush_noop(lv_disp_drv_t *drv, const lv_area_t *, lv_color_t *) {
+  lv_disp_flush_ready(drv);
+}
+
+// LVGL's blend looks up the display being refreshed for its driver settings (and, in 8.1,
+// its draw buffer).
+void init_display() {
+  static lv_color_t drawPixels[kBenchStride * kBenchRows];
+  static lv_disp_draw_buf_t drawBuf;
+  static lv_disp_drv_t drv;
+  lv_init();
+  lv_disp_draw_buf_init(&drawBuf, drawPixels, nullptr, kBenchStride * kBenchRows);
+  lv_disp_drv_init(&drv);
+  drv.hor_res = kBenchStride;
+  drv.ver_res = kBenchRows;
+  drv.draw_buf = &drawBuf;
+  drv.flush_cb = flush_noop;
+  s_disp = lv_disp_drv_register(&drv);
+  _lv_refr_set_disp_refreshing(s_disp);
+}
+
+// LVGL's normal blend of a w x h rectangle at column x, row 0 of a draw-buffer-sized
+// buffer: color, or src (nullptr: a fill), through mask (nullptr: none) at overall
+// opacity opa. src and mask rows are w apart.
+void lvgl_blend(lv_color_t *buf, int32_t x, int32_t w, int32_t h, const lv_color_t *src,
+                lv_color_t color, const lv_opa_t *mask, lv_opa_t opa) {
+  const lv_area_t area = {(lv_coord_t)x, 0, (lv_coord_t)(x + w - 1), (lv_coord_t)(h - 1)};
+  const lv_draw_mask_res_t maskRes =
+      mask ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
+#if LVGL_VERSION_MAJOR == 8 && LVGL_VERSION_MINOR < 3
+  lv_disp_draw_buf_t *drawBuf = lv_disp_get_draw_buf(s_disp);
+  drawBuf->buf_act = buf;
+  drawBuf->area = s_bufArea;
+  if (src) {
+    _lv_blend_map(&area, &area, src, (lv_opa_t *)mask, maskRes, opa, LV_BLEND_MODE_NORMAL);
+  } else {
+    _lv_blend_fill(&area, &area, color, (lv_opa_t *)mask, maskRes, opa, LV_BLEND_MODE_NORMAL);
+  }
+#else
+  lv_draw_ctx_t ctx{};
+  ctx.buf = buf;
+  ctx.buf_area = &s_bufArea;
+  ctx.clip_area = &area;
+  lv_draw_sw_blend_dsc_t dsc{};
+  dsc.blend_area = &area;
+  dsc.src_buf = src;
+  dsc.color = color;
+  dsc.mask_buf = (lv_opa_t *)mask;
+  dsc.mask_res = maskRes;
+  dsc.mask_area = &area;
+  dsc.opa = opa;
+  dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+  lv_draw_sw_blend_basic(&ctx, &dsc);
+#endif
+}
+
+// Whether this LVGL's blend is a reference for the kernels: not for a masked fill or an
+// unmasked image at LV_OPA_MAX in 8.1, which blends those where the kernels store.
+bool has_reference(bool map, bool masked, uint8_t opa) {
+#if LVGL_VERSION_MAJOR == 8 && LVGL_VERSION_MINOR < 3
+  return opa != LV_OPA_MAX || map == masked;
+#else
+  (void)map;
+  (void)masked;
+  (void)opa;
+  return true;
+#endif
+}
+
+// Anti-aliased text: mostly empty, a quarter solid, the rest edge values.
+void text_mask(std::vector<uint8_t> &mask, std::mt19937 &rng) {
+  for (auto &m : mask) {
+    const uint32_t r = rng() % 100;
+    m = r < 60 ? 0 : r < 85 ? 0xFF : (uint8_t)(1 + rng() % 254);
+  }
+}
+
+void noise(std::vector<uint16_t> &px, std::mt19937 &rng) {
+  for (auto &p : px) p = (uint16_t)rng();
+}
+
+struct Buffers {
+  std::vector<uint16_t> want;
+  std::vector<uint16_t> got;
+  std::vector<uint16_t> src;
+  std::vector<uint8_t> mask;
+};
+
+Buffers make_buffers(std::mt19937 &rng) {
+  Buffers b;
+  b.want.resize((size_t)kBenchStride * kBenchRows);
+  b.src.resize((size_t)kBenchStride * kBenchRows);
+  b.mask.resize((size_t)kBenchStride * kBenchRows);
+  noise(b.want, rng);
+  noise(b.src, rng);
+  text_mask(b.mask, rng);
+  b.got = b.want;
+  return b;
+}
+
+bool report(bool same, const char *kind, int32_t dx, int32_t sx, int32_t mx, int32_t w,
+            int32_t h, int opa, bool masked) {
+  if (same) return true;
+  return bench_mismatch("%s dst_x=%d src_x=%d mask_x=%d w=%d h=%d opa=%d mask=%d", kind, (int)dx,
+                        (int)sx, (int)mx, (int)w, (int)h, opa, (int)masked);
+}
+
+// Mask and source rows are w apart, as LVGL lays them out for a blend area.
+bool check_fill(int32_t dx, int32_t mx, int32_t w, int32_t h, uint8_t opa, std::mt19937 &rng) {
+  if (!has_reference(false, true, opa)) {
+    ++s_unchecked;
+    return true;
+  }
+  Buffers b = make_buffers(rng);
+  lv_color_t color;
+  color.full = (uint16_t)rng();
+  lvgl_blend((lv_color_t *)b.want.data(), dx, w, h, nullptr, color, b.mask.data() + mx, opa);
+  rgb565_blend_fill_mask(b.got.data() + dx, kBenchStride, w, h, color.full, b.mask.data() + mx, w,
+                         opa);
+  return report(b.want == b.got, "fill", dx, 0, mx, w, h, opa, true);
+}
+
+bool check_map(int32_t dx, int32_t sx, int32_t mx, int32_t w, int32_t h, uint8_t opa,
+               bool masked, std::mt19937 &rng) {
+  if (!has_reference(true, masked, opa)) {
+    ++s_unchecked;
+    return true;
+  }
+  Buffers b = make_buffers(rng);
+  const uint8_t *mask = masked ? b.mask.data() + mx : nullptr;
+  lvgl_blend((lv_color_t *)b.want.data(), dx, w, h, (const lv_color_t *)b.src.data() + sx,
+             lv_color_t{}, mask, opa);
+  rgb565_blend_map(b.got.data() + dx, kBenchStride, w, h, b.src.data() + sx, w, mask, w, opa);
+  return report(b.want == b.got, "map", dx, sx, mx, w, h, opa, masked);
+}
+
+// Every mask value over every opacity, on one row of random colours.
+bool check_weights(std::mt19937 &rng) {
+  for (int opa = 0; opa < 256; ++opa) {
+    if (!has_reference(false, true, (uint8_t)opa)) {
+      ++s_unchecked;
+      continue;
+    }
+    Buffers b = make_buffers(rng);
+    for (int m = 0; m < 256; ++m) b.mask[m] = (uint8_t)m;
+    lv_color_t color;
+    color.full = (uint16_t)rng();
+    lvgl_blend((lv_color_t *)b.want.data(), 0, 256, 1, nullptr, color, b.mask.data(),
+               (lv_opa_t)opa);
+    rgb565_blend_fill_mask(b.got.data(), kBenchStride, 256, 1, color.full, b.mask.data(), 256,
+                           (uint8_t)opa);
+    if (!report(b.want == b.got, "weights", 0, 0, 0, 256, 1, opa, true)) return false;
+  }
+  return true;
+}
+
+struct Case {
+  BenchRect rect;  // x: an odd start column where the rectangle fits.
+  bool map;        // Image blend, otherwise a fill.
+  bool masked;
+  uint8_t opa;
+};
+}  // namespace
+
+int main() {
+  std::mt19937 rng(1234);
+  init_display();
+
+  static const uint8_t kOpas[] = {255, 254, 253, 252, 200, 128, 77, 3};
+  bool ok = check_weights(rng);
+  for (uint8_t opa : kOpas) {
+    for (int32_t dx = 0; dx < 2 && ok; ++dx) {
+      for (int32_t mx = 0; mx < 4 && ok; ++mx) {
+        for (int32_t w = 1; w <= 40 && ok; ++w) {
+          ok = check_fill(dx, mx, w, 3, opa, rng);
+          for (int32_t sx = 0; sx < 2 && ok; ++sx) {
+            ok = check_map(dx, sx, mx, w, 3, opa, true, rng) &&
+                 check_map(dx, sx, 0, w, 3, opa, false, rng);
+          }
+        }
+      }
+    }
+  }
+
+  static const Case kCases[] = {
+      {{"text_320x56", 1, 320, 56}, false, true, 255},
+      {{"text_opa50_320x56", 1, 320, 56}, false, true, 128},
+      {{"glow_sprite_64x64", 1, 64, 64}, true, true, 255},
+      {{"sprite_opa50_64x64", 1, 64, 64}, true, true, 128},
+      {{"image_opa50_456x80", 0, 456, 80}, true, false, 128},
+  };
+
+  printf("%-20s %10s %10s %9s\n", "case", "lvgl_px/us", "kern_px/us", "kern/lvgl");
+  Buffers b = make_buffers(rng);
+  lv_color_t color;
+  color.full = 0x1E5C;
+  for (const Case &tc : kCases) {
+    const BenchRect &r = tc.rect;
+    const bool same = tc.map ? check_map(r.x, 0, 0, r.w, r.h, tc.opa, tc.masked, rng)
+                             : check_fill(r.x, 0, r.w, r.h, tc.opa, rng);
+    if (!same) {
+      ok = false;
+      continue;
+    }
+    lv_color_t *buf = (lv_color_t *)b.want.data();
+    const lv_color_t *src = (const lv_color_t *)b.src.data();
+    const uint8_t *mask = tc.masked ? b.mask.data() : nullptr;
+    const double ref = bench_pixels_per_us(r.w, r.h, [&] {
+      lvgl_blend(buf, r.x, r.w, r.h, tc.map ? src : nullptr, color, mask, tc.opa);
+    });
+    uint16_t *dst = &buf[r.x].full;
+    const double kern = bench_pixels_per_us(r.w, r.h, [&] {
+      if (tc.map) {
+        rgb565_blend_map(dst, kBenchStride, r.w, r.h, &src->full, r.w, mask, r.w, tc.opa);
+      } else {
+        rgb565_blend_fill_mask(dst, kBenchStride, r.w, r.h, color.full, mask, r.w, tc.opa);
+      }
+    });
+    printf("%-20s %10.1f %10.1f %8.2fx\n", r.name, ref, kern, kern / ref);
+  }
+
+  if (s_unchecked) {
+    printf("bench_blend: %d cases at LV_OPA_MAX unchecked, LVGL %d.%d blends them below opaque\n",
+           s_unchecked, LVGL_VERSION_MAJOR, LVGL_VERSION_MINOR);
+  }
+  return bench_finish("bench_blend", ok, "LVGL's blend");
+}
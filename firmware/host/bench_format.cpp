@@ -0,0 +1,165 @@
+// Host benchmark for the integer formatters in ui_format.cpp against the snprintf()
+// calls the UI used before them. Verifies byte-identical output (and snprintf()-style
+// truncation) over the ranges the UI can show and exits non-zero on a mismatch.
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "bench_harness.h"
+#include "ui_format.h"
+
+namespace {
+// The formatters as they were in lv_time_attack_ui.cpp, screen_reaction.h and
+// screen_gforce.cpp. check() calls them with every size down to 0 to compare truncation,
+// which GCC sees through inlining and reports as -Wformat-truncation.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-truncation"
+#endif
+int time_reference(char *out, size_t size, uint32_t ms) {
+  const uint32_t totalSec = ms / 1000;
+  return snprintf(out, size, "%lu:%02lu.%03lu", (unsigned long)(totalSec / 60),
+                  (unsigned long)(totalSec % 60), (unsigned long)(ms % 1000));
+}
+
+int delta_reference(char *out, size_t size, int32_t deltaMs) {
+  return snprintf(out, size, "%+0.3f", (double)((float)deltaMs / 1000.0f));
+}
+
+int reaction_reference(char *out, size_t size, uint32_t ms) {
+  return snprintf(out, size, "%0.3fs", (double)((float)ms / 1000.0f));
+}
+
+int fixed2_reference(char *out, size_t size, float value) {
+  return snprintf(out, size, "%.2f", (double)value);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+// Range where the float formatters print whole milliseconds; see ui_format.h.
+constexpr int32_t kFloatExactMs = 16384000;
+
+int s_mismatches = 0;
+
+template <typename Ref, typename Fast, typename Arg>
+void check(const char *name, Ref &&ref, Fast &&fast, Arg arg, const char *argFmt) {
+  char want[32];
+  char got[32];
+  const int wantLen = ref(want, sizeof(want), arg);
+  memset(got, 0x5a, sizeof(got));
+  const size_t gotLen = fast(got, sizeof(got), arg);
+  bool same = (size_t)wantLen == gotLen && strcmp(want, got) == 0;
+
+  // Truncated writes, including size 0 which must leave the buffer alone.
+  for (size_t size = 0; same && size <= (size_t)wantLen; ++size) {
+    char wantCut[32];
+    char gotCut[32];
+    memset(wantCut, 0x5a, sizeof(wantCut));
+    memset(gotCut, 0x5a, sizeof(gotCut));
+    ref(wantCut, size, arg);
+    fast(gotCut, size, arg);
+    same = memcmp(wantCut, gotCut, sizeof(wantCut)) == 0;
+  }
+
+  if (!same && s_mismatches++ < 10) {
+    char argText[48];
+    snprintf(argText, sizeof(argText), argFmt, arg);
+    bench_mismatch("%s(%s): want \"%s\" got \"%s\"", name, argText, want, got);
+  }
+}
+
+void check_time(uint32_t ms) { check("time", time_reference, ui_format_time_ms, ms, "%u"); }
+void check_delta(int32_t ms) { check("delta", delta_reference, ui_format_delta_ms, ms, "%d"); }
+void check_reaction(uint32_t ms) {
+  check("reaction", reaction_reference, ui_format_reaction_ms, ms, "%u");
+}
+void check_fixed2(float value) {
+  check("fixed2", fixed2_reference, ui_format_fixed2, (double)value, "%a");
+}
+
+template <typename Ref, typename Fast>
+void bench(const char *name, Ref &&ref, Fast &&fast) {
+  const double refNs = bench_us_per_call(ref) * 1000.0;
+  const double fastNs = bench_us_per_call(fast) * 1000.0;
+  printf("%-10s %10.1f %10.1f %7.2fx\n", name, refNs, fastNs, refNs / fastNs);
+}
+}  // namespace
+
+int main() {
+  std::mt19937 rng(1234);
+
+  // Every millisecond up to 17 minutes, then samples over the full ranges.
+  for (uint32_t ms = 0; ms < (1u << 20); ++ms) {
+    check_time(ms);
+    check_reaction(ms);
+    check_delta((int32_t)ms);
+    check_delta(-(int32_t)ms);
+  }
+  for (int i = 0; i < 200000; ++i) {
+    check_time((uint32_t)rng());
+    const int32_t ms = (int32_t)(rng() % kFloatExactMs);
+    check_reaction((uint32_t)ms);
+    check_delta(rng() & 1 ? ms : -ms);
+  }
+  check_time(UINT32_MAX);
+  check_reaction(kFloatExactMs - 1);
+  check_delta(kFloatExactMs - 1);
+  check_delta(-(kFloatExactMs - 1));
+  // Label buffers are sized from kUiFormatReactionMsMaxLen.
+  if (ui_format_reaction_ms(nullptr, 0, UINT32_MAX) != kUiFormatReactionMsMaxLen) {
+    bench_mismatch("kUiFormatReactionMsMaxLen is not the longest reaction time");
+    s_mismatches++;
+  }
+
+  // G values: every 1021st float from -16 g to 16 g (covers all exponents), every
+  // two-decimal halfway point (the rounding edge), random bit patterns and the specials.
+  const uint32_t kSixteenBits = 0x41800000;  // 16.0f
+  for (uint32_t bits = 0; bits <= kSixteenBits; bits += 1021) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    check_fixed2(value);
+    check_fixed2(-value);
+  }
+  for (int32_t half = -3200; half <= 3200; ++half) {
+    const float tie = (float)half * 0.005f;
+    check_fixed2(tie);
+    check_fixed2(std::nextafter(tie, -INFINITY));
+    check_fixed2(std::nextafter(tie, INFINITY));
+  }
+  for (int i = 0; i < 200000; ++i) {
+    uint32_t bits = (uint32_t)rng();
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    if (std::fabs(value) < 4294967296.0f || !std::isfinite(value)) check_fixed2(value);
+  }
+  static const float kSpecial[] = {0.0f,      -0.0f,      0.005f,    -0.005f,    0.015f,
+                                   0.125f,    -0.125f,    0.375f,    1e-45f,     -1e-45f,
+                                   1.17e-38f, 4294967040.0f, -4294967040.0f, INFINITY,
+                                   -INFINITY, NAN,        -NAN};
+  for (float value : kSpecial) check_fixed2(value);
+
+  char buf[32];
+  volatile uint32_t sink = 0;
+  printf("%-10s %10s %10s %8s\n", "format", "ref_ns", "int_ns", "speedup");
+  bench(
+      "time", [&](int i) { sink += time_reference(buf, sizeof(buf), 83456u + i); },
+      [&](int i) { sink += ui_format_time_ms(buf, sizeof(buf), 83456u + i); });
+  bench(
+      "delta", [&](int i) { sink += delta_reference(buf, sizeof(buf), i - 128); },
+      [&](int i) { sink += ui_format_delta_ms(buf, sizeof(buf), i - 128); });
+  bench(
+      "reaction", [&](int i) { sink += reaction_reference(buf, sizeof(buf), 180u + i); },
+      [&](int i) { sink += ui_format_reaction_ms(buf, sizeof(buf), 180u + i); });
+  bench(
+      "fixed2", [&](int i) { sink += fixed2_reference(buf, sizeof(buf), (i - 128) * 0.013f); },
+      [&](int i) { sink += ui_format_fixed2(buf, sizeof(buf), (i - 128) * 0.013f); });
+  (void)sink;
+
+  if (s_mismatches) fprintf(stderr, "%d outputs differ\n", s_mismatches);
+  return bench_finish("bench_format", s_mismatches == 0, "snprintf");
+}
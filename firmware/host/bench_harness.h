@@ -0,0 +1,69 @@
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+// What the host benchmarks (bench_rotate, bench_fill, bench_blend, bench_format) share:
+// the timing loop, the draw buffer they work in, and the MISMATCH and result lines.
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+
+// The firmware's draw buffer: LVGL_LOGICAL_W pixels by 80 lines.
+constexpr int32_t kBenchStride = 456;
+constexpr int32_t kBenchRows = 80;
+
+// A named w x h case at column x.
+struct BenchRect {
+  const char *name;
+  int32_t x;
+  int32_t w;
+  int32_t h;
+};
+
+// Calls fn(i) for i = 0..255, over and over for at least 100 ms, and returns the
+// microseconds per call.
+template <typename Fn>
+double bench_us_per_call(Fn &&fn) {
+  using clock = std::chrono::steady_clock;
+  const auto minDuration = std::chrono::milliseconds(100);
+  uint64_t calls = 0;
+  const auto start = clock::now();
+  auto now = start;
+  do {
+    for (int i = 0; i < 256; ++i) fn(i);
+    calls += 256;
+    now = clock::now();
+  } while (now - start < minDuration);
+  return std::chrono::duration<double, std::micro>(now - start).count() / (double)calls;
+}
+
+// Pixels per microsecond of fn() working on a w x h area.
+template <typename Fn>
+double bench_pixels_per_us(int32_t w, int32_t h, Fn &&fn) {
+  return (double)w * (double)h / bench_us_per_call([&](int) { fn(); });
+}
+
+// Prints "MISMATCH <details>" to stderr; returns false.
+__attribute__((format(printf, 1, 2))) inline bool bench_mismatch(const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  fputs("MISMATCH ", stderr);
+  vfprintf(stderr, fmt, args);
+  fputc('\n', stderr);
+  va_end(args);
+  return false;
+}
+
+// Prints the tool's last line and returns its exit code: 0 when every output matched
+// reference, 1 otherwise.
+inline int bench_finish(const char *tool, bool ok, const char *reference) {
+  if (!ok) {
+    fprintf(stderr, "%s: FAILED (output differs from %s)\n", tool, reference);
+    return 1;
+  }
+  printf("%s: output identical to %s\n", tool, reference);
+  return 0;
+}
+
+#endif
@@ -0,0 +1,612 @@
+// Checks the QSPI transmit path on the host: the qspi_txn PIO program (qspi.pio.h), the
+// phase headers, and the command-list encoding (qspi_cmdlist.cpp).
+//
+// A small PIO interpreter runs the real qspi_txn_program_instructions against a model of
+// the TX FIFO and decodes SCLK rising edges back into (bus width, byte) beats per CS
+// frame. Those are compared with the byte stream of the original two-state-machine
+// driver (Waveshare qspi_pio.cpp + AMOLED_1IN64_SetWindows/QSPI_Pixel_Write).
+
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <vector>
+
+#define PICO_NO_HARDWARE 1
+#include "qspi.pio.h"
+#include "qspi_cmdlist.h"
+
+namespace {
+
+struct Beat {
+  int wires;  // 1 or 4
+  uint8_t value;
+  bool operator==(const Beat &o) const { return wires == o.wires && value == o.value; }
+};
+
+using Transaction = std::vector<Beat>;
+using Trace = std::vector<Transaction>;
+
+// Subset of the RP2350 PIO needed by qspi_txn: OUT/IN/PULL/MOV/JMP/SET with optional
+// side-set, shift-left OSR with autopull at 32 bits, 4-entry TX FIFO. One instruction
+// per cycle. Autopull refills lazily on the next OUT; hardware may refill earlier, which
+// only turns the header PULL into a no-op and gives the same bus output.
+class PioModel {
+ public:
+  PioModel() {
+    for (uint16_t insn : qspi_txn_program_instructions) program_.push_back(insn);
+  }
+
+  bool fifoFull() const { return fifo_.size() == kFifoDepth; }
+  bool fifoEmpty() const { return fifo_.empty(); }
+  bool stalled() const { return stalled_; }
+
+  void push(uint32_t word) { fifo_.push_back(word); }
+
+  void setCs(bool low) {
+    if (!low && bits_ != 0) error("CS released in the middle of a byte");
+    csLow_ = low;
+    if (low) current_.clear();
+    else trace.push_back(current_);
+  }
+
+  void step() {
+    const uint16_t insn = program_[pc_];
+    if (insn & 0x1000) setSclk((insn >> 11) & 1);  // side-set applies even when stalled
+
+    const uint32_t op = insn >> 13;
+    const uint32_t arg1 = (insn >> 5) & 7;
+    const uint32_t arg2 = insn & 0x1f;
+    const uint32_t count = arg2 ? arg2 : 32;
+    stalled_ = false;
+    bool jumped = false;
+
+    switch (op) {
+      case 0: {  // JMP
+        bool take = false;
+        switch (arg1) {
+          case 0: take = true; break;
+          case 1: take = x_ == 0; break;
+          case 2: take = x_ != 0; x_--; break;
+          case 3: take = y_ == 0; break;
+          case 4: take = y_ != 0; y_--; break;
+          default: error("unsupported JMP condition"); break;
+        }
+        if (take) {
+          pc_ = arg2;
+          jumped = true;
+        }
+        break;
+      }
+      case 2: {  // IN
+        const uint32_t src = source(arg1);
+        const uint32_t mask = count == 32 ? 0xffffffffu : ((1u << count) - 1);
+        isr_ = count == 32 ? src : ((isr_ << count) | (src & mask));
+        isrCount_ = isrCount_ + count > 32 ? 32 : isrCount_ + count;
+        break;
+      }
+      case 4: {  // PULL block (with autopull enabled: no-op when the OSR is full)
+        if (insn & 0x80) {
+          if (osrCount_ != 0) {
+            if (fifo_.empty()) {
+              stalled_ = true;
+              return;
+            }
+            osr_ = fifo_.front();
+            fifo_.pop_front();
+            osrCount_ = 0;
+          }
+        } else {
+          error("PUSH not supported");
+        }
+        break;
+      }
+      case 3: {  // OUT (autopull, shift left)
+        if (osrCount_ >= kPullThreshold) {
+          if (fifo_.empty()) {
+            stalled_ = true;
+            return;
+          }
+          osr_ = fifo_.front();
+          fifo_.pop_front();
+          osrCount_ = 0;
+        }
+        const uint32_t data = count == 32 ? osr_ : (osr_ >> (32 - count));
+        osr_ = count == 32 ? 0 : (osr_ << count);
+        osrCount_ += count;
+        switch (arg1) {
+          case 0: setPins(data & 0xf, count); break;
+          case 1: x_ = data; break;
+          case 2: y_ = data; break;
+          case 3: break;  // NULL
+          default: error("unsupported OUT destination"); break;
+        }
+        break;
+      }
+      case 5: {  // MOV (no operation bits used)
+        if ((insn >> 3) & 3) error("unsupported MOV operation");
+        const uint32_t src = source(insn & 7);
+        switch (arg1) {
+          case 1: x_ = src; break;
+          case 2: y_ = src; break;
+          case 6: isr_ = src; isrCount_ = 0; break;
+          default: error("unsupported MOV destination"); break;
+        }
+        break;
+      }
+      case 7:  // SET
+        switch (arg1) {
+          case 1: x_ = arg2; break;
+          case 2: y_ = arg2; break;
+          default: error("unsupported SET destination"); break;
+        }
+        break;
+      default:
+        error("unsupported opcode");
+        break;
+    }
+
+    if (!jumped) pc_ = (pc_ == qspi_txn_wrap) ? qspi_txn_wrap_target : pc_ + 1;
+  }
+
+  Trace trace;
+  int errors = 0;
+
+  void error(const char *what) {
+    if (errors++ < 5) std::printf("  pio model: %s\n", what);
+  }
+
+ private:
+  uint32_t source(uint32_t sel) const {
+    switch (sel) {
+      case 1: return x_;
+      case 2: return y_;
+      case 3: return 0;
+      case 6: return isr_;
+      case 7: return osr_;
+      default: return 0;
+    }
+  }
+
+  void setPins(uint32_t value, uint32_t width) {
+    pins_ = value;
+    pinWidth_ = (int)width;
+  }
+
+  void setSclk(int level) {
+    if (level && !sclk_) risingEdge();
+    sclk_ = level;
+  }
+
+  void risingEdge() {
+    if (!csLow_) {
+      error("SCLK edge with CS high");
+      return;
+    }
+    if (pinWidth_ == 1) {
+      if (pins_ & 0xe) error("DIO1..3 not low during a 1-wire phase");
+      byte_ = (uint8_t)((byte_ << 1) | (pins_ & 1));
+      bits_ += 1;
+    } else {
+      byte_ = (uint8_t)((byte_ << 4) | (pins_ & 0xf));
+      bits_ += 4;
+    }
+    if (bits_ == 8) {
+      current_.push_back(Beat{pinWidth_, byte_});
+      bits_ = 0;
+      byte_ = 0;
+    }
+  }
+
+  static constexpr size_t kFifoDepth = 4;
+  static constexpr uint32_t kPullThreshold = 32;
+
+  std::vector<uint16_t> program_;
+  std::deque<uint32_t> fifo_;
+  uint32_t pc_ = qspi_txn_offset_header;
+  uint32_t x_ = 0, y_ = 0, isr_ = 0, osr_ = 0;
+  uint32_t isrCount_ = 0, osrCount_ = 32;
+  uint32_t pins_ = 0;
+  int pinWidth_ = 1;
+  int sclk_ = 0;
+  bool stalled_ = false;
+  bool csLow_ = false;
+  uint8_t byte_ = 0;
+  int bits_ = 0;
+  Transaction current_;
+};
+
+// Host-side stand-ins for the firmware calls that touch the FIFO and CS.
+class Bus {
+ public:
+  // pio_sm_put_blocking(pio, sm, word)
+  void putBlocking(uint32_t word) { push(word); }
+  // 32-bit DMA with byte swap: memory order becomes MSB-first in the FIFO word.
+  void dmaWords(const uint8_t *data, uint32_t words) {
+    for (uint32_t i = 0; i < words; ++i, data += 4) {
+      push((uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 | (uint32_t)data[2] << 8 | data[3]);
+    }
+  }
+
+  // The same with the read address fixed: word is sent count times.
+  void dmaFixedWord(const uint8_t *word, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) dmaWords(word, 1);
+  }
+
+  void select() { pio.setCs(true); }
+
+  // QSPI_Deselect(): QSPI_Wait_Idle() then CS high.
+  void deselect() {
+    int guard = 0;
+    while (!(pio.fifoEmpty() && pio.stalled())) {
+      pio.step();
+      if (++guard > 1000) {
+        pio.error("bus never went idle");
+        break;
+      }
+    }
+    pio.setCs(false);
+  }
+
+  // 16-bit DMA without byte swap: the halfword is replicated into both lanes.
+  void dmaHalfwords(const uint16_t *data, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) push(0x00010001u * data[i]);
+  }
+
+  // QSPI_Phase_Begin()
+  void phase(uint32_t mode, uint32_t count) { putBlocking(QSPI_Txn_HeaderWord(mode, count)); }
+
+  // QSPI_Pixel_Stream(): CPU head/tail phases around a 32-bit DMA body.
+  void pixelStream(const uint8_t *p, uint32_t len) {
+    uint32_t head = (4 - ((uintptr_t)p & 3)) & 3;
+    if (head > len) head = len;
+    pixelBytes(p, head);
+    p += head;
+    len -= head;
+    const uint32_t body = len & ~3u;
+    if (body) {
+      phase(QSPI_TXN_4WIRE, body);
+      dmaWords(p, body / 4);
+    }
+    pixelBytes(p + body, len - body);
+  }
+
+  PioModel pio;
+
+ private:
+  void pixelBytes(const uint8_t *p, uint32_t len) {
+    if (len == 0) return;
+    uint32_t word = 0;
+    for (uint32_t i = 0; i < len; ++i) word |= (uint32_t)p[i] << (24 - 8 * i);
+    phase(QSPI_TXN_4WIRE, len);
+    putBlocking(word);
+  }
+
+  void push(uint32_t word) {
+    while (pio.fifoFull()) pio.step();  // DREQ / blocking put waits for space
+    pio.push(word);
+  }
+};
+
+// ---- Expected bus traffic: the original two-state-machine driver. ----
+
+struct Expected {
+  Trace trace;
+  void begin() { trace.emplace_back(); }
+  void bytes1(std::initializer_list<uint8_t> list) {
+    for (uint8_t b : list) trace.back().push_back(Beat{1, b});
+  }
+  void bytes4(const uint8_t *data, uint32_t len) {
+    for (uint32_t i = 0; i < len; ++i) trace.back().push_back(Beat{4, data[i]});
+  }
+};
+
+void expectSetWindows(Expected &e, uint32_t xs, uint32_t ys, uint32_t xe, uint32_t ye) {
+  xs += 20;  // AMOLED_1IN64_COL_OFFSET, portrait scan
+  xe += 20;
+  e.begin();
+  e.bytes1({0x02, 0x00, 0x2a, 0x00, (uint8_t)(xs >> 8), (uint8_t)(xs & 0xff),
+            (uint8_t)((xe - 1) >> 8), (uint8_t)((xe - 1) & 0xff)});
+  e.begin();
+  e.bytes1({0x02, 0x00, 0x2b, 0x00, (uint8_t)(ys >> 8), (uint8_t)(ys & 0xff),
+            (uint8_t)((ye - 1) >> 8), (uint8_t)((ye - 1) & 0xff)});
+  e.begin();
+  e.bytes1({0x02, 0x00, 0x2c, 0x00});
+}
+
+void expectPixels(Expected &e, const uint8_t *data, uint32_t len) {
+  e.begin();
+  e.bytes1({0x32, 0x00, 0x2c, 0x00});
+  e.bytes4(data, len);
+}
+
+// Same window encoding as AMOLED_1IN64_QueueWindows() in portrait scan.
+bool queueWindows(qspi_cmdlist_t *list, uint32_t xs, uint32_t ys, uint32_t xe, uint32_t ye) {
+  xs += 20;
+  xe += 20;
+  const uint8_t caset[4] = {(uint8_t)(xs >> 8), (uint8_t)(xs & 0xff),
+                            (uint8_t)((xe - 1) >> 8), (uint8_t)((xe - 1) & 0xff)};
+  const uint8_t raset[4] = {(uint8_t)(ys >> 8), (uint8_t)(ys & 0xff),
+                            (uint8_t)((ye - 1) >> 8), (uint8_t)((ye - 1) & 0xff)};
+  return QSPI_CmdList_Register(list, 0x2a, caset, 4) &&
+         QSPI_CmdList_Register(list, 0x2b, raset, 4) &&
+         QSPI_CmdList_Register(list, 0x2c, nullptr, 0);
+}
+
+// Walks the list the way QSPI_CmdList_StartTransaction()/QSPI_CmdList_IRQ() do:
+// segments without DESELECT are chained straight into the next one.
+void runCmdList(Bus &bus, const qspi_cmdlist_t &list) {
+  for (uint8_t i = 0; i < list.seg_count; ++i) {
+    const qspi_segment_t &seg = list.seg[i];
+    if (seg.flags & QSPI_SEG_SELECT) bus.select();
+    if (seg.flags & QSPI_SEG_RGB565) {
+      bus.dmaHalfwords((const uint16_t *)seg.data, seg.len / 2);
+    } else {
+      bus.dmaWords(seg.data, QSPI_Txn_Words(seg.len));
+    }
+    if ((seg.flags & QSPI_SEG_DESELECT) || i + 1 == list.seg_count) bus.deselect();
+  }
+}
+
+bool sameTrace(const Trace &a, const Trace &b) {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (!(a[i] == b[i])) return false;
+  }
+  return true;
+}
+
+int report(const char *name, bool ok, const char *detail) {
+  std::printf("%-30s %-44s %s\n", name, detail, ok ? "ok" : "MISMATCH");
+  return ok ? 0 : 1;
+}
+
+// Padded by a word: like the firmware buffers, DMA may read up to 3 bytes past the end.
+std::vector<uint8_t> testPattern(size_t len) {
+  std::vector<uint8_t> v(len + 4);
+  for (size_t i = 0; i < len; ++i) v[i] = (uint8_t)(i * 37 + 11);
+  return v;
+}
+
+int checkArea(const char *name, uint32_t xs, uint32_t ys, uint32_t xe, uint32_t ye) {
+  const uint32_t len = (xe - xs) * (ye - ys) * 2;
+  const std::vector<uint8_t> pixels = testPattern(len);
+
+  Expected expected;
+  expectSetWindows(expected, xs, ys, xe, ye);
+  expectPixels(expected, pixels.data(), len);
+
+  qspi_cmdlist_t list;
+  QSPI_CmdList_Init(&list);
+  const bool fits = queueWindows(&list, xs, ys, xe, ye) &&
+                    QSPI_CmdList_Pixels(&list, 0x2c, pixels.data(), len);
+  Bus bus;
+  runCmdList(bus, list);
+
+  char detail[64];
+  std::snprintf(detail, sizeof(detail), "%u segs %2u cmd bytes %7u px bytes",
+                (unsigned)list.seg_count, (unsigned)list.byte_count, (unsigned)len);
+  return report(name, fits && bus.pio.errors == 0 && sameTrace(expected.trace, bus.pio.trace),
+                detail);
+}
+
+// LVGL path: native little-endian RGB565 through 16-bit DMA; the panel must see each
+// pixel high byte first, as the old LV_COLOR_16_SWAP + byte DMA path sent it.
+int checkArea565(const char *name, uint32_t xs, uint32_t ys, uint32_t xe, uint32_t ye) {
+  const uint32_t count = (xe - xs) * (ye - ys);
+  std::vector<uint16_t> pixels(count);
+  std::vector<uint8_t> busOrder(count * 2);
+  for (uint32_t i = 0; i < count; ++i) {
+    pixels[i] = (uint16_t)(i * 40503u + 0x1234u);
+    busOrder[2 * i] = (uint8_t)(pixels[i] >> 8);
+    busOrder[2 * i + 1] = (uint8_t)pixels[i];
+  }
+
+  Expected expected;
+  expectSetWindows(expected, xs, ys, xe, ye);
+  expectPixels(expected, busOrder.data(), count * 2);
+
+  qspi_cmdlist_t list;
+  QSPI_CmdList_Init(&list);
+  const bool fits = queueWindows(&list, xs, ys, xe, ye) &&
+                    QSPI_CmdList_Pixels565(&list, 0x2c, pixels.data(), count);
+  Bus bus;
+  runCmdList(bus, list);
+
+  char detail[64];
+  std::snprintf(detail, sizeof(detail), "%u segs %2u cmd bytes %7u px (565)",
+                (unsigned)list.seg_count, (unsigned)list.byte_count, (unsigned)count);
+  return report(name, fits && bus.pio.errors == 0 && sameTrace(expected.trace, bus.pio.trace),
+                detail);
+}
+
+// Panel scrolling (lv_port_disp.cpp, LV_PORT_DISP_HW_SCROLL): the scroll start move
+// (AMOLED_1IN64_QueueScrollStart(), VSCSAD) rides in the same list as the band's window
+// and pixels, so the whole step is one DMA submission.
+int checkScrolledBand() {
+  const uint32_t xs = 0, ys = 440, xe = 280, ye = 456, line = 16;
+  const uint32_t count = (xe - xs) * (ye - ys);
+  std::vector<uint16_t> pixels(count);
+  std::vector<uint8_t> busOrder(count * 2);
+  for (uint32_t i = 0; i < count; ++i) {
+    pixels[i] = (uint16_t)(i * 7919u + 0x0f0fu);
+    busOrder[2 * i] = (uint8_t)(pixels[i] >> 8);
+    busOrder[2 * i + 1] = (uint8_t)pixels[i];
+  }
+
+  Expected expected;
+  expected.begin();
+  expected.bytes1({0x02, 0x00, 0x37, 0x00, (uint8_t)(line >> 8), (uint8_t)(line & 0xff)});
+  expectSetWindows(expected, xs, ys, xe, ye);
+  expectPixels(expected, busOrder.data(), count * 2);
+
+  qspi_cmdlist_t list;
+  QSPI_CmdList_Init(&list);
+  const uint8_t vscsad[2] = {(uint8_t)(line >> 8), (uint8_t)(line & 0xff)};
+  const bool fits = QSPI_CmdList_Register(&list, 0x37, vscsad, 2) &&
+                    queueWindows(&list, xs, ys, xe, ye) &&
+                    QSPI_CmdList_Pixels565(&list, 0x2c, pixels.data(), count);
+  Bus bus;
+  runCmdList(bus, list);
+
+  char detail[64];
+  std::snprintf(detail, sizeof(detail), "%u segs %2u cmd bytes %7u px (565)",
+                (unsigned)list.seg_count, (unsigned)list.byte_count, (unsigned)count);
+  return report("scroll start + 16-row band", fits && bus.pio.errors == 0 &&
+                sameTrace(expected.trace, bus.pio.trace), detail);
+}
+
+// Blocking driver path: QSPI_REGISTER_Write() + QSPI_DATA_Write() (one header per call),
+// then a Clear()-style 4-wire phase announced once and fed by several DMA transfers.
+int checkBlockingPath() {
+  Bus bus;
+  const uint8_t madctl = 0xa0;
+  bus.select();
+  bus.phase(QSPI_TXN_1WIRE, 4);
+  bus.putBlocking(0x02003600u);
+  bus.phase(QSPI_TXN_1WIRE, 1);
+  bus.putBlocking((uint32_t)madctl << 24);
+  bus.deselect();
+
+  const uint32_t rowBytes = 56;
+  const uint32_t rows = 7;
+  const std::vector<uint8_t> row = testPattern(rowBytes);
+  bus.select();
+  bus.phase(QSPI_TXN_1WIRE, 4);
+  bus.putBlocking(0x32002c00u);
+  bus.phase(QSPI_TXN_4WIRE, rowBytes * rows);
+  for (uint32_t r = 0; r < rows; ++r) bus.dmaWords(row.data(), rowBytes / 4);
+  bus.deselect();
+
+  Expected expected;
+  expected.begin();
+  expected.bytes1({0x02, 0x00, 0x36, 0x00, madctl});
+  expected.begin();
+  expected.bytes1({0x32, 0x00, 0x2c, 0x00});
+  for (uint32_t r = 0; r < rows; ++r) expected.bytes4(row.data(), rowBytes);
+
+  return report("blocking writes + row DMAs", bus.pio.errors == 0 &&
+                sameTrace(expected.trace, bus.pio.trace), "per-call 1-wire headers, 1 burst");
+}
+
+// AMOLED_1IN64_Clear(): one 4-wire phase for the whole screen fed by a single DMA transfer
+// that reads one word (two byte-swapped pixels) from a fixed address.
+int checkFixedClear() {
+  Bus bus;
+  const uint16_t color = 0xf81f;
+  const uint8_t fill[4] = {(uint8_t)(color >> 8), (uint8_t)color, (uint8_t)(color >> 8),
+                           (uint8_t)color};
+  const uint32_t pixels = 280 * 456;
+  bus.select();
+  bus.phase(QSPI_TXN_1WIRE, 4);
+  bus.putBlocking(0x32002c00u);
+  bus.phase(QSPI_TXN_4WIRE, pixels * 2);
+  bus.dmaFixedWord(fill, pixels / 2);
+  bus.deselect();
+
+  Expected expected;
+  expected.begin();
+  expected.bytes1({0x32, 0x00, 0x2c, 0x00});
+  for (uint32_t i = 0; i < pixels / 2; ++i) expected.bytes4(fill, 4);
+
+  return report("clear: fixed-address DMA", bus.pio.errors == 0 &&
+                sameTrace(expected.trace, bus.pio.trace), "full screen, 1 transfer");
+}
+
+// QSPI_Pixel_Stream() with every source alignment and a few odd lengths, as
+// AMOLED_1IN64_DisplayWindows() produces for windows starting at an odd column.
+int checkPixelStream() {
+  int failures = 0;
+  const std::vector<uint8_t> image = testPattern(4096);
+  const uint32_t lengths[] = {1, 2, 3, 6, 58, 560};
+  for (uint32_t offset = 0; offset < 4; ++offset) {
+    for (uint32_t len : lengths) {
+      Bus bus;
+      bus.select();
+      bus.pixelStream(image.data() + offset, len);
+      bus.deselect();
+
+      Expected expected;
+      expected.begin();
+      expected.bytes4(image.data() + offset, len);
+      if (bus.pio.errors != 0 || !sameTrace(expected.trace, bus.pio.trace)) failures++;
+    }
+  }
+  return report("unaligned pixel streams", failures == 0, "4 alignments x 6 lengths");
+}
+
+int checkHeaders() {
+  int failures = 0;
+  const struct {
+    uint32_t mode;
+    uint32_t count;
+    uint32_t word;
+  } cases[] = {
+      {QSPI_TXN_1WIRE, 1, 0x00000000u},
+      {QSPI_TXN_1WIRE, 12, 0x0000000bu},
+      {QSPI_TXN_4WIRE, 255360, 0x4003e57fu},
+      {QSPI_TXN_RGB565, 127680, 0x8001f2bfu},
+      {QSPI_TXN_4WIRE, QSPI_TXN_MAX_COUNT, 0x7fffffffu},
+  };
+  for (const auto &tc : cases) {
+    uint8_t h[QSPI_TXN_HEADER_BYTES];
+    QSPI_Txn_Header(h, tc.mode, tc.count);
+    if (QSPI_Txn_HeaderWord(tc.mode, tc.count) != tc.word) failures++;
+    if (h[0] != (uint8_t)(tc.word >> 24) || h[3] != (uint8_t)tc.word) failures++;
+  }
+  return report("phase header encoding", failures == 0, "1, 12, full screen, rgb565, max");
+}
+
+int checkLimits() {
+  int failures = 0;
+  qspi_cmdlist_t list;
+  QSPI_CmdList_Init(&list);
+
+  const uint8_t params[QSPI_CMDLIST_MAX_PARAMS + 1] = {};
+  if (QSPI_CmdList_Register(&list, 0x44, params, QSPI_CMDLIST_MAX_PARAMS + 1)) failures++;
+  if (list.seg_count != 0 || list.byte_count != 0) failures++;
+
+  alignas(4) const uint8_t pixels[8] = {};
+  if (QSPI_CmdList_Pixels(&list, 0x2c, pixels, 0)) failures++;
+  if (QSPI_CmdList_Pixels(&list, 0x2c, pixels, QSPI_TXN_MAX_COUNT + 1)) failures++;
+  if (QSPI_CmdList_Pixels(&list, 0x2c, pixels + 2, 4)) failures++;
+  if (QSPI_CmdList_Pixels565(&list, 0x2c, (const uint16_t *)pixels, 0)) failures++;
+
+  // Fill the segment table; the next append must fail and leave the list untouched.
+  int appended = 0;
+  while (QSPI_CmdList_Register(&list, 0x35, nullptr, 0)) appended++;
+  const uint8_t segs = list.seg_count;
+  const uint16_t bytes = list.byte_count;
+  if (appended != QSPI_CMDLIST_MAX_SEGMENTS) failures++;
+  if (QSPI_CmdList_Pixels(&list, 0x2c, pixels, 1)) failures++;
+  if (list.seg_count != segs || list.byte_count != bytes) failures++;
+
+  return report("capacity limits", failures == 0, "params, payload size/alignment, segments");
+}
+
+}  // namespace
+
+int main() {
+  int failures = 0;
+  failures += checkHeaders();
+  failures += checkArea("single pixel", 0, 0, 1, 1);
+  failures += checkArea("lap clock digit", 100, 200, 148, 240);
+  failures += checkArea("odd pixel count", 7, 30, 10, 33);
+  failures += checkArea("dirty area >255 rows", 12, 300, 140, 456);
+  failures += checkArea("full 80-line flush", 0, 0, 280, 80);
+  failures += checkArea("full screen", 0, 0, 280, 456);
+  failures += checkArea565("rgb565 single pixel", 0, 0, 1, 1);
+  failures += checkArea565("rgb565 odd area", 7, 30, 10, 33);
+  failures += checkArea565("rgb565 full 80-line flush", 0, 0, 280, 80);
+  failures += checkScrolledBand();
+  failures += checkBlockingPath();
+  failures += checkFixedClear();
+  failures += checkPixelStream();
+  failures += checkLimits();
+
+  if (failures) {
+    std::printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  std::printf("qspi_txn output matches the two-state-machine driver byte stream\n");
+  return 0;
+}
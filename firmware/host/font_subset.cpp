@@ -0,0 +1,935 @@
+// Generates the HUD's glyph-subset fonts (firmware/pilaptimer/ui_font_montserrat_*.c).
+//
+// Scans the UI sources for the text they can put on screen: string and character
+// literals (comments and #include lines skipped), the digits, signs and hex letters
+// printf conversions in those literals produce, and LV_SYMBOL_* names resolved through
+// lv_symbol_def.h. Digits, '+', '-', '.' and space are always kept because LVGL widgets
+// (the settings spinboxes) format numbers themselves. Each requested size of LVGL's
+// Montserrat font is then cut down to exactly those glyphs:
+//
+//  - ASCII glyphs get one direct-lookup table (LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL, id 0
+//    for glyphs left out), the few symbols a sorted sparse list;
+//  - kerning classes keep only the classes, and pairs, that still have a glyph;
+//  - with --compress the bitmaps use LVGL's RLE format (line XOR prefilter), decoded
+//    back here with a copy of lv_font_fmt_txt.c's decoder before anything is written.
+//
+//   font_subset --fonts DIR --out DIR --sizes 20,24,... [--compress 48,...] [--check]
+//               SOURCE...
+//     --fonts DIR  LVGL's src/font directory with lv_font_montserrat_<size>.c and
+//                  lv_symbol_def.h
+//     --check      compare with the files already in --out instead of writing them
+//
+// Exits non-zero when a source needs a glyph the full font does not have, or, with
+// --check, when a generated file is missing or out of date.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Always kept: numbers LVGL formats without going through the UI sources.
+constexpr char kBaseGlyphs[] = " +-.0123456789";
+
+struct GlyphUse {
+  std::string where;  // First "file:line" that needs the glyph.
+};
+
+using GlyphSet = std::map<uint32_t, GlyphUse>;
+
+bool read_file(const std::string &path, std::string &out) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  char buf[65536];
+  size_t n;
+  out.clear();
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+  fclose(f);
+  return true;
+}
+
+std::string base_name(const std::string &path) {
+  const size_t slash = path.find_last_of('/');
+  return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+// ---------------------------------------------------------------------------------------
+// Source scanning
+
+// Decodes the escapes of a C string or character literal body into bytes.
+std::string unescape(const std::string &body) {
+  std::string out;
+  for (size_t i = 0; i < body.size(); ++i) {
+    const char c = body[i];
+    if (c != '\\' || i + 1 == body.size()) {
+      out += c;
+      continue;
+    }
+    const char e = body[++i];
+    switch (e) {
+      case 'n': out += '\n'; break;
+      case 't': out += '\t'; break;
+      case 'r': out += '\r'; break;
+      case 'x': {
+        unsigned v = 0;
+        while (i + 1 < body.size() && isxdigit((unsigned char)body[i + 1])) {
+          const char h = body[++i];
+          v = v * 16 + (unsigned)(isdigit((unsigned char)h) ? h - '0' : (tolower(h) - 'a' + 10));
+        }
+        out += (char)v;
+        break;
+      }
+      default:
+        if (e >= '0' && e <= '7') {
+          unsigned v = (unsigned)(e - '0');
+          for (int k = 0; k < 2 && i + 1 < body.size() && body[i + 1] >= '0' && body[i + 1] <= '7';
+               ++k) {
+            v = v * 8 + (unsigned)(body[++i] - '0');
+          }
+          out += (char)v;
+        } else {
+          out += e;  // \\ \" \' \?
+        }
+    }
+  }
+  return out;
+}
+
+std::vector<uint32_t> utf8_decode(const std::string &bytes) {
+  std::vector<uint32_t> out;
+  for (size_t i = 0; i < bytes.size();) {
+    const uint8_t b = (uint8_t)bytes[i];
+    int extra = 0;
+    uint32_t cp = b;
+    if (b >= 0xf0) {
+      extra = 3;
+      cp = b & 0x07;
+    } else if (b >= 0xe0) {
+      extra = 2;
+      cp = b & 0x0f;
+    } else if (b >= 0xc0) {
+      extra = 1;
+      cp = b & 0x1f;
+    }
+    ++i;
+    for (int k = 0; k < extra && i < bytes.size(); ++k, ++i) cp = (cp << 6) | ((uint8_t)bytes[i] & 0x3f);
+    out.push_back(cp);
+  }
+  return out;
+}
+
+// Characters a literal puts on screen. printf conversions are replaced by the characters
+// they can print; %s and %c arguments are literals of their own and scanned separately.
+std::string rendered_chars(const std::string &text) {
+  if (text.find('%') == std::string::npos) return text;
+  std::string out;
+  for (size_t i = 0; i < text.size(); ++i) {
+    if (text[i] != '%') {
+      out += text[i];
+      continue;
+    }
+    size_t j = i + 1;
+    std::string flags;
+    while (j < text.size() && strchr("-+ #0", text[j])) flags += text[j++];
+    while (j < text.size() && (isdigit((unsigned char)text[j]) || text[j] == '*' || text[j] == '.')) ++j;
+    while (j < text.size() && strchr("hljztL", text[j])) ++j;
+    if (j == text.size()) {
+      out += text.substr(i);
+      break;
+    }
+    const char conv = text[j];
+    const char *digits = "0123456789";
+    switch (conv) {
+      case '%': out += '%'; break;
+      case 'd':
+      case 'i': out += digits; out += '-'; break;
+      case 'u': out += digits; break;
+      case 'x': out += "0123456789abcdef"; break;
+      case 'X': out += "0123456789ABCDEF"; break;
+      case 'f':
+      case 'F': out += digits; out += "-."; break;
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G': out += digits; out += "-.+"; out += conv; break;
+      case 'c':
+      case 's':
+      case 'p':
+        break;
+      default:
+        // Not a conversion; the '%' is plain text.
+        out += text.substr(i, j - i + 1);
+        break;
+    }
+    if (strchr("dixXfFeEgG", conv) && flags.find('+') != std::string::npos) out += '+';
+    if (strchr("dixXfFeEgG", conv) && flags.find(' ') != std::string::npos) out += ' ';
+    i = j;
+  }
+  return out;
+}
+
+void add_glyphs(GlyphSet &glyphs, const std::string &bytes, const std::string &where) {
+  for (uint32_t cp : utf8_decode(bytes)) {
+    if (cp < 0x20) continue;  // Line breaks and tabs are layout, not glyphs.
+    glyphs.emplace(cp, GlyphUse{where});
+  }
+}
+
+// LV_SYMBOL_* name -> UTF-8 bytes, from lv_symbol_def.h.
+bool load_symbols(const std::string &path, std::map<std::string, std::string> &symbols) {
+  std::string text;
+  if (!read_file(path, text)) return false;
+  size_t pos = 0;
+  while ((pos = text.find("#define LV_SYMBOL_", pos)) != std::string::npos) {
+    pos += 8;
+    const size_t nameEnd = text.find_first_of(" \t", pos);
+    const size_t open = text.find('"', nameEnd);
+    const size_t lineEnd = text.find('\n', pos);
+    if (open == std::string::npos || open > lineEnd) continue;
+    const size_t close = text.find('"', open + 1);
+    symbols.emplace(text.substr(pos, nameEnd - pos), unescape(text.substr(open + 1, close - open - 1)));
+  }
+  return !symbols.empty();
+}
+
+bool scan_source(const std::string &path, const std::map<std::string, std::string> &symbols,
+                 GlyphSet &glyphs) {
+  std::string text;
+  if (!read_file(path, text)) {
+    fprintf(stderr, "font_subset: cannot read %s\n", path.c_str());
+    return false;
+  }
+  const std::string name = base_name(path);
+  unsigned line = 1;
+  bool lineStart = true;
+  std::string lastIdent;
+  auto where = [&]() { return name + ":" + std::to_string(line); };
+
+  for (size_t i = 0; i < text.size(); ++i) {
+    const char c = text[i];
+    if (c == '\n') {
+      ++line;
+      lineStart = true;
+      continue;
+    }
+    if (isspace((unsigned char)c)) continue;
+    const bool atLineStart = lineStart;
+    lineStart = false;
+
+    if (c == '/' && i + 1 < text.size() && text[i + 1] == '/') {
+      i = text.find('\n', i) - 1;
+    } else if (c == '/' && i + 1 < text.size() && text[i + 1] == '*') {
+      const size_t end = text.find("*/", i + 2);
+      for (size_t k = i; k < end; ++k) line += text[k] == '\n';
+      i = end + 1;
+    } else if (c == '#' && atLineStart && text.compare(i, 8, "#include") == 0) {
+      i = text.find('\n', i) - 1;
+    } else if (c == '"' || c == '\'') {
+      size_t j = i + 1;
+      while (j < text.size() && text[j] != c) j += text[j] == '\\' ? 2 : 1;
+      const std::string bytes = unescape(text.substr(i + 1, j - i - 1));
+      if (!(c == '"' && lastIdent == "extern")) {
+        add_glyphs(glyphs, c == '"' ? rendered_chars(bytes) : bytes, where());
+      }
+      lastIdent.clear();
+      i = j;
+    } else if (isalpha((unsigned char)c) || c == '_') {
+      size_t j = i;
+      while (j < text.size() && (isalnum((unsigned char)text[j]) || text[j] == '_')) ++j;
+      lastIdent = text.substr(i, j - i);
+      if (lastIdent.compare(0, 10, "LV_SYMBOL_") == 0) {
+        auto sym = symbols.find(lastIdent);
+        if (sym == symbols.end()) {
+          fprintf(stderr, "%s: unknown symbol %s\n", where().c_str(), lastIdent.c_str());
+          return false;
+        }
+        add_glyphs(glyphs, sym->second, where());
+      }
+      i = j - 1;
+    } else {
+      lastIdent.clear();
+    }
+  }
+  return true;
+}
+
+// ---------------------------------------------------------------------------------------
+// LVGL font parsing (the lv_font_conv layout of LVGL's built-in fonts)
+
+struct GlyphDsc {
+  uint32_t bitmapIndex;
+  int adv_w, box_w, box_h, ofs_x, ofs_y;
+};
+
+struct Font {
+  std::string file;
+  std::vector<uint8_t> bitmap;
+  std::vector<GlyphDsc> dsc;        // Index = glyph id, 0 reserved.
+  std::map<uint32_t, uint32_t> ids; // Code point -> glyph id.
+  std::vector<uint8_t> leftClass, rightClass;
+  std::vector<int8_t> classValues;
+  int leftCnt = 0, rightCnt = 0;
+  int kernScale = 0, bpp = 0, lineHeight = 0, baseLine = 0;
+  int underlinePosition = 0, underlineThickness = 0;
+};
+
+// Body of "name[] = { ... };".
+std::string array_body(const std::string &text, const std::string &name) {
+  const size_t at = text.find(" " + name + "[]");
+  if (at == std::string::npos) return std::string();
+  const size_t open = text.find('{', at);
+  const size_t close = text.find("};", open);
+  return text.substr(open + 1, close - open - 1);
+}
+
+std::vector<long> numbers(const std::string &body) {
+  std::vector<long> out;
+  for (size_t i = 0; i < body.size(); ++i) {
+    if (body[i] == '/' && i + 1 < body.size() && body[i + 1] == '*') {
+      i = body.find("*/", i) + 1;
+    } else if (isdigit((unsigned char)body[i]) || (body[i] == '-' && isdigit((unsigned char)body[i + 1]))) {
+      char *end;
+      out.push_back(strtol(body.c_str() + i, &end, 0));
+      i = (size_t)(end - body.c_str()) - 1;
+    }
+  }
+  return out;
+}
+
+// The value after "name =" at or after from. False when name or its '=' is missing.
+bool field(const std::string &text, size_t from, const char *name, long &value) {
+  const size_t at = text.find(name, from);
+  if (at == std::string::npos) return false;
+  const size_t eq = text.find('=', at);
+  if (eq == std::string::npos) return false;
+  char *end;
+  value = strtol(text.c_str() + eq + 1, &end, 0);
+  return end != text.c_str() + eq + 1;
+}
+
+// As field(), for an identifier value (a macro or array name).
+bool field_token(const std::string &text, size_t from, const char *name, std::string &token) {
+  const size_t at = text.find(name, from);
+  if (at == std::string::npos) return false;
+  size_t i = text.find('=', at);
+  if (i == std::string::npos) return false;
+  ++i;
+  while (i < text.size() && text[i] == ' ') ++i;
+  size_t j = i;
+  while (j < text.size() && (isalnum((unsigned char)text[j]) || text[j] == '_')) ++j;
+  token = text.substr(i, j - i);
+  return j > i;
+}
+
+bool load_font(const std::string &path, Font &font) {
+  std::string text;
+  if (!read_file(path, text)) {
+    fprintf(stderr, "font_subset: cannot read %s\n", path.c_str());
+    return false;
+  }
+  font.file = base_name(path);
+  for (long v : numbers(array_body(text, "glyph_bitmap"))) font.bitmap.push_back((uint8_t)v);
+
+  const std::string dscBody = array_body(text, "glyph_dsc");
+  for (size_t at = 0; (at = dscBody.find(".bitmap_index", at)) != std::string::npos; ++at) {
+    GlyphDsc d;
+    long bitmapIndex;
+    if (sscanf(dscBody.c_str() + at,
+               ".bitmap_index = %ld, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, "
+               ".ofs_y = %d",
+               &bitmapIndex, &d.adv_w, &d.box_w, &d.box_h, &d.ofs_x, &d.ofs_y) != 6) {
+      fprintf(stderr, "font_subset: %s: bad glyph_dsc entry\n", font.file.c_str());
+      return false;
+    }
+    d.bitmapIndex = (uint32_t)bitmapIndex;
+    font.dsc.push_back(d);
+  }
+
+  const std::string cmapBody = array_body(text, "cmaps");
+  for (size_t at = 0; (at = cmapBody.find(".range_start", at)) != std::string::npos; ++at) {
+    long start, length, idStart;
+    std::string type;
+    if (!field(cmapBody, at, ".range_start", start) ||
+        !field(cmapBody, at, ".range_length", length) ||
+        !field(cmapBody, at, ".glyph_id_start", idStart) ||
+        !field_token(cmapBody, at, ".type", type)) {
+      fprintf(stderr, "font_subset: %s: bad cmaps entry\n", font.file.c_str());
+      return false;
+    }
+    if (type == "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY") {
+      for (long k = 0; k < length; ++k) font.ids[(uint32_t)(start + k)] = (uint32_t)(idStart + k);
+    } else if (type == "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY") {
+      std::string listName;
+      if (!field_token(cmapBody, at, ".unicode_list", listName)) {
+        fprintf(stderr, "font_subset: %s: bad cmaps entry\n", font.file.c_str());
+        return false;
+      }
+      const std::vector<long> list = numbers(array_body(text, listName));
+      for (size_t k = 0; k < list.size(); ++k) {
+        font.ids[(uint32_t)(start + list[k])] = (uint32_t)(idStart + (long)k);
+      }
+    } else {
+      fprintf(stderr, "font_subset: %s: unsupported cmap %s\n", font.file.c_str(), type.c_str());
+      return false;
+    }
+  }
+
+  long v;
+  if (field(text, 0, ".bitmap_format", v) && v != 0) {
+    fprintf(stderr, "font_subset: %s: source font must be uncompressed\n", font.file.c_str());
+    return false;
+  }
+  auto required = [&](const char *name, int &out) {
+    if (!field(text, 0, name, v)) {
+      fprintf(stderr, "font_subset: %s: no %s field\n", font.file.c_str(), name);
+      return false;
+    }
+    out = (int)v;
+    return true;
+  };
+  if (!required(".bpp", font.bpp) || !required(".kern_scale", font.kernScale) ||
+      !required(".line_height", font.lineHeight) || !required(".base_line", font.baseLine) ||
+      !required(".underline_position", font.underlinePosition) ||
+      !required(".underline_thickness", font.underlineThickness)) {
+    return false;
+  }
+  if (field(text, 0, ".kern_classes", v) && v == 1) {
+    for (long c : numbers(array_body(text, "kern_left_class_mapping"))) font.leftClass.push_back((uint8_t)c);
+    for (long c : numbers(array_body(text, "kern_right_class_mapping"))) font.rightClass.push_back((uint8_t)c);
+    for (long c : numbers(array_body(text, "kern_class_values"))) font.classValues.push_back((int8_t)c);
+    if (!required(".left_class_cnt", font.leftCnt) || !required(".right_class_cnt", font.rightCnt)) {
+      return false;
+    }
+  }
+  if (font.dsc.empty() || font.ids.empty() || font.bitmap.empty() || font.bpp != 4) {
+    fprintf(stderr, "font_subset: %s: not an LVGL 4 bpp font\n", font.file.c_str());
+    return false;
+  }
+  return true;
+}
+
+// ---------------------------------------------------------------------------------------
+// RLE (LV_FONT_FMT_TXT_COMPRESSED)
+
+class BitWriter {
+ public:
+  void put(uint32_t value, int bits) {
+    for (int b = bits - 1; b >= 0; --b) {
+      if (pos_ % 8 == 0) bytes_.push_back(0);
+      if ((value >> b) & 1) bytes_.back() |= (uint8_t)(0x80 >> (pos_ % 8));
+      ++pos_;
+    }
+  }
+  const std::vector<uint8_t> &bytes() const { return bytes_; }
+
+ private:
+  std::vector<uint8_t> bytes_;
+  uint32_t pos_ = 0;
+};
+
+// Mirrors rle_next() in lv_font_fmt_txt.c: a literal equal to the previous one switches
+// to repeat bits; 1 repeats, 0 is followed by a new literal; after 11 ones a 6-bit count
+// C follows, which repeats C - 1 more times and then reads a literal.
+std::vector<uint8_t> rle_encode(const std::vector<uint8_t> &v, int bpp) {
+  BitWriter w;
+  int prev = -1;
+  size_t i = 0;
+  while (i < v.size()) {
+    const bool repeat = i != 0 && v[i] == prev;
+    w.put(v[i], bpp);
+    prev = v[i++];
+    if (!repeat) continue;
+
+    size_t run = 0;
+    while (i + run < v.size() && v[i + run] == prev) ++run;
+    if (run <= 10) {
+      w.put((1u << run) - 1, (int)run);
+      i += run;
+      if (i < v.size()) {
+        w.put(0, 1);
+        w.put(v[i], bpp);
+        prev = v[i++];
+      }
+    } else {
+      w.put(0x7ff, 11);
+      i += 11;
+      const size_t rest = run - 11;
+      if (rest + 1 <= 63) {
+        w.put((uint32_t)(rest + 1), 6);
+        i += rest;
+        if (i < v.size()) {
+          w.put(v[i], bpp);
+          prev = v[i++];
+        }
+      } else {
+        w.put(63, 6);
+        i += 62;
+        w.put(v[i++], bpp);  // Still the repeated value; the next literal restarts the run.
+      }
+    }
+  }
+  return w.bytes();
+}
+
+// Copy of the lv_font_fmt_txt.c decoder (rle_next()), to prove every glyph round-trips.
+std::vector<uint8_t> rle_decode(const std::vector<uint8_t> &in, size_t count, int bpp) {
+  auto bits = [&](uint32_t pos, int len) {
+    uint32_t v = 0;
+    for (int k = 0; k < len; ++k, ++pos) {
+      const uint8_t byte = pos / 8 < in.size() ? in[pos / 8] : 0;
+      v = (v << 1) | ((byte >> (7 - pos % 8)) & 1);
+    }
+    return (uint8_t)v;
+  };
+  enum { SINGLE, REPEAT, COUNTER } state = SINGLE;
+  uint32_t rdp = 0;
+  uint8_t prev = 0, cnt = 0;
+  std::vector<uint8_t> out;
+  while (out.size() < count) {
+    uint8_t ret = 0;
+    if (state == SINGLE) {
+      ret = bits(rdp, bpp);
+      if (rdp != 0 && prev == ret) {
+        cnt = 0;
+        state = REPEAT;
+      }
+      prev = ret;
+      rdp += bpp;
+    } else if (state == REPEAT) {
+      const uint8_t bit = bits(rdp, 1);
+      ++cnt;
+      ++rdp;
+      if (bit) {
+        ret = prev;
+        if (cnt == 11) {
+          cnt = bits(rdp, 6);
+          rdp += 6;
+          if (cnt != 0) {
+            state = COUNTER;
+          } else {
+            ret = bits(rdp, bpp);
+            prev = ret;
+            rdp += bpp;
+            state = SINGLE;
+          }
+        }
+      } else {
+        ret = bits(rdp, bpp);
+        prev = ret;
+        rdp += bpp;
+        state = SINGLE;
+      }
+    } else {
+      ret = prev;
+      if (--cnt == 0) {
+        ret = bits(rdp, bpp);
+        prev = ret;
+        rdp += bpp;
+        state = SINGLE;
+      }
+    }
+    out.push_back(ret);
+  }
+  return out;
+}
+
+// ---------------------------------------------------------------------------------------
+// Subset
+
+struct Subset {
+  std::string name;
+  std::string text;    // Generated C source.
+  size_t glyphs = 0;
+  size_t sourceBytes = 0, bytes = 0;  // Bitmap plus tables, as the firmware stores them.
+};
+
+void emit_bytes(std::string &out, const std::vector<uint8_t> &bytes, size_t from, size_t to) {
+  char buf[16];
+  for (size_t k = from; k < to; ++k) {
+    out += (k - from) % 16 == 0 ? "    " : " ";
+    snprintf(buf, sizeof(buf), "0x%x,", bytes[k]);
+    out += buf;
+    if ((k - from) % 16 == 15 || k + 1 == to) out += "\n";
+  }
+}
+
+template <typename T>
+void emit_list(std::string &out, const std::vector<T> &values, bool hex) {
+  char buf[24];
+  for (size_t k = 0; k < values.size(); ++k) {
+    out += k % 16 == 0 ? "    " : " ";
+    snprintf(buf, sizeof(buf), hex ? "0x%x," : "%d,", (int)values[k]);
+    out += buf;
+    if (k % 16 == 15 || k + 1 == values.size()) out += "\n";
+  }
+}
+
+std::string glyph_comment(uint32_t cp) {
+  char buf[32];
+  if (cp < 0x7f && cp != '"' && cp != '\\' && cp != '*' && cp != '/') {
+    snprintf(buf, sizeof(buf), "U+%04X \"%c\"", (unsigned)cp, (char)cp);
+  } else {
+    snprintf(buf, sizeof(buf), "U+%04X", (unsigned)cp);
+  }
+  return buf;
+}
+
+size_t source_table_bytes(const Font &font) {
+  // 8 B per glyph_dsc entry, 2 B per sparse code point, the kerning tables.
+  size_t sparse = 0;
+  for (const auto &id : font.ids) sparse += id.first >= 0x80;
+  return font.dsc.size() * 8 + sparse * 2 + font.leftClass.size() + font.rightClass.size() +
+         font.classValues.size();
+}
+
+bool build_subset(const Font &font, const GlyphSet &glyphs, int size, bool compress,
+                  Subset &out) {
+  char buf[1024];
+  out.name = "ui_font_montserrat_" + std::to_string(size);
+
+  std::vector<uint32_t> cps;
+  bool ok = true;
+  for (const auto &g : glyphs) {
+    if (!font.ids.count(g.first)) {
+      fprintf(stderr, "%s: %s is not in %s\n", g.second.where.c_str(), glyph_comment(g.first).c_str(),
+              font.file.c_str());
+      ok = false;
+    }
+    cps.push_back(g.first);
+  }
+  if (!ok) return false;
+
+  // New glyph ids follow code point order: ASCII first, then the symbols.
+  std::vector<uint32_t> oldIds(1, 0);
+  for (uint32_t cp : cps) oldIds.push_back(font.ids.at(cp));
+  out.glyphs = cps.size();
+
+  std::string &s = out.text;
+  snprintf(buf, sizeof(buf),
+           "/*******************************************************************************\n"
+           " * Size: %d px\n"
+           " * Bpp: %d\n"
+           " * Subset of LVGL's %s: %zu of %zu glyphs%s.\n"
+           " * Generated by firmware/host/font_subset from the UI sources. Do not edit;\n"
+           " * run `cmake --build <host build dir> --target ui_fonts` after changing UI text.\n"
+           " ******************************************************************************/\n\n",
+           size, font.bpp, font.file.c_str(), cps.size(), font.dsc.size() - 1,
+           compress ? ", RLE compressed" : "");
+  s += buf;
+  s += "#ifndef LV_CONF_INCLUDE_SIMPLE\n#define LV_CONF_INCLUDE_SIMPLE\n#endif\n#include <lvgl.h>\n\n";
+
+  // Bitmaps.
+  s += "/*-----------------\n *    BITMAPS\n *----------------*/\n\n"
+       "/*Store the image of the glyphs*/\n"
+       "static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {\n";
+  std::vector<uint8_t> bitmap;
+  std::vector<uint32_t> index(oldIds.size(), 0);
+  for (size_t id = 1; id < oldIds.size(); ++id) {
+    const GlyphDsc &d = font.dsc[oldIds[id]];
+    const size_t pixels = (size_t)d.box_w * d.box_h;
+    const size_t len = (pixels * font.bpp + 7) / 8;
+    index[id] = (uint32_t)bitmap.size();
+    const size_t from = bitmap.size();
+    if (!compress) {
+      bitmap.insert(bitmap.end(), font.bitmap.begin() + d.bitmapIndex,
+                    font.bitmap.begin() + d.bitmapIndex + len);
+    } else if (pixels) {
+      std::vector<uint8_t> px(pixels), filtered(pixels);
+      for (size_t p = 0; p < pixels; ++p) {
+        const uint8_t byte = font.bitmap[d.bitmapIndex + p / 2];
+        px[p] = p % 2 ? byte & 0x0f : byte >> 4;
+      }
+      for (size_t p = 0; p < pixels; ++p) {
+        filtered[p] = p < (size_t)d.box_w ? px[p] : px[p] ^ px[p - d.box_w];
+      }
+      const std::vector<uint8_t> packed = rle_encode(filtered, font.bpp);
+      std::vector<uint8_t> back = rle_decode(packed, pixels, font.bpp);
+      for (size_t p = (size_t)d.box_w; p < pixels; ++p) back[p] ^= back[p - d.box_w];
+      if (back != px) {
+        fprintf(stderr, "font_subset: %s %s does not survive RLE\n", font.file.c_str(),
+                glyph_comment(cps[id - 1]).c_str());
+        return false;
+      }
+      bitmap.insert(bitmap.end(), packed.begin(), packed.end());
+    }
+    s += "    /* " + glyph_comment(cps[id - 1]) + " */\n";
+    emit_bytes(s, bitmap, from, bitmap.size());
+    s += "\n";
+  }
+  // The decoder reads up to one byte past a glyph's last bit.
+  if (compress) {
+    s += "    /* End padding */\n    0x0\n";
+    bitmap.push_back(0);
+  } else if (s.compare(s.size() - 2, 2, "\n\n") == 0) {
+    s.erase(s.size() - 1);
+  }
+  s += "};\n\n";
+
+  // Glyph descriptors.
+  s += "/*---------------------\n *  GLYPH DESCRIPTION\n *--------------------*/\n\n"
+       "static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {\n"
+       "    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */";
+  for (size_t id = 1; id < oldIds.size(); ++id) {
+    const GlyphDsc &d = font.dsc[oldIds[id]];
+    snprintf(buf, sizeof(buf),
+             ",\n    {.bitmap_index = %u, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, "
+             ".ofs_y = %d}",
+             (unsigned)index[id], d.adv_w, d.box_w, d.box_h, d.ofs_x, d.ofs_y);
+    s += buf;
+  }
+  s += "\n};\n\n";
+
+  // Character mapping: a direct table for ASCII, a sparse list for everything else.
+  std::vector<uint32_t> ascii, sparse;
+  for (uint32_t cp : cps) (cp < 0x80 ? ascii : sparse).push_back(cp);
+  s += "/*---------------------\n *  CHARACTER MAPPING\n *--------------------*/\n\n";
+  std::string cmaps;
+  int cmapNum = 0;
+  size_t tableBytes = out.glyphs * 8 + 8;
+  if (!ascii.empty()) {
+    const uint32_t first = ascii.front();
+    // One spare entry: LVGL 8.1 also looks up range_start + range_length in the table.
+    std::vector<uint8_t> ofs(ascii.back() - first + 2, 0);
+    for (size_t k = 0; k < ascii.size(); ++k) ofs[ascii[k] - first] = (uint8_t)(k + 1);
+    s += "/*Glyph id per code point, 0 = not in the subset*/\n"
+         "static const uint8_t glyph_id_ofs_list_0[] = {\n";
+    emit_list(s, ofs, false);
+    s += "};\n\n";
+    snprintf(buf, sizeof(buf),
+             "    {\n        .range_start = %u, .range_length = %zu, .glyph_id_start = 0,\n"
+             "        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, "
+             ".list_length = %zu, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL\n    }",
+             (unsigned)first, ofs.size() - 1, ofs.size() - 1);
+    cmaps += buf;
+    tableBytes += ofs.size() + 20;
+    ++cmapNum;
+  }
+  if (!sparse.empty()) {
+    std::vector<uint16_t> list;
+    for (uint32_t cp : sparse) list.push_back((uint16_t)(cp - sparse.front()));
+    snprintf(buf, sizeof(buf), "static const uint16_t unicode_list_%d[] = {\n", cmapNum);
+    s += buf;
+    emit_list(s, list, true);
+    s += "};\n\n";
+    snprintf(buf, sizeof(buf),
+             "%s    {\n        .range_start = %u, .range_length = %u, .glyph_id_start = %zu,\n"
+             "        .unicode_list = unicode_list_%d, .glyph_id_ofs_list = NULL, "
+             ".list_length = %zu, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n    }",
+             cmapNum ? ",\n" : "", (unsigned)sparse.front(),
+             (unsigned)(sparse.back() - sparse.front() + 1), ascii.size() + 1, cmapNum,
+             list.size());
+    cmaps += buf;
+    tableBytes += list.size() * 2 + 20;
+    ++cmapNum;
+  }
+  s += "/*Collect the unicode lists and glyph_id offsets*/\n"
+       "static const lv_font_fmt_txt_cmap_t cmaps[] =\n{\n" + cmaps + "\n};\n\n";
+
+  // Kerning: keep the classes that still pair with something non-zero.
+  s += "/*-----------------\n *    KERNING\n *----------------*/\n\n";
+  std::vector<int> leftMap(font.leftCnt + 1, 0), rightMap(font.rightCnt + 1, 0);
+  std::vector<int> leftKeep, rightKeep;
+  if (!font.classValues.empty()) {
+    std::set<int> lefts, rights;
+    for (size_t id = 1; id < oldIds.size(); ++id) {
+      if (font.leftClass[oldIds[id]]) lefts.insert(font.leftClass[oldIds[id]]);
+      if (font.rightClass[oldIds[id]]) rights.insert(font.rightClass[oldIds[id]]);
+    }
+    auto value = [&](int l, int r) { return font.classValues[(l - 1) * font.rightCnt + (r - 1)]; };
+    for (int l : lefts) {
+      for (int r : rights) {
+        if (value(l, r)) {
+          leftKeep.push_back(l);
+          break;
+        }
+      }
+    }
+    for (int r : rights) {
+      for (int l : leftKeep) {
+        if (value(l, r)) {
+          rightKeep.push_back(r);
+          break;
+        }
+      }
+    }
+    for (size_t k = 0; k < leftKeep.size(); ++k) leftMap[leftKeep[k]] = (int)k + 1;
+    for (size_t k = 0; k < rightKeep.size(); ++k) rightMap[rightKeep[k]] = (int)k + 1;
+  }
+  const bool kern = !leftKeep.empty();
+  if (kern) {
+    std::vector<uint8_t> left, right;
+    for (uint32_t old : oldIds) {
+      left.push_back((uint8_t)leftMap[font.leftClass[old]]);
+      right.push_back((uint8_t)rightMap[font.rightClass[old]]);
+    }
+    left[0] = right[0] = 0;
+    std::vector<int8_t> values;
+    for (int l : leftKeep) {
+      for (int r : rightKeep) values.push_back(font.classValues[(l - 1) * font.rightCnt + (r - 1)]);
+    }
+    s += "/*Map glyph_ids to kern left classes*/\nstatic const uint8_t kern_left_class_mapping[] =\n{\n";
+    emit_list(s, left, false);
+    s += "};\n\n/*Map glyph_ids to kern right classes*/\nstatic const uint8_t kern_right_class_mapping[] =\n{\n";
+    emit_list(s, right, false);
+    s += "};\n\n/*Kern values between classes*/\nstatic const int8_t kern_class_values[] =\n{\n";
+    emit_list(s, values, false);
+    snprintf(buf, sizeof(buf),
+             "};\n\n\n/*Collect the kern class' data in one place*/\n"
+             "static const lv_font_fmt_txt_kern_classes_t kern_classes =\n{\n"
+             "    .class_pair_values   = kern_class_values,\n"
+             "    .left_class_mapping  = kern_left_class_mapping,\n"
+             "    .right_class_mapping = kern_right_class_mapping,\n"
+             "    .left_class_cnt      = %zu,\n"
+             "    .right_class_cnt     = %zu,\n};\n\n",
+             leftKeep.size(), rightKeep.size());
+    s += buf;
+    tableBytes += left.size() + right.size() + values.size();
+  } else {
+    s += "/*No kerning between the glyphs of this subset*/\n\n";
+  }
+
+  snprintf(buf, sizeof(buf),
+           "/*--------------------\n *  ALL CUSTOM DATA\n *--------------------*/\n\n"
+           "/*Store all the custom data of the font*/\n"
+           "static lv_font_fmt_txt_glyph_cache_t cache;\n"
+           "static const lv_font_fmt_txt_dsc_t font_dsc = {\n"
+           "    .glyph_bitmap = glyph_bitmap,\n"
+           "    .glyph_dsc = glyph_dsc,\n"
+           "    .cmaps = cmaps,\n"
+           "    .kern_dsc = %s,\n"
+           "    .kern_scale = %d,\n"
+           "    .cmap_num = %d,\n"
+           "    .bpp = %d,\n"
+           "    .kern_classes = %d,\n"
+           "    .bitmap_format = %d,\n"
+           "    .cache = &cache\n};\n\n",
+           kern ? "&kern_classes" : "NULL", font.kernScale, cmapNum, font.bpp, kern ? 1 : 0,
+           compress ? 1 : 0);
+  s += buf;
+  snprintf(buf, sizeof(buf),
+           "/*-----------------\n *  PUBLIC FONT\n *----------------*/\n\n"
+           "/*Initialize a public general font descriptor*/\n"
+           "const lv_font_t %s = {\n"
+           "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/\n"
+           "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/\n"
+           "    .line_height = %d,          /*The maximum line height required by the font*/\n"
+           "    .base_line = %d,             /*Baseline measured from the bottom of the line*/\n"
+           "    .subpx = LV_FONT_SUBPX_NONE,\n"
+           "    .underline_position = %d,\n"
+           "    .underline_thickness = %d,\n"
+           "    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */\n"
+           "};\n",
+           out.name.c_str(), font.lineHeight, font.baseLine, font.underlinePosition,
+           font.underlineThickness);
+  s += buf;
+
+  out.sourceBytes = font.bitmap.size() + source_table_bytes(font);
+  out.bytes = bitmap.size() + tableBytes;
+  return true;
+}
+
+std::vector<int> parse_sizes(const char *arg) {
+  std::vector<int> sizes;
+  for (const char *p = arg; *p;) {
+    char *end;
+    sizes.push_back((int)strtol(p, &end, 10));
+    p = *end == ',' ? end + 1 : end;
+    if (end == p && *p) break;
+  }
+  return sizes;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::string fontDir, outDir;
+  std::vector<int> sizes, compressed;
+  std::vector<std::string> sources;
+  bool check = false;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--fonts") == 0 && i + 1 < argc) {
+      fontDir = argv[++i];
+    } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+      outDir = argv[++i];
+    } else if (strcmp(argv[i], "--sizes") == 0 && i + 1 < argc) {
+      sizes = parse_sizes(argv[++i]);
+    } else if (strcmp(argv[i], "--compress") == 0 && i + 1 < argc) {
+      compressed = parse_sizes(argv[++i]);
+    } else if (strcmp(argv[i], "--check") == 0) {
+      check = true;
+    } else if (argv[i][0] != '-') {
+      sources.push_back(argv[i]);
+    } else {
+      sources.clear();
+      break;
+    }
+  }
+  if (fontDir.empty() || outDir.empty() || sizes.empty() || sources.empty()) {
+    fprintf(stderr,
+            "usage: %s --fonts DIR --out DIR --sizes N[,N...] [--compress N[,N...]] [--check] "
+            "SOURCE...\n",
+            argv[0]);
+    return 2;
+  }
+
+  std::map<std::string, std::string> symbols;
+  if (!load_symbols(fontDir + "/lv_symbol_def.h", symbols)) {
+    fprintf(stderr, "font_subset: no LV_SYMBOL_* definitions in %s/lv_symbol_def.h\n",
+            fontDir.c_str());
+    return 1;
+  }
+  GlyphSet glyphs;
+  add_glyphs(glyphs, kBaseGlyphs, "font_subset.cpp (numbers formatted by LVGL)");
+  for (const std::string &src : sources) {
+    if (!scan_source(src, symbols, glyphs)) return 1;
+  }
+
+  int failures = 0;
+  for (int size : sizes) {
+    Font font;
+    if (!load_font(fontDir + "/lv_font_montserrat_" + std::to_string(size) + ".c", font)) return 1;
+    bool compress = false;
+    for (int c : compressed) compress |= c == size;
+    Subset subset;
+    if (!build_subset(font, glyphs, size, compress, subset)) {
+      failures++;
+      continue;
+    }
+
+    const std::string path = outDir + "/" + subset.name + ".c";
+    std::string current;
+    const bool same = read_file(path, current) && current == subset.text;
+    if (check && !same) {
+      fprintf(stderr,
+              "font_subset: %s is out of date with the UI sources; run `cmake --build <host "
+              "build dir> --target ui_fonts`\n",
+              path.c_str());
+      failures++;
+      continue;
+    }
+    if (!check && !same) {
+      FILE *f = fopen(path.c_str(), "wb");
+      if (!f || fwrite(subset.text.data(), 1, subset.text.size(), f) != subset.text.size()) {
+        fprintf(stderr, "font_subset: cannot write %s\n", path.c_str());
+        if (f) fclose(f);
+        return 1;
+      }
+      fclose(f);
+    }
+    printf("%s glyphs=%zu/%zu bytes=%zu/%zu%s%s\n", subset.name.c_str(), subset.glyphs,
+           font.dsc.size() - 1, subset.bytes, subset.sourceBytes, compress ? " rle" : "",
+           check ? "" : (same ? " unchanged" : " written"));
+  }
+
+  std::string ascii;
+  for (const auto &g : glyphs) {
+    if (g.first < 0x80) ascii += (char)g.first;
+  }
+  printf("glyphs \"%s\" + %zu symbol(s)\n", ascii.c_str(), (size_t)(glyphs.size() - ascii.size()));
+  return failures ? 1 : 0;
+}
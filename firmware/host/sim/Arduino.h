@@ -0,0 +1,13 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// Just enough of the Arduino core for the UI modules built by the host simulator.
+// Time comes from the simulated clock in sim_hal.cpp, not from the host.
+
+#include <math.h>
+#include <stdint.h>
+
+uint32_t millis();
+uint32_t micros();
+
+#endif
@@ -0,0 +1,227 @@
+// Per-tile render cost of the LVGL UI on the host simulator.
+//
+// Shows each tile of lv_time_attack_ui_init() in turn, lets the tile animation settle,
+// then plays a scripted scenario on it and reports, per scenario, host render time per
+// frame, invalidated (flushed) pixels per frame, LVGL heap use and how many widget
+// updates the snapshot bindings (ui_bind.h) applied or skipped, plus the IMU reads and
+// G-force timer ticks that ran (ui_tile_activity.h). It also walks the visible tile's
+// widgets and reports how many style properties they hold as local styles and how long
+// resolving the properties every widget draw reads takes (style_lookup_us, one pass
+// over the tile), to compare shared styles (ui_styles.h) against local ones, and how long
+// the refresh governor (ui_refresh.h) spent in each mode with the frames rendered there,
+// the pixels the region-priority filter (ui_priority_area.h) held back and, for laps, the
+// size and render time of the refresh that showed the new delta.
+// Output is one JSON object per line so runs can be diffed or plotted:
+//
+//   {"tile":"race","scenario":"20_lap_run","frames":…,"ms_per_frame_avg":…,…}
+//
+// Render times are host CPU times and only comparable between runs on the same machine;
+// frames, pixels and heap figures are deterministic. A scenario whose snapshots change
+// nothing on screen reports zero frames.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "lv_time_attack_ui.h"
+#include "screen_nav.h"
+#include "sim_display.h"
+#include "sim_scenarios.h"
+#include "ui_bind.h"
+#include "ui_priority_area.h"
+#include "ui_refresh.h"
+#include "ui_tile_activity.h"
+
+static const uint32_t kSettleMs = 1000;  // Tile scroll animation plus slack.
+static const uint32_t kStyleLookupRounds = 5;
+static const uint32_t kStyleLookupPasses = 1000;
+
+// Properties the rectangle and label draw code reads for every widget.
+static const lv_style_prop_t kDrawProps[] = {
+    LV_STYLE_BG_COLOR,      LV_STYLE_BG_OPA,     LV_STYLE_RADIUS,
+    LV_STYLE_BORDER_WIDTH,  LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_OPA,
+    LV_STYLE_SHADOW_WIDTH,  LV_STYLE_OUTLINE_WIDTH, LV_STYLE_TEXT_COLOR,
+    LV_STYLE_TEXT_FONT,     LV_STYLE_TEXT_OPA,   LV_STYLE_OPA,
+    LV_STYLE_PAD_TOP,       LV_STYLE_PAD_LEFT,   LV_STYLE_TRANSFORM_ZOOM,
+};
+
+struct StyleWalk {
+  uint32_t objects;
+  uint32_t localProps;
+  uint32_t sink;
+};
+
+static void walk_styles(lv_obj_t *obj, StyleWalk &walk, bool count) {
+  if (count) {
+    walk.objects++;
+    for (uint32_t i = 0; i < obj->style_cnt; ++i) {
+      if (obj->styles[i].is_local) walk.localProps += obj->styles[i].style->prop_cnt;
+    }
+  }
+  for (lv_style_prop_t prop : kDrawProps) {
+    walk.sink += lv_obj_get_style_prop(obj, LV_PART_MAIN, prop).num;
+  }
+  const uint32_t children = lv_obj_get_child_cnt(obj);
+  for (uint32_t i = 0; i < children; ++i) walk_styles(lv_obj_get_child(obj, i), walk, count);
+}
+
+static lv_obj_t *visible_tile() {
+  lv_obj_t *tileview = lv_obj_get_child(lv_scr_act(), 0);
+  return tileview ? lv_tileview_get_tile_act(tileview) : nullptr;
+}
+
+static void noop() {}
+
+static void show_and_settle(void (*show)()) {
+  show();
+  sim_step_ms(kSettleMs);
+  SimDisplayStats discard;
+  sim_display_take_stats(discard);
+  UiBindStats discardBind;
+  ui_bind_take_stats(discardBind);
+  UiTileActivity discardTiles[kUiTileCount];
+  ui_tile_activity_take(discardTiles);
+  UiRefreshModeStats discardRefresh[UI_REFRESH_MODE_COUNT];
+  ui_refresh_take_stats(discardRefresh);
+  UiPriorityAreaStats discardPriority;
+  ui_priority_area_take_stats(discardPriority);
+}
+
+static uint64_t now_ns() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+static double ns_to_ms(uint64_t ns) { return ns / 1e6; }
+
+static void report(const char *tile, const char *scenario) {
+  SimDisplayStats stats;
+  sim_display_take_stats(stats);
+  UiBindStats bind;
+  ui_bind_take_stats(bind);
+  UiTileActivity tiles[kUiTileCount];
+  ui_tile_activity_take(tiles);
+  UiRefreshModeStats refresh[UI_REFRESH_MODE_COUNT];
+  ui_refresh_take_stats(refresh);
+  UiPriorityAreaStats priority;
+  ui_priority_area_take_stats(priority);
+  uint64_t lapPixels = 0;
+  uint64_t lapNs = 0;
+  for (const SimEventFrame &e : stats.events) {
+    lapPixels += e.pixels;
+    lapNs += e.renderNs;
+  }
+  const size_t laps = stats.events.size();
+  const size_t lapDiv = laps ? laps : 1;
+  uint32_t imuReads = 0;
+  uint32_t gforceTicks = 0;
+  for (const UiTileActivity &t : tiles) {
+    imuReads += t.runs[UI_TILE_SUBSYSTEM_IMU_READ];
+    gforceTicks += t.runs[UI_TILE_SUBSYSTEM_GFORCE_TICK];
+  }
+
+  const std::vector<SimFrame> &frames = stats.frameLog;
+
+  uint64_t renderNs = 0;
+  uint64_t pixels = 0;
+  uint32_t flushes = 0;
+  uint32_t pixelsMax = 0;
+  std::vector<uint32_t> ns;
+  ns.reserve(frames.size());
+  for (const SimFrame &f : frames) {
+    renderNs += f.renderNs;
+    pixels += f.pixels;
+    flushes += f.flushes;
+    pixelsMax = std::max(pixelsMax, f.pixels);
+    ns.push_back(f.renderNs);
+  }
+  std::sort(ns.begin(), ns.end());
+  const size_t n = frames.size();
+  const size_t div = n ? n : 1;
+  const uint32_t p95 = n ? ns[std::min(n - 1, (n * 95) / 100)] : 0;
+  const uint32_t nsMax = n ? ns.back() : 0;
+  const uint32_t simMs = stats.refreshes * kSimTickMs;
+
+  StyleWalk walk = {};
+  uint64_t lookupNs = 0;
+  if (lv_obj_t *tileObj = visible_tile()) {
+    // Best of several rounds, so a scheduler hiccup does not end up in the figure.
+    walk_styles(tileObj, walk, true);
+    lookupNs = UINT64_MAX;
+    for (uint32_t round = 0; round < kStyleLookupRounds; ++round) {
+      const uint64_t start = now_ns();
+      for (uint32_t pass = 0; pass < kStyleLookupPasses; ++pass) walk_styles(tileObj, walk, false);
+      lookupNs = std::min(lookupNs, (now_ns() - start) / kStyleLookupPasses);
+    }
+  }
+
+  printf("{\"tile\":\"%s\",\"scenario\":\"%s\",\"sim_ms\":%u,\"frames\":%zu,"
+         "\"fps\":%.1f,\"ms_per_frame_avg\":%.4f,\"ms_per_frame_p95\":%.4f,"
+         "\"ms_per_frame_max\":%.4f,\"px_per_frame_avg\":%llu,\"px_per_frame_max\":%u,"
+         "\"flushes_per_frame\":%.2f,\"heap_used\":%u,\"heap_peak\":%u,"
+         "\"heap_total\":%u,\"bind_applied\":%u,\"bind_skipped\":%u,\"imu_reads\":%u,"
+         "\"gforce_ticks\":%u,\"tile_objects\":%u,\"local_style_props\":%u,"
+         "\"style_lookup_us\":%.2f,\"laps\":%zu,\"lap_frame_px_avg\":%llu,"
+         "\"lap_frame_ms_avg\":%.4f,\"priority_held_px\":%u,\"refresh_modes\":{",
+         tile, scenario, (unsigned)simMs, n, simMs ? n * 1000.0 / simMs : 0.0,
+         ns_to_ms(renderNs) / div, ns_to_ms(p95), ns_to_ms(nsMax),
+         (unsigned long long)(pixels / div), (unsigned)pixelsMax, (double)flushes / div,
+         (unsigned)stats.heapUsed, (unsigned)stats.heapPeak, (unsigned)LV_MEM_SIZE,
+         (unsigned)bind.applied, (unsigned)bind.skipped, (unsigned)imuReads,
+         (unsigned)gforceTicks, (unsigned)walk.objects, (unsigned)walk.localProps,
+         lookupNs / 1e3, laps, (unsigned long long)(lapPixels / lapDiv),
+         ns_to_ms(lapNs) / lapDiv, (unsigned)priority.heldPixels);
+  const char *sep = "";
+  for (uint8_t m = 0; m < UI_REFRESH_MODE_COUNT; ++m) {
+    if (refresh[m].ms == 0) continue;
+    printf("%s\"%s\":{\"ms\":%u,\"frames\":%u}", sep, ui_refresh_mode_name(m),
+           (unsigned)refresh[m].ms, (unsigned)refresh[m].frames);
+    sep = ",";
+  }
+  printf("}}\n");
+}
+
+int main() {
+  lv_init();
+  sim_display_init(false);
+  lv_time_attack_ui_init(noop, noop, noop, noop, noop, noop);
+  lv_obj_invalidate(lv_scr_act());
+
+  static const uint32_t kLapMs[] = {19840, 19510, 20120, 19730, 19960};
+  SimRace race;
+  sim_race_init(race, 20);
+  sim_step_ms(kSettleMs);
+  report("race", "boot");
+
+  show_and_settle(lv_time_attack_ui_show_settings_tile);
+  sim_race_hold(race, 3000);
+  report("settings", "idle");
+
+  show_and_settle(lv_time_attack_ui_show_race_tile);
+  sim_race_run(race, kLapMs, sizeof(kLapMs) / sizeof(kLapMs[0]));
+  report("race", "20_lap_run");
+
+  show_and_settle(ShowReactionScreen);
+  sim_reaction_sequence(231, 1000);
+  report("reaction", "countdown");
+  // The whole tile repainted every refresh with all eight lights lit, as after a tile
+  // switch or a full-screen invalidate.
+  sim_step_ms(1000, [](uint32_t) { lv_obj_invalidate(lv_scr_act()); });
+  report("reaction", "full_redraw");
+
+  show_and_settle(ShowGForceScreen);
+  sim_gforce_still(2000);
+  report("gforce", "calibrate");
+  sim_gforce_sweep(1.0f, 0.0f, 0.5f, 8000);
+  report("gforce", "lateral_sweep_1g");
+
+  show_and_settle(lv_time_attack_ui_show_review_tile);
+  sim_race_hold(race, 3000);
+  report("review", "leaderboard");
+
+  return 0;
+}
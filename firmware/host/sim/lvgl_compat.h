@@ -0,0 +1,26 @@
+#ifndef SIM_LVGL_COMPAT_H
+#define SIM_LVGL_COMPAT_H
+
+// Force-included into the UI sources when the simulator is built against LVGL older than
+// 8.2 (the vendored 8.1 tree). The firmware builds with a newer LVGL.
+
+#include <lvgl.h>
+
+#if LVGL_VERSION_MAJOR == 8 && LVGL_VERSION_MINOR < 2
+// 8.1 has no transform pivot and always zooms around the object's centre, which is the
+// pivot lv_time_attack_ui.cpp sets on its buttons.
+static inline void lv_obj_set_style_transform_pivot_x(lv_obj_t *obj, lv_coord_t value,
+                                                      lv_style_selector_t selector) {
+  (void)obj;
+  (void)value;
+  (void)selector;
+}
+static inline void lv_obj_set_style_transform_pivot_y(lv_obj_t *obj, lv_coord_t value,
+                                                      lv_style_selector_t selector) {
+  (void)obj;
+  (void)value;
+  (void)selector;
+}
+#endif
+
+#endif
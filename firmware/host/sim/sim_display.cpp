@@ -0,0 +1,357 @@
+#include "sim_display.h"
+
+#include <string.h>
+
+#include <chrono>
+
+#include "rgb565_fill.h"
+#include "ui_panel_scroll.h"
+#include "ui_priority_area.h"
+#include "ui_refresh.h"
+
+static constexpr uint32_t kBufLines = 80;  // Same as lv_port_disp.cpp.
+
+// One draw buffer, like lv_port_disp.cpp with software rotation.
+static lv_disp_draw_buf_t s_draw_buf;
+static lv_color_t s_buf1[LVGL_LOGICAL_W * kBufLines];
+static lv_color_t s_frame[LVGL_LOGICAL_W * LVGL_LOGICAL_H];  // Panel memory.
+static lv_color_t s_shown[LVGL_LOGICAL_W * LVGL_LOGICAL_H];  // s_frame through the offset.
+static lv_color_t s_check[LVGL_LOGICAL_W * LVGL_LOGICAL_H];  // Full reference render.
+static lv_color_t s_prevShown[LVGL_LOGICAL_W * LVGL_LOGICAL_H];  // Shown after the last refresh.
+// Shown pixels a scroll may leave stale: inside areas invalidated while it ran, moved
+// along with the picture. Cleared where a refresh draws and when the scroll ends.
+static uint8_t s_mayBeStale[LVGL_LOGICAL_W * LVGL_LOGICAL_H];
+static std::vector<lv_area_t> s_invalidated;  // Since the last refresh, see __wrap__lv_inv_area.
+static lv_disp_t *s_disp = nullptr;
+static bool s_checking = false;  // The reference render is in progress.
+static lv_timer_cb_t s_refrCb = nullptr;  // The filters' refresh timer callback.
+
+static SimDisplayStats s_stats{};
+static uint64_t s_refreshFlushNs = 0;
+static uint64_t s_refreshCheckNs = 0;  // Reference renders, not part of the UI's cost.
+static uint32_t s_refreshPixels = 0;
+static uint16_t s_refreshFlushes = 0;
+static bool s_eventArmed = false;
+static bool s_eventClosing = false;  // The refresh in progress closes the sample.
+static uint32_t s_eventTick = 0;
+
+static uint64_t now_ns() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// ui_host links with --wrap=lv_font_get_glyph_dsc, so every glyph lookup outside lv_font.c
+// itself (label and table drawing, text measuring, ui_digit_clock) comes through here.
+extern "C" bool __real_lv_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc,
+                                             uint32_t letter, uint32_t letter_next);
+
+extern "C" bool __wrap_lv_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc,
+                                             uint32_t letter, uint32_t letter_next) {
+  const bool found = __real_lv_font_get_glyph_dsc(font, dsc, letter, letter_next);
+  if (!found && letter >= 0x20) {
+    bool seen = false;
+    for (const SimGlyphMiss &m : s_stats.glyphMisses) seen |= m.font == font && m.letter == letter;
+    if (!seen) s_stats.glyphMisses.push_back({font, letter});
+  }
+  return found;
+}
+
+// ui_host also links with --wrap=_lv_inv_area, so the panel-scroll check sees every area
+// invalidated between refreshes before LVGL merges it into the scroll's own full-screen
+// invalidation of the tileview. Full-screen areas are that scroll (or a whole-screen
+// redraw, which the band filter never leaves stale) and are not kept.
+extern "C" void __real__lv_inv_area(lv_disp_t *disp, const lv_area_t *area);
+
+extern "C" void __wrap__lv_inv_area(lv_disp_t *disp, const lv_area_t *area) {
+  __real__lv_inv_area(disp, area);
+  if (s_refrCb == nullptr || s_checking || area == nullptr) return;
+  if (area->x1 <= 0 && area->y1 <= 0 && area->x2 >= LVGL_LOGICAL_W - 1 &&
+      area->y2 >= LVGL_LOGICAL_H - 1) {
+    return;
+  }
+  s_invalidated.push_back(*area);
+}
+
+// Copies a flushed area into fb with its columns rotated by offset, wrapping at the
+// right edge like the panel's rows wrap at the end of its scroll area.
+static void copy_area(lv_color_t *fb, const lv_area_t *area, const lv_color_t *color_p,
+                      int32_t offset) {
+  const int32_t width = area->x2 - area->x1 + 1;
+  const int32_t first = (area->x1 + offset) % LVGL_LOGICAL_W;
+  const int32_t head = first + width > LVGL_LOGICAL_W ? LVGL_LOGICAL_W - first : width;
+  for (int32_t y = area->y1; y <= area->y2; ++y) {
+    lv_color_t *row = &fb[y * LVGL_LOGICAL_W];
+    memcpy(&row[first], color_p, head * sizeof(lv_color_t));
+    memcpy(row, color_p + head, (width - head) * sizeof(lv_color_t));
+    color_p += width;
+  }
+}
+
+static void sim_display_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area,
+                              lv_color_t *color_p) {
+  if (s_checking) {
+    copy_area(s_check, area, color_p, 0);
+    lv_disp_flush_ready(disp_drv);
+    return;
+  }
+  const uint64_t start = now_ns();
+  copy_area(s_frame, area, color_p, ui_panel_scroll_offset());
+
+  s_stats.flushes++;
+  s_stats.pixels += (uint32_t)lv_area_get_size(area);
+  s_stats.areas.push_back({s_stats.refreshes, (int16_t)area->x1, (int16_t)area->y1,
+                           (int16_t)area->x2, (int16_t)area->y2});
+  s_refreshPixels += (uint32_t)lv_area_get_size(area);
+  s_refreshFlushes++;
+  s_refreshFlushNs += now_ns() - start;
+  if (s_eventArmed && lv_disp_flush_is_last(disp_drv)) {
+    s_eventArmed = false;
+    s_eventClosing = true;
+  }
+  lv_disp_flush_ready(disp_drv);
+}
+
+static void sim_display_monitor(lv_disp_drv_t *disp_drv, uint32_t time_ms, uint32_t px) {
+  (void)disp_drv;
+  (void)time_ms;  // Simulated ticks do not move while rendering; timed in refresh().
+  (void)px;
+  if (s_checking) return;
+  s_stats.frames++;
+  ui_refresh_note_frame();
+}
+
+// The firmware's DMA fill hook (LV_PORT_DISP_DMA_FILL) with the word runs stored by a
+// loop, so the full UI goes through rgb565_fill_rect()'s run splitting.
+static void fill_words(uint32_t *dst, uint32_t word, uint32_t count) {
+  for (uint32_t i = 0; i < count; ++i) dst[i] = word;
+}
+
+static void fill_rect(lv_color_t *dst, int32_t stride, const lv_area_t *area, lv_color_t color) {
+  const uint32_t byWords = rgb565_fill_rect((uint16_t *)dst, stride, lv_area_get_width(area),
+                                            lv_area_get_height(area), color.full, fill_words);
+  if (s_checking) return;
+  s_stats.fills++;
+  s_stats.fillPixels += (uint32_t)lv_area_get_size(area);
+  s_stats.fillByWords += byWords;
+}
+
+#if LVGL_VERSION_MAJOR == 8 && LVGL_VERSION_MINOR < 3
+// Before the draw context LVGL offers opaque, unmasked fills of more than 240 pixels to
+// gpu_fill_cb, with fill_area relative to dest_buf.
+static void sim_display_gpu_fill(lv_disp_drv_t *disp_drv, lv_color_t *dest_buf,
+                                 lv_coord_t dest_width, const lv_area_t *fill_area,
+                                 lv_color_t color) {
+  (void)disp_drv;
+  fill_rect(dest_buf + dest_width * fill_area->y1 + fill_area->x1, dest_width, fill_area, color);
+}
+#else
+// Same test as lv_port_disp_blend() for its DMA fill case; the blend kernels it can also
+// take (LV_PORT_DISP_SIMD_BLEND, off by default) are checked by bench_blend instead.
+static void sim_display_blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc) {
+  const bool unmasked = dsc->mask_buf == nullptr || dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER;
+  lv_area_t area;
+  if (dsc->src_buf != nullptr || !unmasked || dsc->opa < LV_OPA_MAX ||
+      dsc->blend_mode != LV_BLEND_MODE_NORMAL ||
+      !_lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area)) {
+    lv_draw_sw_blend_basic(draw_ctx, dsc);
+    return;
+  }
+  const int32_t stride = lv_area_get_width(draw_ctx->buf_area);
+  lv_color_t *dst = (lv_color_t *)draw_ctx->buf + stride * (area.y1 - draw_ctx->buf_area->y1) +
+                    (area.x1 - draw_ctx->buf_area->x1);
+  fill_rect(dst, stride, &area, dsc->color);
+}
+
+static void sim_display_draw_ctx_init(lv_disp_drv_t *disp_drv, lv_draw_ctx_t *draw_ctx) {
+  lv_draw_sw_init_ctx(disp_drv, draw_ctx);
+  ((lv_draw_sw_ctx_t *)draw_ctx)->blend = sim_display_blend;
+}
+#endif
+
+// What the panel shows: column x is panel memory column (x + offset) mod width.
+static const lv_color_t *shown_frame() {
+  const int32_t offset = ui_panel_scroll_offset();
+  if (offset == 0) return s_frame;
+  for (int32_t y = 0; y < LVGL_LOGICAL_H; ++y) {
+    const lv_color_t *src = &s_frame[y * LVGL_LOGICAL_W];
+    lv_color_t *dst = &s_shown[y * LVGL_LOGICAL_W];
+    memcpy(dst, src + offset, (LVGL_LOGICAL_W - offset) * sizeof(lv_color_t));
+    memcpy(dst + LVGL_LOGICAL_W - offset, src, offset * sizeof(lv_color_t));
+  }
+  return s_shown;
+}
+
+static void mark_area(const lv_area_t &area, uint8_t value) {
+  static const lv_area_t kScreen = {0, 0, LVGL_LOGICAL_W - 1, LVGL_LOGICAL_H - 1};
+  lv_area_t a;
+  if (!_lv_area_intersect(&a, &area, &kScreen)) return;
+  for (int32_t y = a.y1; y <= a.y2; ++y) {
+    memset(&s_mayBeStale[y * LVGL_LOGICAL_W + a.x1], value, (size_t)(a.x2 - a.x1 + 1));
+  }
+}
+
+// The picture outside a band moves left by dx (right when negative).
+static void shift_stale(int32_t dx) {
+  for (int32_t y = 0; y < LVGL_LOGICAL_H; ++y) {
+    uint8_t *row = &s_mayBeStale[y * LVGL_LOGICAL_W];
+    if (dx > 0) {
+      memmove(row, row + dx, (size_t)(LVGL_LOGICAL_W - dx));
+    } else {
+      memmove(row - dx, row, (size_t)(LVGL_LOGICAL_W + dx));
+    }
+  }
+}
+
+// Runs the refresh, then renders the whole screen in the same UI state (before any other
+// timer moves an animation on) straight into s_check and compares what the panel shows.
+// Outside the areas the refresh drew, a band refresh must show exactly the previous
+// picture moved by dx, so a misplaced band or a wrong wrap split is a mismatch however the
+// UI changed meanwhile. Against the full render, a shown pixel may only differ inside an
+// area invalidated during the scroll that the band filter dropped (panelStalePixels);
+// anything else is a mismatch. Runs of the region-priority filter leave held areas stale
+// on purpose and are not compared.
+static void check_refr_timer_cb(lv_timer_t *timer) {
+  const uint16_t flushes = s_refreshFlushes;
+  const bool wasScrolling = ui_panel_scroll_active();
+  std::vector<lv_area_t> invalidated;
+  invalidated.swap(s_invalidated);
+  s_refrCb(timer);
+  if (s_refreshFlushes == flushes) {
+    s_invalidated.insert(s_invalidated.end(), invalidated.begin(), invalidated.end());
+    return;
+  }
+
+  UiPanelScrollBand band;
+  const bool banded = ui_panel_scroll_last_band(band);
+  if (!wasScrolling || !ui_panel_scroll_active()) {
+    memset(s_mayBeStale, 0, sizeof(s_mayBeStale));
+  } else if (banded) {
+    shift_stale(band.dx);
+    for (const lv_area_t &a : invalidated) mark_area(a, 1);
+  }
+  static uint8_t drawn[LVGL_LOGICAL_W * LVGL_LOGICAL_H];
+  memset(drawn, 0, sizeof(drawn));
+  for (const SimFlushArea &a : s_stats.areas) {
+    if (a.refresh != s_stats.refreshes) continue;
+    const lv_area_t area = {a.x1, a.y1, a.x2, a.y2};
+    mark_area(area, 0);
+    for (int32_t y = a.y1; y <= a.y2; ++y) {
+      memset(&drawn[y * LVGL_LOGICAL_W + a.x1], 1, (size_t)(a.x2 - a.x1 + 1));
+    }
+  }
+
+  const lv_color_t *shown = shown_frame();
+  if (!ui_priority_area_active()) {
+    const uint64_t start = now_ns();
+    s_checking = true;
+    lv_obj_invalidate(lv_disp_get_scr_act(s_disp));
+    _lv_disp_refr_timer(timer);
+    s_checking = false;
+    for (int32_t y = 0; y < LVGL_LOGICAL_H; ++y) {
+      for (int32_t x = 0; x < LVGL_LOGICAL_W; ++x) {
+        const int32_t i = y * LVGL_LOGICAL_W + x;
+        if (banded && !drawn[i]) {
+          const int32_t from = (x + band.dx + LVGL_LOGICAL_W) % LVGL_LOGICAL_W;
+          if (shown[i].full != s_prevShown[y * LVGL_LOGICAL_W + from].full) {
+            s_stats.panelMismatchPixels++;
+            continue;
+          }
+        }
+        if (shown[i].full == s_check[i].full) continue;
+        if (s_mayBeStale[i]) {
+          s_stats.panelStalePixels++;
+        } else {
+          s_stats.panelMismatchPixels++;
+        }
+      }
+    }
+    s_refreshCheckNs += now_ns() - start;
+  }
+  memcpy(s_prevShown, shown, sizeof(s_prevShown));
+}
+
+void sim_display_init(bool panelScroll) {
+  lv_disp_draw_buf_init(&s_draw_buf, s_buf1, nullptr, LVGL_LOGICAL_W * kBufLines);
+
+  static lv_disp_drv_t disp_drv;
+  lv_disp_drv_init(&disp_drv);
+  disp_drv.hor_res = LVGL_LOGICAL_W;
+  disp_drv.ver_res = LVGL_LOGICAL_H;
+  disp_drv.flush_cb = sim_display_flush;
+  disp_drv.monitor_cb = sim_display_monitor;
+  disp_drv.draw_buf = &s_draw_buf;
+#if LVGL_VERSION_MAJOR == 8 && LVGL_VERSION_MINOR < 3
+  disp_drv.gpu_fill_cb = sim_display_gpu_fill;
+#else
+  disp_drv.draw_ctx_init = sim_display_draw_ctx_init;
+  disp_drv.draw_ctx_size = sizeof(lv_draw_sw_ctx_t);
+#endif
+
+  lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+  s_disp = disp;
+  ui_refresh_init(disp);
+  if (panelScroll) ui_panel_scroll_install(disp);
+  ui_priority_area_install(disp);
+  if (panelScroll) {
+    lv_timer_t *timer = _lv_disp_get_refr_timer(disp);
+    s_refrCb = timer->timer_cb;
+    lv_timer_set_cb(timer, check_refr_timer_cb);
+  }
+}
+
+uint64_t sim_display_refresh() {
+  s_refreshFlushNs = 0;
+  s_refreshCheckNs = 0;
+  s_refreshPixels = 0;
+  s_refreshFlushes = 0;
+  const uint64_t start = now_ns();
+  lv_timer_handler();
+  const uint64_t renderNs = now_ns() - start - s_refreshFlushNs - s_refreshCheckNs;
+
+  if (s_refreshFlushes) {
+    s_stats.frameLog.push_back({(uint32_t)renderNs, s_refreshPixels, s_refreshFlushes});
+  }
+  if (s_eventClosing) {
+    s_eventClosing = false;
+    s_stats.events.push_back({lv_tick_get() - s_eventTick, (uint32_t)renderNs, s_refreshPixels});
+  }
+  // Outside the timed section: the pool walk is not part of the UI's cost.
+  lv_mem_monitor_t mem;
+  lv_mem_monitor(&mem);
+  s_stats.heapUsed = mem.total_size - mem.free_size;
+  if (s_stats.heapUsed > s_stats.heapPeak) s_stats.heapPeak = s_stats.heapUsed;
+
+  s_stats.refreshes++;
+  s_stats.renderNs += renderNs;
+  if (renderNs > s_stats.renderNsMax) s_stats.renderNsMax = renderNs;
+  s_stats.flushNs += s_refreshFlushNs;
+  return renderNs + s_refreshFlushNs;
+}
+
+void sim_display_take_stats(SimDisplayStats &out) {
+  out = std::move(s_stats);
+  s_stats = SimDisplayStats{};
+}
+
+void sim_display_mark_event() {
+  s_eventArmed = true;
+  s_eventTick = lv_tick_get();
+}
+
+const lv_color_t *sim_display_framebuffer() { return shown_frame(); }
+
+bool sim_display_write_ppm(const char *path) {
+  FILE *f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%u %u\n255\n", (unsigned)LVGL_LOGICAL_W, (unsigned)LVGL_LOGICAL_H);
+  const lv_color_t *shown = shown_frame();
+  for (uint32_t i = 0; i < (uint32_t)LVGL_LOGICAL_W * LVGL_LOGICAL_H; ++i) {
+    const uint16_t c = shown[i].full;
+    const uint8_t rgb[3] = {(uint8_t)(((c >> 11) & 0x1f) * 255 / 31),
+                            (uint8_t)(((c >> 5) & 0x3f) * 255 / 63),
+                            (uint8_t)((c & 0x1f) * 255 / 31)};
+    fwrite(rgb, 1, sizeof(rgb), f);
+  }
+  return fclose(f) == 0;
+}
@@ -0,0 +1,89 @@
+#ifndef SIM_DISPLAY_H
+#define SIM_DISPLAY_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <vector>
+
+#include "lv_port_disp.h"
+
+// Headless LVGL display for the host simulator. It has the same logical size and draw
+// buffers as lv_port_disp.cpp, copies every flushed area into a framebuffer and records
+// the area instead of sending it to a panel. Like setup() and lv_port_disp_init(), init
+// hands the display to the refresh governor (ui_refresh.h) and installs the
+// region-priority filter (ui_priority_area.h) on its refresh timer. Solid fills take the
+// same path as with LV_PORT_DISP_DMA_FILL, rgb565_fill_rect() with a CPU word filler.
+//
+// With panel scrolling (LV_PORT_DISP_HW_SCROLL, ui_panel_scroll.h) the framebuffer stands
+// for panel memory: flushed columns land at the band filter's circular offset, and what
+// the panel shows is read back through it. Every refresh that flushed is then checked:
+// outside what it drew, a band refresh must show the previous picture shifted exactly, and
+// the picture must match a full render of the same UI state except inside areas the UI
+// invalidated during the scroll and the band filter dropped.
+
+struct SimFlushArea {
+  uint32_t refresh;  // Index of the sim_display_refresh() call that flushed it.
+  int16_t x1, y1, x2, y2;
+};
+
+// One refresh that flushed something.
+struct SimFrame {
+  uint32_t renderNs;  // Host time in lv_timer_handler(), excluding flush_cb.
+  uint32_t pixels;    // Logical pixels flushed (invalidated area actually redrawn).
+  uint16_t flushes;
+};
+
+// A character LVGL measured or drew with a font that has no glyph for it (the UI subset
+// fonts only carry what font_subset found in the UI sources).
+struct SimGlyphMiss {
+  const lv_font_t *font;
+  uint32_t letter;
+};
+
+// The refresh that closed a sim_display_mark_event() sample.
+struct SimEventFrame {
+  uint32_t latencyMs;  // Simulated time from the mark to the end of the refresh.
+  uint32_t renderNs;
+  uint32_t pixels;
+};
+
+// Counters accumulated since the previous sim_display_take_stats().
+struct SimDisplayStats {
+  uint32_t refreshes;      // sim_display_refresh() calls.
+  uint32_t frames;         // Refresh cycles that rendered something.
+  uint32_t flushes;        // flush_cb invocations.
+  uint32_t pixels;         // Logical pixels flushed.
+  uint64_t renderNs;       // Host time in lv_timer_handler(), excluding flush_cb.
+  uint64_t renderNsMax;    // Longest single refresh.
+  uint64_t flushNs;        // Host time copying flushed areas into the framebuffer.
+  uint32_t heapUsed;       // LVGL heap in use after the last refresh.
+  uint32_t heapPeak;       // Highest heapUsed seen after any refresh.
+  std::vector<SimFlushArea> areas;
+  std::vector<SimFrame> frameLog;
+  std::vector<SimGlyphMiss> glyphMisses;  // Each font/character once.
+  std::vector<SimEventFrame> events;
+  // Panel scrolling: shown pixels that are wrong (a band refresh that did not shift the
+  // rest exactly, or a difference from a full render outside a dropped area), and shown
+  // pixels inside dropped areas that differ (changes left for the final redraw).
+  uint32_t panelMismatchPixels;
+  uint32_t panelStalePixels;
+  // Solid fills through the DMA fill hook, their size and the part stored as word runs.
+  uint32_t fills;
+  uint32_t fillPixels;
+  uint32_t fillByWords;
+};
+
+void sim_display_init(bool panelScroll);
+// One LVGL timer pass (the firmware's loop() body), timed on the host clock. Returns the
+// host time it took, flushes included.
+uint64_t sim_display_refresh();
+void sim_display_take_stats(SimDisplayStats &out);
+// lv_port_disp_mark_event() on the host: the next refresh that flushes closes the sample.
+void sim_display_mark_event();
+// What the panel shows, in logical order.
+const lv_color_t *sim_display_framebuffer();
+// Writes the framebuffer as a binary PPM. Returns false when the file cannot be written.
+bool sim_display_write_ppm(const char *path);
+
+#endif
@@ -0,0 +1,41 @@
+#include "sim_hal.h"
+
+#include "Arduino.h"
+#include "imu_qmi8658.h"
+
+static uint64_t s_clockUs = 0;
+
+static bool s_imuPresent = true;
+static float s_accel[3] = {0.0f, 0.0f, 9.80665f};
+
+uint32_t millis() { return (uint32_t)(s_clockUs / 1000); }
+
+uint32_t micros() { return (uint32_t)s_clockUs; }
+
+void sim_clock_advance_ms(uint32_t ms) { s_clockUs += (uint64_t)ms * 1000; }
+
+void sim_imu_set_accel(float ax, float ay, float az) {
+  s_accel[0] = ax;
+  s_accel[1] = ay;
+  s_accel[2] = az;
+}
+
+void sim_imu_set_present(bool present) { s_imuPresent = present; }
+
+bool imu_qmi8658_init() { return s_imuPresent; }
+
+bool imu_qmi8658_read_accel(float &ax, float &ay, float &az) {
+  if (!s_imuPresent) return false;
+  ax = s_accel[0];
+  ay = s_accel[1];
+  az = s_accel[2];
+  return true;
+}
+
+bool imu_qmi8658_read_gyro(float &gx, float &gy, float &gz) {
+  if (!s_imuPresent) return false;
+  gx = 0.0f;
+  gy = 0.0f;
+  gz = 0.0f;
+  return true;
+}
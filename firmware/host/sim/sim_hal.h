@@ -0,0 +1,16 @@
+#ifndef SIM_HAL_H
+#define SIM_HAL_H
+
+#include <stdint.h>
+
+// Simulated board for the host UI build: a clock that only moves when the scenario
+// advances it, and an IMU whose accelerometer reading is set by the scenario.
+
+void sim_clock_advance_ms(uint32_t ms);
+
+// Next value returned by imu_qmi8658_read_accel(), in m/s^2.
+void sim_imu_set_accel(float ax, float ay, float az);
+// Makes imu_qmi8658_read_accel() fail, as a missing or unresponsive sensor would.
+void sim_imu_set_present(bool present);
+
+#endif
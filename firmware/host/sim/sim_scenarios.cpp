@@ -0,0 +1,188 @@
+#include "sim_scenarios.h"
+
+#include <math.h>
+
+#include "screen_reaction.h"
+#include "sim_display.h"
+#include "sim_hal.h"
+#include "ui_refresh.h"
+
+static const float kGravityMs2 = 9.80665f;
+static const float kPi = 3.14159265f;
+static const uint32_t kReactionArmedMs = 3000;  // REACTION_ARMED_COUNTDOWN_MS
+static const uint32_t kReactionAmberMs = 1000;
+static const uint32_t kReactionHoldMs = 1200;
+
+static uint32_t s_nowMs = 0;
+static SimRace *s_race = nullptr;
+static ReactionState s_reactionState = REACTION_IDLE;  // gReactionState in pilaptimer.ino
+
+static void race_push(SimRace &race, uint32_t now);
+
+uint32_t sim_now_ms() { return s_nowMs; }
+
+void sim_step_ms(uint32_t ms, const std::function<void(uint32_t)> &step) {
+  for (uint32_t t = 0; t < ms; t += kSimTickMs) {
+    if (step) step(s_nowMs);
+    if (s_race) race_push(*s_race, s_nowMs);
+    ui_refresh_update(s_nowMs, s_race ? s_race->snapshot.state : UI_IDLE, s_reactionState);
+    sim_clock_advance_ms(kSimTickMs);
+    s_nowMs += kSimTickMs;
+    lv_tick_inc(kSimTickMs);
+    ui_refresh_add_busy_us((uint32_t)(sim_display_refresh() / 1000));
+  }
+}
+
+// ---------------------------------------------------------------------------------------
+// Race session: the same snapshot fields pilaptimer.ino fills before
+// lv_time_attack_ui_update().
+
+static void race_push(SimRace &race, uint32_t now) {
+  if (!race.dirty && now - race.lastUiMs < ui_refresh_snapshot_ms()) return;
+  race.lastUiMs = now;
+  race.dirty = false;
+  UiSnapshot &s = race.snapshot;
+  if (s.state == UI_RUNNING) {
+    s.sessionMs = now - race.startMs;
+    s.currentLapMs = now - race.lapStartMs;
+  } else if (s.state == UI_FINISHED) {
+    s.currentLapMs = s.lastLapMs;
+  } else {
+    s.currentLapMs = 0;
+  }
+  lv_time_attack_ui_update(s);
+  if (race.lapEvent) {
+    race.lapEvent = false;
+    sim_display_mark_event();
+  }
+}
+
+static void race_lap(SimRace &race, uint32_t now) {
+  UiSnapshot &s = race.snapshot;
+  const uint32_t lapMs = now - race.lapStartMs;
+  s.deltaMs = s.bestLapMs ? (int32_t)lapMs - (int32_t)s.bestLapMs : 0;
+  if (s.bestLapMs == 0 || lapMs < s.bestLapMs) s.bestLapMs = lapMs;
+  s.lastLapMs = lapMs;
+  s.lapCount++;
+  race.lapStartMs = now;
+  race.dirty = true;
+  race.lapEvent = true;
+}
+
+void sim_race_init(SimRace &race, uint8_t laps) {
+  race = SimRace{};
+  UiSnapshot &s = race.snapshot;
+  s.state = UI_IDLE;
+  s.selectedDriver = 1;
+  s.selectedLaps = laps;
+  for (uint8_t i = 0; i < kSimDrivers; ++i) {
+    s.driverRunValid[i] = (i % 3) == 1;
+    s.driverTotalMs[i] = s.driverRunValid[i] ? 61000 + 1370 * i : 0;
+    s.driverBestLapMs[i] = s.driverRunValid[i] ? 19800 + 410 * i : 0;
+    s.driverBestReactionMs[i] = s.driverRunValid[i] ? 210 + 7 * i : 0;
+  }
+  s_race = &race;
+}
+
+void sim_race_hold(SimRace &race, uint32_t ms) {
+  race.dirty = true;
+  sim_step_ms(ms);
+}
+
+void sim_race_run(SimRace &race, const uint32_t *lapMs, uint8_t lapCount) {
+  UiSnapshot &s = race.snapshot;
+  s.state = UI_RUNNING;
+  s.lapCount = 0;
+  race.startMs = s_nowMs;
+  race.lapStartMs = s_nowMs;
+  race.dirty = true;
+
+  uint32_t totalMs = 0;
+  for (uint8_t i = 0; i < s.selectedLaps; ++i) totalMs += lapMs[i % lapCount];
+  uint32_t nextLapMs = s_nowMs + lapMs[0];
+  sim_step_ms(totalMs + kSimTickMs, [&](uint32_t now) {
+    if (now >= nextLapMs && s.lapCount < s.selectedLaps) {
+      race_lap(race, now);
+      nextLapMs = now + lapMs[s.lapCount % lapCount];
+    }
+  });
+
+  s.state = UI_FINISHED;
+  s.driverRunValid[0] = true;
+  s.driverTotalMs[0] = s.sessionMs;
+  s.driverBestLapMs[0] = s.bestLapMs;
+  race.dirty = true;
+  race_push(race, s_nowMs);
+}
+
+// ---------------------------------------------------------------------------------------
+// Reaction lights.
+
+void sim_reaction_sequence(uint32_t reactionMs, uint32_t holdMs) {
+  ReactionUiSnapshot r{};
+  r.state = REACTION_IDLE;
+  r.bestReactionMs = reactionMs + 13;
+  screen_reaction_update(r);
+
+  uint32_t lastUiMs = s_nowMs;
+  auto push = [&](uint32_t now, bool force) {
+    if (!force && now - lastUiMs < ui_refresh_snapshot_ms()) return;
+    lastUiMs = now;
+    s_reactionState = r.state;
+    screen_reaction_update(r);
+  };
+
+  r.state = REACTION_ARMED;
+  uint32_t phaseStart = s_nowMs;
+  sim_step_ms(kReactionArmedMs, [&](uint32_t now) {
+    const uint32_t elapsed = now - phaseStart;
+    r.armedCountdownSec = (uint8_t)((kReactionArmedMs - elapsed + 999) / 1000);
+    push(now, false);
+  });
+  r.armedCountdownSec = 0;
+
+  r.state = REACTION_COUNTDOWN;
+  phaseStart = s_nowMs;
+  sim_step_ms(5 * kReactionAmberMs, [&](uint32_t now) {
+    const uint8_t ambers = (uint8_t)((now - phaseStart) / kReactionAmberMs + 1);
+    const bool changed = ambers != r.amberCount;
+    r.amberCount = ambers;
+    push(now, changed);
+  });
+
+  r.state = REACTION_READY_RANDOM;
+  push(s_nowMs, true);
+  sim_step_ms(kReactionHoldMs);
+
+  r.state = REACTION_WAIT_FOR_MOVE;
+  r.greenOn = true;
+  phaseStart = s_nowMs;
+  sim_step_ms(reactionMs, [&](uint32_t now) {
+    r.reactionMs = now - phaseStart;
+    push(now, false);
+  });
+  r.reactionCaptured = true;
+  r.reactionMs = reactionMs;
+  if (reactionMs < r.bestReactionMs) r.bestReactionMs = reactionMs;
+  push(s_nowMs, true);
+  // UpdateReaction() returns to REACTION_IDLE once the move is captured.
+  s_reactionState = REACTION_IDLE;
+  sim_step_ms(holdMs);
+}
+
+// ---------------------------------------------------------------------------------------
+// G-force input.
+
+void sim_gforce_still(uint32_t ms) {
+  sim_imu_set_accel(0.0f, 0.0f, kGravityMs2);
+  sim_step_ms(ms);
+}
+
+void sim_gforce_sweep(float latPeakG, float longG, float hz, uint32_t ms) {
+  const uint32_t start = s_nowMs;
+  sim_step_ms(ms, [&](uint32_t now) {
+    const float t = (now - start) / 1000.0f;
+    const float lat = latPeakG * kGravityMs2 * sinf(2.0f * kPi * hz * t);
+    sim_imu_set_accel(lat, longG * kGravityMs2, kGravityMs2);
+  });
+}
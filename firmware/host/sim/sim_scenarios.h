@@ -0,0 +1,51 @@
+#ifndef SIM_SCENARIOS_H
+#define SIM_SCENARIOS_H
+
+#include <stdint.h>
+
+#include <functional>
+
+#include "lv_time_attack_ui.h"
+
+// Scripted inputs for the host UI builds (sim_ui, bench_ui). Snapshots are filled the way
+// pilaptimer.ino fills them and pushed at the cadence the refresh governor (ui_refresh.h)
+// asks for; the clock only moves in sim_step_ms(), one LVGL tick and timer pass at a time.
+
+static const uint32_t kSimTickMs = 10;  // LV_DISP_DEF_REFR_PERIOD
+static const uint8_t kSimDrivers = 10;  // MAX_DRIVERS in pilaptimer.ino
+
+uint32_t sim_now_ms();
+// Runs ms of simulated time. step (if any) is called before each refresh with the
+// current time, the way loop() runs the state machine before lv_timer_handler(); the
+// governor is updated after the snapshots, as in loop().
+void sim_step_ms(uint32_t ms, const std::function<void(uint32_t)> &step = nullptr);
+
+struct SimRace {
+  UiSnapshot snapshot{};
+  uint32_t startMs = 0;
+  uint32_t lapStartMs = 0;
+  uint32_t lastUiMs = 0;
+  bool dirty = true;
+  bool lapEvent = false;  // A lap completed; its push marks a lap-to-flush sample.
+};
+
+// Idle session for driver 1 with a partly filled leaderboard. The race stays attached:
+// like loop(), every later sim_step_ms() pushes its snapshot every
+// ui_refresh_snapshot_ms(), on whichever tile is showing.
+void sim_race_init(SimRace &race, uint8_t laps);
+// Keeps pushing snapshots in the current state for ms.
+void sim_race_hold(SimRace &race, uint32_t ms);
+// Starts a run and completes race.snapshot.selectedLaps laps, lap i taking
+// lapMs[i % lapCount]; ends in UI_FINISHED with driver 1's result on the leaderboard.
+void sim_race_run(SimRace &race, const uint32_t *lapMs, uint8_t lapCount);
+
+// Reaction tile from REACTION_IDLE through the armed countdown, five ambers, the random
+// hold and lights out to a captured reactionMs, then holds the result for holdMs.
+void sim_reaction_sequence(uint32_t reactionMs, uint32_t holdMs);
+
+// G-force tile input: level and still for ms (gravity calibration).
+void sim_gforce_still(uint32_t ms);
+// Lateral sine of latPeakG at hz with a constant longitudinal longG, for ms.
+void sim_gforce_sweep(float latPeakG, float longG, float hz, uint32_t ms);
+
+#endif
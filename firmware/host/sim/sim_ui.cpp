@@ -0,0 +1,259 @@
+// Host simulator for the PiLapTimer LVGL UI.
+//
+// Builds lv_time_attack_ui.cpp, screen_gforce.cpp and screen_reaction.cpp against a
+// headless display (sim_display.cpp), then plays a scripted session: idle, a timed run,
+// the leaderboard, the reaction lights, the G-force tile fed by a simulated IMU and back
+// to the race tile, which tears down the far tiles and rebuilds them on the way. UI
+// snapshots are built the way pilaptimer.ino builds them and pushed at the firmware's
+// cadence. For each phase it prints how much LVGL rendered and how long that took on the
+// host, then for each refresh mode (ui_refresh.h) the phase spent time in, the frame rate
+// it delivered and the share of simulated time the host spent in the UI, what the
+// region-priority filter held back, the solid fills the DMA fill hook took and, for laps,
+// the refresh that showed the new delta; at the end how often each tile was built and
+// torn down, the LVGL heap its last build took and the heap high-water mark while it was
+// visible.
+//
+//   sim_ui [--areas] [--panel-scroll] [--ppm DIR]
+//     --areas         also print every flushed area
+//     --panel-scroll  draw tile transitions by panel scrolling (ui_panel_scroll.h) and
+//                     print the bands drawn instead of full frames
+//     --ppm DIR       write the framebuffer at the end of each phase to DIR/<phase>.ppm
+//
+// Exits non-zero when a phase renders nothing, flushes an area outside the screen, runs
+// the G-force timer while another tile is showing or asks a font for a glyph it lacks,
+// and with --panel-scroll when a band refresh does not shift the rest of the picture
+// exactly or the panel shows anything a full render would not outside the areas
+// invalidated during a scroll.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "lv_time_attack_ui.h"
+#include "screen_nav.h"
+#include "sim_display.h"
+#include "sim_scenarios.h"
+#include "ui_bind.h"
+#include "ui_panel_scroll.h"
+#include "ui_priority_area.h"
+#include "ui_refresh.h"
+#include "ui_tile_activity.h"
+
+static bool s_printAreas = false;
+static bool s_panelScroll = false;
+static const char *s_ppmDir = nullptr;
+static int s_failures = 0;
+static UiTileActivity s_tileTotals[kUiTileCount];
+// Stays attached after run_race(): the later phases keep pushing its snapshot.
+static SimRace s_race;
+
+static void noop() {}
+
+static void report_phase(const char *phase) {
+  SimDisplayStats stats;
+  sim_display_take_stats(stats);
+  UiBindStats bind;
+  ui_bind_take_stats(bind);
+  UiTileActivity tiles[kUiTileCount];
+  ui_tile_activity_take(tiles);
+  uint32_t imuReads = 0;
+  for (uint8_t t = 0; t < kUiTileCount; ++t) {
+    imuReads += tiles[t].runs[UI_TILE_SUBSYSTEM_IMU_READ];
+    UiTileActivity &total = s_tileTotals[t];
+    total.builds += tiles[t].builds;
+    total.teardowns += tiles[t].teardowns;
+    if (tiles[t].builds) total.buildBytes = tiles[t].buildBytes;
+    if (tiles[t].heapPeak > total.heapPeak) total.heapPeak = tiles[t].heapPeak;
+  }
+
+  const uint32_t avgUs = stats.frames ? (uint32_t)(stats.renderNs / 1000 / stats.frames) : 0;
+  printf("SIM phase=%s refreshes=%u frames=%u flushes=%u px=%u render_us=%u avg_us=%u "
+         "max_us=%u flush_us=%u bind_applied=%u bind_skipped=%u imu_reads=%u\n",
+         phase, (unsigned)stats.refreshes, (unsigned)stats.frames, (unsigned)stats.flushes,
+         (unsigned)stats.pixels, (unsigned)(stats.renderNs / 1000), (unsigned)avgUs,
+         (unsigned)(stats.renderNsMax / 1000), (unsigned)(stats.flushNs / 1000),
+         (unsigned)bind.applied, (unsigned)bind.skipped, (unsigned)imuReads);
+
+  if (stats.fills) {
+    printf("SIM phase=%s fills=%u fill_px=%u fill_word_px=%u\n", phase, (unsigned)stats.fills,
+           (unsigned)stats.fillPixels, (unsigned)stats.fillByWords);
+  }
+
+  if (!stats.events.empty()) {
+    uint32_t latencyMax = 0;
+    uint64_t pixels = 0;
+    uint64_t renderNs = 0;
+    for (const SimEventFrame &e : stats.events) {
+      if (e.latencyMs > latencyMax) latencyMax = e.latencyMs;
+      pixels += e.pixels;
+      renderNs += e.renderNs;
+    }
+    const size_t n = stats.events.size();
+    printf("SIM phase=%s laps=%zu lap_to_flush_max_ms=%u lap_frame_px_avg=%u "
+           "lap_frame_us_avg=%u\n",
+           phase, n, (unsigned)latencyMax, (unsigned)(pixels / n),
+           (unsigned)(renderNs / 1000 / n));
+  }
+  UiPriorityAreaStats priority;
+  ui_priority_area_take_stats(priority);
+  if (priority.priorityFrames || priority.backgroundFrames) {
+    printf("SIM phase=%s priority_frames=%u background_frames=%u held_areas=%u held_px=%u\n",
+           phase, (unsigned)priority.priorityFrames, (unsigned)priority.backgroundFrames,
+           (unsigned)priority.heldAreas, (unsigned)priority.heldPixels);
+  }
+
+  UiPanelScrollStats panelScroll;
+  ui_panel_scroll_take_stats(panelScroll);
+  if (panelScroll.bandFrames) {
+    printf("SIM phase=%s panel_scroll transitions=%u band_frames=%u band_px=%u full_px=%u "
+           "saved_kb=%u stale_px=%u\n",
+           phase, (unsigned)panelScroll.transitions, (unsigned)panelScroll.bandFrames,
+           (unsigned)panelScroll.bandPixels, (unsigned)panelScroll.fullPixels,
+           (unsigned)((panelScroll.fullPixels - panelScroll.bandPixels) * 2 / 1024),
+           (unsigned)stats.panelStalePixels);
+  }
+
+  UiRefreshModeStats refresh[UI_REFRESH_MODE_COUNT];
+  ui_refresh_take_stats(refresh);
+  for (uint8_t m = 0; m < UI_REFRESH_MODE_COUNT; ++m) {
+    if (refresh[m].ms == 0) continue;
+    printf("SIM phase=%s refresh=%s ms=%u frames=%u fps=%.1f busy_pct=%.2f\n", phase,
+           ui_refresh_mode_name(m), (unsigned)refresh[m].ms, (unsigned)refresh[m].frames,
+           refresh[m].frames * 1000.0 / refresh[m].ms, refresh[m].busyUs / 10.0 / refresh[m].ms);
+  }
+
+  if (stats.panelMismatchPixels) {
+    printf("FAIL phase=%s panel shows %u wrong pixels\n", phase,
+           (unsigned)stats.panelMismatchPixels);
+    s_failures++;
+  }
+  if (stats.frames == 0) {
+    printf("FAIL phase=%s rendered nothing\n", phase);
+    s_failures++;
+  }
+  for (uint8_t t = 0; t < kUiTileCount; ++t) {
+    if (t != LV_TIME_ATTACK_TILE_GFORCE && tiles[t].runs[UI_TILE_SUBSYSTEM_GFORCE_TICK]) {
+      printf("FAIL phase=%s G-force timer ran %u times on tile %s\n", phase,
+             (unsigned)tiles[t].runs[UI_TILE_SUBSYSTEM_GFORCE_TICK],
+             ui_tile_activity_tile_name(t));
+      s_failures++;
+    }
+  }
+  for (const SimGlyphMiss &m : stats.glyphMisses) {
+    printf("FAIL phase=%s no glyph U+%04X in the font with line height %d\n", phase, (unsigned)m.letter,
+           (int)m.font->line_height);
+    s_failures++;
+  }
+  for (const SimFlushArea &a : stats.areas) {
+    if (s_printAreas) {
+      printf("  area refresh=%u x=%d..%d y=%d..%d\n", (unsigned)a.refresh, a.x1, a.x2, a.y1,
+             a.y2);
+    }
+    if (a.x1 < 0 || a.y1 < 0 || a.x2 >= LVGL_LOGICAL_W || a.y2 >= LVGL_LOGICAL_H ||
+        a.x1 > a.x2 || a.y1 > a.y2) {
+      printf("FAIL phase=%s area x=%d..%d y=%d..%d off screen\n", phase, a.x1, a.x2, a.y1,
+             a.y2);
+      s_failures++;
+    }
+  }
+
+  if (s_ppmDir) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.ppm", s_ppmDir, phase);
+    if (!sim_display_write_ppm(path)) {
+      printf("FAIL cannot write %s\n", path);
+      s_failures++;
+    }
+  }
+}
+
+static void run_race() {
+  static const uint32_t kLapMs[] = {6430, 6210, 6580};
+  SimRace &race = s_race;
+  sim_race_init(race, 3);
+  ShowMainScreen();
+  sim_race_hold(race, 2000);
+  report_phase("idle");
+
+  sim_race_run(race, kLapMs, 3);
+  report_phase("running");
+
+  sim_race_hold(race, 2000);
+  report_phase("finished");
+
+  lv_time_attack_ui_show_review_tile();
+  sim_race_hold(race, 1500);
+  report_phase("review");
+}
+
+static void run_reaction() {
+  ShowReactionScreen();
+  sim_step_ms(1000);
+  report_phase("reaction_enter");
+
+  sim_reaction_sequence(218, 2000);
+  report_phase("reaction_run");
+}
+
+static void run_gforce() {
+  ShowGForceScreen();
+  sim_gforce_still(2000);
+  report_phase("gforce_calibrate");
+
+  sim_gforce_sweep(0.8f, -0.4f, 0.5f, 6000);
+  report_phase("gforce_slalom");
+
+  // Far enough to tear the G-force tile down; its peaks must survive the rebuild.
+  ShowMainScreen();
+  sim_step_ms(1000);
+  report_phase("race_return");
+
+  ShowGForceScreen();
+  sim_gforce_still(1000);
+  report_phase("gforce_rebuilt");
+}
+
+int main(int argc, char **argv) {
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--areas") == 0) {
+      s_printAreas = true;
+    } else if (strcmp(argv[i], "--panel-scroll") == 0) {
+      s_panelScroll = true;
+    } else if (strcmp(argv[i], "--ppm") == 0 && i + 1 < argc) {
+      s_ppmDir = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [--areas] [--panel-scroll] [--ppm DIR]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  lv_init();
+  sim_display_init(s_panelScroll);
+  lv_time_attack_ui_init(noop, noop, noop, noop, noop, noop);
+  lv_obj_invalidate(lv_scr_act());
+  sim_step_ms(500);
+  report_phase("boot");
+
+  run_race();
+  run_reaction();
+  run_gforce();
+
+  for (uint8_t t = 0; t < LV_TIME_ATTACK_TILE_UNKNOWN; ++t) {
+    const UiTileActivity &total = s_tileTotals[t];
+    printf("SIM tile=%s builds=%u teardowns=%u build_bytes=%u heap_peak=%u\n",
+           ui_tile_activity_tile_name(t), (unsigned)total.builds, (unsigned)total.teardowns,
+           (unsigned)total.buildBytes, (unsigned)total.heapPeak);
+  }
+
+  lv_mem_monitor_t mem;
+  lv_mem_monitor(&mem);
+  printf("SIM lv_mem total=%u used_pct=%u frag_pct=%u\n",
+         (unsigned)mem.total_size, (unsigned)mem.used_pct, (unsigned)mem.frag_pct);
+
+  if (s_failures) {
+    printf("FAILED %d check(s)\n", s_failures);
+    return 1;
+  }
+  printf("OK\n");
+  return 0;
+}
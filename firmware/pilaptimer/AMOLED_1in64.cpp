@@ -29,7 +29,33 @@
 #include "DEV_Config.h"
 #include "AMOLED_1in64.h"
 
-AMOLED_1IN64_ATTRIBUTES AMOLED_1IN64;
+AMOLED_1IN64_ATTRIBUTES AMOLED_1IN64 = {AMOLED_1IN64_WIDTH, AMOLED_1IN64_HEIGHT, VERTICAL};
+
+/********************************************************************************
+function:	Send the memory access control (MADCTL) value for a scan direction
+parameter:
+		Scan_dir :   VERTICAL (native portrait) or HORIZONTAL (landscape)
+********************************************************************************/
+static void AMOLED_1IN64_WriteMADCTL(UBYTE Scan_dir){
+    QSPI_Select(qspi);
+    QSPI_REGISTER_Write(qspi, 0x36);
+    QSPI_DATA_Write(qspi, Scan_dir == HORIZONTAL ? AMOLED_1IN64_MADCTL_HORIZONTAL
+                                                 : AMOLED_1IN64_MADCTL_VERTICAL);
+    QSPI_Deselect(qspi);
+}
+
+/********************************************************************************
+function:	Update WIDTH/HEIGHT to match the current scan direction
+********************************************************************************/
+static void AMOLED_1IN64_ApplySize(){
+    if(AMOLED_1IN64.SCAN_DIR == HORIZONTAL){
+        AMOLED_1IN64.HEIGHT	= AMOLED_1IN64_WIDTH;
+        AMOLED_1IN64.WIDTH  = AMOLED_1IN64_HEIGHT;
+    }else{
+        AMOLED_1IN64.HEIGHT	= AMOLED_1IN64_HEIGHT;
+        AMOLED_1IN64.WIDTH  = AMOLED_1IN64_WIDTH;
+    }
+}
 
 /********************************************************************************
 function:	Sets the start position and size of the display area
@@ -41,8 +67,15 @@ parameter:
 		Yend    :   Y direction end coordinates
 ********************************************************************************/
 void AMOLED_1IN64_SetWindows(uint32_t Xstart, uint32_t Ystart, uint32_t Xend, uint32_t Yend){
-    Xstart=Xstart+20;
-	  Xend=Xend+20;
+    // The visible 280 columns start at panel column 20. With the row/column exchange
+    // enabled that offset moves to the row address.
+    if(AMOLED_1IN64.SCAN_DIR == HORIZONTAL){
+        Ystart=Ystart+AMOLED_1IN64_COL_OFFSET;
+        Yend=Yend+AMOLED_1IN64_COL_OFFSET;
+    }else{
+        Xstart=Xstart+AMOLED_1IN64_COL_OFFSET;
+        Xend=Xend+AMOLED_1IN64_COL_OFFSET;
+    }
 
     QSPI_Select(qspi); 
     QSPI_REGISTER_Write(qspi, 0x2a); 
@@ -66,6 +99,34 @@ void AMOLED_1IN64_SetWindows(uint32_t Xstart, uint32_t Ystart, uint32_t Xend, ui
     WAIT_TIME();
 }
 
+/********************************************************************************
+function:	Queue the same window commands as AMOLED_1IN64_SetWindows() on a
+            command list, to be sent by DMA together with the pixel data
+parameter:
+        list    ：  command list
+		Xstart 	:   X direction Start coordinates
+		Ystart  :   Y direction Start coordinates
+		Xend    :   X direction end coordinates
+		Yend    :   Y direction end coordinates
+********************************************************************************/
+bool AMOLED_1IN64_QueueWindows(qspi_cmdlist_t *list, uint32_t Xstart, uint32_t Ystart, uint32_t Xend, uint32_t Yend){
+    if(AMOLED_1IN64.SCAN_DIR == HORIZONTAL){
+        Ystart=Ystart+AMOLED_1IN64_COL_OFFSET;
+        Yend=Yend+AMOLED_1IN64_COL_OFFSET;
+    }else{
+        Xstart=Xstart+AMOLED_1IN64_COL_OFFSET;
+        Xend=Xend+AMOLED_1IN64_COL_OFFSET;
+    }
+
+    const uint8_t caset[4] = {(uint8_t)(Xstart>>8), (uint8_t)(Xstart&0xff),
+                              (uint8_t)((Xend-1)>>8), (uint8_t)((Xend-1)&0xff)};
+    const uint8_t raset[4] = {(uint8_t)(Ystart>>8), (uint8_t)(Ystart&0xff),
+                              (uint8_t)((Yend-1)>>8), (uint8_t)((Yend-1)&0xff)};
+    return QSPI_CmdList_Register(list, 0x2a, caset, 4) &&
+           QSPI_CmdList_Register(list, 0x2b, raset, 4) &&
+           QSPI_CmdList_Register(list, 0x2c, nullptr, 0);
+}
+
 /******************************************************************************
 function :	Initialize the lcd register
 parameter:
@@ -88,6 +149,8 @@ static void AMOLED_1IN64_InitReg(){
     QSPI_DATA_Write(qspi, 0x00);
     QSPI_Deselect(qspi);
 
+    AMOLED_1IN64_WriteMADCTL(AMOLED_1IN64.SCAN_DIR);
+
     QSPI_Select(qspi);
     QSPI_REGISTER_Write(qspi, 0x3A);
     QSPI_DATA_Write(qspi, 0x55);  
@@ -147,8 +210,22 @@ void AMOLED_1IN64_Init()
     //Set the initialization register
     AMOLED_1IN64_InitReg();
 
-    AMOLED_1IN64.HEIGHT	= AMOLED_1IN64_HEIGHT;
-    AMOLED_1IN64.WIDTH  = AMOLED_1IN64_WIDTH;
+    AMOLED_1IN64_ApplySize();
+}
+
+/********************************************************************************
+function :	Switch the panel scan direction at runtime
+parameter:
+		Scan_dir :   VERTICAL (native portrait 280x456) or HORIZONTAL (landscape 456x280)
+Info:
+        Subsequent SetWindows()/Display() calls use the new orientation.
+********************************************************************************/
+void AMOLED_1IN64_SetAttributes(UBYTE Scan_dir)
+{
+    AMOLED_1IN64.SCAN_DIR = Scan_dir;
+    AMOLED_1IN64_ApplySize();
+
+    AMOLED_1IN64_WriteMADCTL(Scan_dir);
 }
 
 /******************************************************************************
@@ -159,47 +236,80 @@ void AMOLED_1IN64_SetBrightness(uint8_t brightness){
     if(brightness > 100) brightness = 100;
     brightness = brightness * 255 / 100;
 
-    QSPI_1Wrie_Mode(&qspi);
     QSPI_Select(qspi); 
     QSPI_REGISTER_Write(qspi, 0x51);
     QSPI_DATA_Write(qspi, brightness);
     QSPI_Deselect(qspi);
 }
 
+/******************************************************************************
+function :	Define the vertical scroll area (VSCRDEF) and reset the scroll start
+parameter:
+        Top     ：  fixed rows above the scroll area
+        Height  ：  scrolling rows
+        Bottom  ：  fixed rows below it; Top + Height + Bottom = 456
+******************************************************************************/
+void AMOLED_1IN64_SetScrollArea(uint32_t Top, uint32_t Height, uint32_t Bottom){
+    QSPI_Select(qspi);
+    QSPI_REGISTER_Write(qspi, 0x33);
+    QSPI_DATA_Write(qspi, Top>>8);
+    QSPI_DATA_Write(qspi, Top&0xff);
+    QSPI_DATA_Write(qspi, Height>>8);
+    QSPI_DATA_Write(qspi, Height&0xff);
+    QSPI_DATA_Write(qspi, Bottom>>8);
+    QSPI_DATA_Write(qspi, Bottom&0xff);
+    QSPI_Deselect(qspi);
+
+    QSPI_Select(qspi);
+    QSPI_REGISTER_Write(qspi, 0x37);
+    QSPI_DATA_Write(qspi, Top>>8);
+    QSPI_DATA_Write(qspi, Top&0xff);
+    QSPI_Deselect(qspi);
+}
+
+/******************************************************************************
+function :	Queue a vertical scroll start address (VSCSAD): the memory row shown on
+            the first row of the scroll area
+parameter:
+        list    ：  command list the window and pixels follow in
+        Line    ：  memory row, within the scroll area
+******************************************************************************/
+bool AMOLED_1IN64_QueueScrollStart(qspi_cmdlist_t *list, uint32_t Line){
+    const uint8_t vscsad[2] = {(uint8_t)(Line>>8), (uint8_t)(Line&0xff)};
+    return QSPI_CmdList_Register(list, 0x37, vscsad, 2);
+}
+
 
 /******************************************************************************
 function :	Clear screen
 parameter:
 ******************************************************************************/
 void AMOLED_1IN64_Clear(UWORD Color) {
-    // Color data
-    UWORD i;
-	UWORD image[AMOLED_1IN64.HEIGHT];
-	for(i=0;i<AMOLED_1IN64.HEIGHT;i++){
-		image[i] = Color>>8 | (Color&0xff)<<8;
-	}
-	UBYTE *partial_image = (UBYTE *)(image);
+    // Color data: two pixels in one word, read from a fixed address for the whole
+    // screen (the panel has an even number of pixels, so it is a whole number of words)
+    static uint32_t fill;
+    UWORD *pair = (UWORD *)&fill;
+    pair[0] = pair[1] = Color>>8 | (Color&0xff)<<8;
 
     // Send command in one-line mode
-    QSPI_1Wrie_Mode(&qspi);
     AMOLED_1IN64_SetWindows(0,0,AMOLED_1IN64.WIDTH,AMOLED_1IN64.HEIGHT);
     QSPI_Select(qspi);
     QSPI_Pixel_Write(qspi,0x2c);
 
-    // Four-wire mode sends RGB data
-    QSPI_4Wrie_Mode(&qspi);
-    channel_config_set_dreq(&c, pio_get_dreq(qspi.pio, qspi.sm, true));
-    for (int i = 0; i < AMOLED_1IN64.HEIGHT; i++) {
-        dma_channel_configure(dma_tx, 
-                            &c,
-                            &qspi.pio->txf[qspi.sm],  // Destination pointer (PIO TX FIFO)
-                            partial_image,            // Source pointer (data buffer)
-                            AMOLED_1IN64.WIDTH*2,      // Data length (unit: number of transmissions)
-                            true);                    // Start transferring immediately
-        
-        // Waiting for DMA transfer to complete
-        while(dma_channel_is_busy(dma_tx));
-    }
+    // Four-wire mode sends RGB data: one phase header, then a single DMA transfer
+    QSPI_Phase_Begin(qspi, QSPI_TXN_4WIRE, AMOLED_1IN64.WIDTH*AMOLED_1IN64.HEIGHT*2);
+    dma_channel_config cfg = c;
+    channel_config_set_dreq(&cfg, pio_get_dreq(qspi.pio, qspi.sm, true));
+    channel_config_set_read_increment(&cfg, false);
+    dma_channel_configure(dma_tx, 
+                          &cfg,
+                          &qspi.pio->txf[qspi.sm],                        // Destination pointer (PIO TX FIFO)
+                          &fill,                                          // Source pointer (fixed)
+                          AMOLED_1IN64.WIDTH*AMOLED_1IN64.HEIGHT/2,       // Data length (unit: 32-bit words)
+                          true);                                          // Start transferring immediately
+
+    // Waiting for DMA transfer to complete
+    while(dma_channel_is_busy(dma_tx));
 
     QSPI_Deselect(qspi);
 }
@@ -213,23 +323,12 @@ parameter:
 void AMOLED_1IN64_Display(UWORD *Image)
 {
     // Send command in one-line mode
-    QSPI_1Wrie_Mode(&qspi);
     AMOLED_1IN64_SetWindows(0,0,AMOLED_1IN64.WIDTH,AMOLED_1IN64.HEIGHT);
     QSPI_Select(qspi);
     QSPI_Pixel_Write(qspi,0x2c);
 
     // Four-wire mode sends RGB data
-    QSPI_4Wrie_Mode(&qspi);
-    channel_config_set_dreq(&c, pio_get_dreq(qspi.pio, qspi.sm, true));
-    dma_channel_configure(dma_tx, 
-                        &c,
-                        &qspi.pio->txf[qspi.sm],  // Destination pointer (PIO TX FIFO)
-                        (UBYTE *)Image,           // Source pointer (data buffer)
-                        AMOLED_1IN64.WIDTH*AMOLED_1IN64.HEIGHT*2,   // Data length (unit: number of transmissions)
-                        true);                    // Start transferring immediately
-    
-    // Waiting for DMA transfer to complete
-    while(dma_channel_is_busy(dma_tx));
+    QSPI_Pixel_Stream(qspi, Image, AMOLED_1IN64.WIDTH*AMOLED_1IN64.HEIGHT*2);
     QSPI_Deselect(qspi);             
 }
 
@@ -244,30 +343,18 @@ parameter:
 ******************************************************************************/
 void AMOLED_1IN64_DisplayWindows(uint32_t Xstart, uint32_t Ystart, uint32_t Xend, uint32_t Yend, UWORD *Image) {
     // Send command in one-line mode
-    QSPI_1Wrie_Mode(&qspi);
     AMOLED_1IN64_SetWindows(Xstart, Ystart, Xend, Yend);
     QSPI_Select(qspi);
     QSPI_Pixel_Write(qspi, 0x2c);
 
-    // Four-wire mode sends RGB data
-    QSPI_4Wrie_Mode(&qspi);
-    channel_config_set_dreq(&c, pio_get_dreq(qspi.pio, qspi.sm, true));
-
+    // Four-wire mode sends RGB data, one stream per row (rows may start mid-word)
     int i;
     uint32_t pixel_offset;
     UBYTE *partial_image;
     for (i = Ystart; i < Yend; i++) {
         pixel_offset = (i * AMOLED_1IN64.WIDTH + Xstart) * 2;
         partial_image = (UBYTE *)Image + pixel_offset;
-        dma_channel_configure(dma_tx, 
-                            &c,
-                            &qspi.pio->txf[qspi.sm],  // Destination pointer (PIO TX FIFO)
-                            partial_image,            // Source pointer (data buffer)
-                            (Xend-Xstart)*2,          // Data length (unit: number of transmissions)
-                            true);                    // Start transferring immediately
-
-        // Waiting for DMA transfer to complete
-        while(dma_channel_is_busy(dma_tx));
+        QSPI_Pixel_Stream(qspi, partial_image, (Xend-Xstart)*2);
     }
 
     QSPI_Deselect(qspi);
@@ -34,9 +34,17 @@
 #define AMOLED_1IN64_WIDTH 280
 #define AMOLED_1IN64_HEIGHT 456
 
+#define AMOLED_1IN64_COL_OFFSET 20
+
 #define HORIZONTAL 0
 #define VERTICAL   1
 
+// MADCTL (0x36): MY=0x80, MX=0x40, MV=0x20.
+// HORIZONTAL exchanges rows/columns and mirrors the row order so that landscape
+// (x, y) lands on portrait (y, 455 - x), matching the LVGL port's software rotation.
+#define AMOLED_1IN64_MADCTL_VERTICAL   0x00
+#define AMOLED_1IN64_MADCTL_HORIZONTAL 0xA0
+
 #define WHITE         0xFFFF
 #define BLACK		  0x0000
 #define BLUE 		  0x001F
@@ -67,8 +75,12 @@ typedef struct{
 extern AMOLED_1IN64_ATTRIBUTES AMOLED_1IN64;
 
 void AMOLED_1IN64_Init();
+void AMOLED_1IN64_SetAttributes(UBYTE Scan_dir);
 void AMOLED_1IN64_SetBrightness(uint8_t brightness);
+void AMOLED_1IN64_SetScrollArea(uint32_t Top, uint32_t Height, uint32_t Bottom);
+bool AMOLED_1IN64_QueueScrollStart(qspi_cmdlist_t *list, uint32_t Line);
 void AMOLED_1IN64_SetWindows(uint32_t Xstart, uint32_t Ystart, uint32_t Xend, uint32_t Yend);
+bool AMOLED_1IN64_QueueWindows(qspi_cmdlist_t *list, uint32_t Xstart, uint32_t Ystart, uint32_t Xend, uint32_t Yend);
 void AMOLED_1IN64_Display(UWORD *Image);
 void AMOLED_1IN64_DisplayWindows(uint32_t Xstart, uint32_t Ystart, uint32_t Xend, uint32_t Yend, UWORD *Image);
 void AMOLED_1IN64_Clear(UWORD Color);
@@ -188,7 +188,9 @@ UBYTE DEV_Module_Init(void)
     //DMA
     dma_tx = dma_claim_unused_channel(true);
     c = dma_channel_get_default_config(dma_tx);
-    channel_config_set_transfer_data_size(&c, DMA_SIZE_8); 
+    // 32-bit beats into qspi_txn's autopull; bswap keeps memory byte order on the bus
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_bswap(&c, true);
     channel_config_set_read_increment(&c, true); 
     channel_config_set_write_increment(&c, false); 
     channel_config_set_dreq(&c, pio_get_dreq(qspi.pio, qspi.sm, false));
@@ -0,0 +1,34 @@
+#include "dma_fill.h"
+
+#include "hardware/dma.h"
+#include "rgb565_fill.h"
+
+namespace {
+int channel = -1;
+volatile uint32_t source;  // The fixed read address.
+
+void fill_words(uint32_t *dst, uint32_t word, uint32_t count) {
+  // The previous run still reads source.
+  dma_channel_wait_for_finish_blocking((uint)channel);
+  source = word;
+  dma_channel_set_write_addr((uint)channel, dst, false);
+  dma_channel_set_trans_count((uint)channel, count, true);
+}
+}  // namespace
+
+void dma_fill_init() {
+  if (channel >= 0) return;
+  channel = dma_claim_unused_channel(true);
+  dma_channel_config cfg = dma_channel_get_default_config((uint)channel);
+  channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+  channel_config_set_read_increment(&cfg, false);
+  channel_config_set_write_increment(&cfg, true);
+  channel_config_set_dreq(&cfg, DREQ_FORCE);
+  dma_channel_configure((uint)channel, &cfg, nullptr, &source, 0, false);
+}
+
+uint32_t dma_fill_rect(uint16_t *dst, int32_t stride, int32_t w, int32_t h, uint16_t color) {
+  const uint32_t filled = rgb565_fill_rect(dst, stride, w, h, color, fill_words);
+  dma_channel_wait_for_finish_blocking((uint)channel);
+  return filled;
+}
@@ -0,0 +1,17 @@
+#ifndef DMA_FILL_H
+#define DMA_FILL_H
+
+#include <stdint.h>
+
+// Solid fills in RAM by DMA: a channel of its own reads one 32-bit source word (two
+// RGB565 pixels) from a fixed address and writes it with an incrementing address, unpaced.
+// Row splitting and the unaligned edges are rgb565_fill_rect()'s; while the channel fills
+// one row the CPU already stores the next row's edge pixels.
+
+// Claims the channel; later calls do nothing. Call before dma_fill_rect().
+void dma_fill_init();
+// rgb565_fill_rect() with the word runs done by DMA. Returns once every pixel is written;
+// the result is the pixels the DMA wrote.
+uint32_t dma_fill_rect(uint16_t *dst, int32_t stride, int32_t w, int32_t h, uint16_t color);
+
+#endif
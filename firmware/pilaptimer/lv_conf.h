@@ -2,7 +2,7 @@
 #define LV_CONF_H
 
 #define LV_COLOR_DEPTH 16
-#define LV_COLOR_16_SWAP 1
+#define LV_COLOR_16_SWAP 0  // qspi_txn RGB565 mode sends native pixels high byte first
 #define LV_COLOR_SCREEN_TRANSP 0
 #define LV_DISP_DEF_REFR_PERIOD 10
 #define LV_MEM_SIZE (64U * 1024U)
@@ -17,17 +17,22 @@
 
 #define LV_USE_DRAW_SW 1
 #define LV_DRAW_SW_COMPLEX 1
+// Keeps the last blurred shadow corner (shadow_width + radius <= 32, 1 KB). The race
+// tile's start and reset buttons share one shadow so redrawing both hits the cache.
+#define LV_SHADOW_CACHE_SIZE 32
 #define LV_USE_ANIMATION 1
 #define LV_USE_FLEX 1
 #define LV_USE_GRID 1
 #define LV_USE_GESTURE 1
 #define LV_USE_LINE 1
 
-#define LV_FONT_MONTSERRAT_20 1
-#define LV_FONT_MONTSERRAT_24 1
-#define LV_FONT_MONTSERRAT_32 1
-#define LV_FONT_MONTSERRAT_48 1
-#define LV_FONT_DEFAULT &lv_font_montserrat_24
+// The UI uses glyph subsets of Montserrat 20/24/32/48 (ui_font_montserrat_*.c) instead of
+// LVGL's full fonts. They are generated by firmware/host/font_subset from the strings in
+// the UI sources; the host build fails when a string needs a glyph they do not have.
+#define LV_FONT_CUSTOM_DECLARE                                                  \
+  LV_FONT_DECLARE(ui_font_montserrat_20) LV_FONT_DECLARE(ui_font_montserrat_24) \
+  LV_FONT_DECLARE(ui_font_montserrat_32) LV_FONT_DECLARE(ui_font_montserrat_48)
+#define LV_FONT_DEFAULT &ui_font_montserrat_24
 
 #define LV_USE_THEME_DEFAULT 1
 
@@ -2,20 +2,303 @@
 
 #include "DEV_Config.h"
 #include "AMOLED_1in64.h"
+#include "dma_fill.h"
 #include "qspi_pio.h"
+#include "rgb565_blend.h"
+#include "rgb565_rotate.h"
+#include "ui_panel_scroll.h"
+#include "ui_priority_area.h"
+#include "ui_refresh.h"
+
+
+// 1: flushes are queued and streamed from the DMA completion IRQ. With hardware rotation
+//    LVGL gets two draw buffers and renders into one while the other streams; with
+//    software rotation the area is released once rotated into s_tmp565 and one draw
+//    buffer is enough, the overlap comes from the staging queue.
+// 0: single draw buffer, flush callback busy-waits on every area (legacy path).
+#ifndef LV_PORT_DISP_DOUBLE_BUFFER
+#define LV_PORT_DISP_DOUBLE_BUFFER 1
+#endif
+
+// 1: panel scans landscape (MADCTL row/column exchange) and LVGL's packed buffer is
+//    DMA'd as-is. 0: panel stays portrait and every flush is rotated in software.
+#ifndef LV_PORT_DISP_HW_ROTATION
+#define LV_PORT_DISP_HW_ROTATION 0
+#endif
+
+// 1: tile transitions move the panel's vertical scroll start (VSCSAD) and only the band
+//    a scroll step uncovers is rendered and sent (ui_panel_scroll.h). Logical columns are
+//    panel rows, so a horizontal swipe is a vertical scroll of the portrait panel.
+//    Needs software rotation: the offset is applied when mapping columns to panel rows.
+#ifndef LV_PORT_DISP_HW_SCROLL
+#define LV_PORT_DISP_HW_SCROLL 0
+#endif
+
+// 1: opaque, unmasked solid fills (screen and widget backgrounds, the straight parts of
+//    rounded rectangles) are written into the draw buffer by DMA (dma_fill.h) instead of
+//    LVGL's software blend. 0: LVGL draws everything.
+#ifndef LV_PORT_DISP_DMA_FILL
+#define LV_PORT_DISP_DMA_FILL 1
+#endif
+
+// 1: masked fills (text, rounded corners, arcs) and translucent or masked images (the
+//    glow sprites) are blended by rgb565_blend.h, two pixels per word and four mask bytes
+//    per load, instead of LVGL's per-pixel loops. Not measured on the target yet: check
+//    the BLEND lines of DISP_RENDER_BENCH (cycles and same=) before switching it on.
+//    0: LVGL blends them.
+#ifndef LV_PORT_DISP_SIMD_BLEND
+#define LV_PORT_DISP_SIMD_BLEND 0
+#endif
+
+#define LV_PORT_DISP_BLEND_HOOK (LV_PORT_DISP_DMA_FILL || LV_PORT_DISP_SIMD_BLEND)
+
+#if LV_PORT_DISP_SIMD_BLEND && LV_COLOR_16_SWAP
+#error "LV_PORT_DISP_SIMD_BLEND mixes native RGB565 pixels; it needs LV_COLOR_16_SWAP 0"
+#endif
+#if LV_PORT_DISP_HW_SCROLL && LV_PORT_DISP_HW_ROTATION
+#error "LV_PORT_DISP_HW_SCROLL needs LV_PORT_DISP_HW_ROTATION 0"
+#endif
 
 static lv_disp_draw_buf_t s_draw_buf;
 
 static constexpr uint32_t kBufLines = 80;
-static constexpr uint32_t kPostFlushDelayMs = 1;
-static constexpr bool kSwapBytesInFlush = false;
 
 static_assert(sizeof(lv_color_t) == 2, "LVGL must be configured for RGB565");
 
-static lv_color_t s_buf1[LVGL_LOGICAL_W * kBufLines];
-static uint16_t s_tmp565[LVGL_LOGICAL_W * kBufLines];
+// Word aligned in both colour modes. With LV_COLOR_16_SWAP 1 the payload goes out by
+// 32-bit DMA (QSPI_CmdList_Pixels()), which rejects anything else. The default native
+// path (QSPI_CmdList_Pixels565()) only needs halfwords, but rows are an even number of
+// pixels, so word-aligned buffers keep the pixel-pair accesses of the rotation, the DMA
+// fill runs and the staging slices in s_tmp565 aligned from the first pixel of each row.
+alignas(4) static lv_color_t s_buf1[LVGL_LOGICAL_W * kBufLines];
+#if LV_PORT_DISP_DOUBLE_BUFFER && LV_PORT_DISP_HW_ROTATION
+alignas(4) static lv_color_t s_buf2[LVGL_LOGICAL_W * kBufLines];
+#endif
+#if !LV_PORT_DISP_HW_ROTATION
+alignas(4) static uint16_t s_tmp565[LVGL_LOGICAL_W * kBufLines];
+#endif
+
+static LvPortDispStats s_stats{};
+static uint32_t s_statsStartUs = 0;
+static bool s_dryRun = false;  // Render only; see lv_port_disp_set_dry_run().
+
+// Latency sample from lv_port_disp_mark_event(): armed until the next refresh starts
+// flushing, then closed by that refresh's last area.
+static volatile uint32_t s_eventUs = 0;
+static volatile bool s_eventArmed = false;
 
-static inline uint16_t bswap16(uint16_t v) { return (uint16_t)((v << 8) | (v >> 8)); }
+static void event_on_panel() {
+  const uint32_t us = micros() - s_eventUs;
+  s_stats.events++;
+  s_stats.eventUsTotal += us;
+  if (us > s_stats.eventUsMax) s_stats.eventUsMax = us;
+}
+
+// True when this area is the last one of the refresh that closes the armed sample.
+static bool closes_event(lv_disp_drv_t *disp_drv) {
+  if (!s_eventArmed || !lv_disp_flush_is_last(disp_drv)) return false;
+  s_eventArmed = false;
+  return true;
+}
+
+#if !LV_PORT_DISP_HW_ROTATION
+// Rotates a packed logical (landscape) LVGL area into dst in physical (portrait)
+// row order. The result is (y2 - y1 + 1) pixels wide and (x2 - x1 + 1) rows tall.
+static void rotate_area(const lv_area_t *area, const lv_color_t *color_p, uint16_t *dst) {
+  const int32_t logical_width = area->x2 - area->x1 + 1;
+  const int32_t logical_height = area->y2 - area->y1 + 1;
+  rgb565_rotate_ccw((const uint16_t *)color_p, logical_width, logical_height, dst);
+}
+#endif
+
+// Window commands and the pixel burst for one area, sent by DMA as a single command
+// list (see qspi_cmdlist.h). Only one area is on the wire at a time.
+static qspi_cmdlist_t s_areaCmds;
+static uint32_t s_areaSubmitUs = 0;
+
+static void area_done_stats() {
+  const uint32_t now = micros();
+  const uint32_t payloadStartUs = QSPI_CmdList_PayloadStartUs();
+  s_stats.areas++;
+  s_stats.cmdUs += payloadStartUs - s_areaSubmitUs;
+  s_stats.dmaUs += now - payloadStartUs;
+}
+
+// Queues window + RAMWR + pixels for a whole area and returns once the first command
+// byte is on its way; the rest runs from the DMA IRQ. The DMA transfer count is 28 bits
+// wide, so even a full draw buffer is one payload segment. A scroll_start >= 0 moves the
+// panel's scroll start first, in the same list.
+static void submit_area(int32_t phys_x_start, int32_t phys_x_end, int32_t phys_y_start,
+                        int32_t phys_height, const uint16_t *pixels, int32_t scroll_start,
+                        qspi_cmdlist_done_t done) {
+  const int32_t phys_width = phys_x_end - phys_x_start + 1;
+
+  // NOTE: DisplayWindows() assumes a full 280x456 framebuffer and will read out of bounds
+  // when given LVGL's packed tile buffers. Use SetWindows() + RAMWR instead.
+  QSPI_CmdList_Init(&s_areaCmds);
+  if (scroll_start >= 0) {
+    AMOLED_1IN64_QueueScrollStart(&s_areaCmds, (uint32_t)scroll_start);
+  }
+  AMOLED_1IN64_QueueWindows(&s_areaCmds,
+                            (uint32_t)phys_x_start,
+                            (uint32_t)phys_y_start,
+                            (uint32_t)phys_x_end + 1,
+                            (uint32_t)(phys_y_start + phys_height));
+#if LV_COLOR_16_SWAP
+  // LVGL already stored the pixels high byte first: stream them as plain bytes.
+  QSPI_CmdList_Pixels(&s_areaCmds, 0x2c, pixels, (uint32_t)(phys_width * phys_height * 2));
+#else
+  // Native RGB565; the PIO sends each pixel high byte first.
+  QSPI_CmdList_Pixels565(&s_areaCmds, 0x2c, pixels, (uint32_t)(phys_width * phys_height));
+#endif
+
+  s_areaSubmitUs = micros();
+  QSPI_CmdList_Submit(&qspi, &s_areaCmds, done, nullptr);
+}
+
+#if LV_PORT_DISP_DOUBLE_BUFFER
+// Areas waiting to go to the panel. With software rotation the pixels live in s_tmp565
+// (LVGL's buffer is already released) and the queue is only committed once LVGL flushes
+// the last area of a refresh, so a frame's dirty areas reach the panel as one burst
+// instead of being interleaved with rendering. Hardware rotation streams LVGL's own
+// buffer, so those areas are committed immediately and released from the IRQ.
+struct QueuedArea {
+  lv_disp_drv_t *releaseDrv;  // Non-null: call lv_disp_flush_ready() once sent.
+  bool closesEvent;           // Ends the lv_port_disp_mark_event() sample once sent.
+  int32_t scrollStart;        // >= 0: panel scroll start to set before the window.
+  const uint16_t *pixels;
+  int32_t physXStart;
+  int32_t physXEnd;
+  int32_t physYStart;
+  int32_t physHeight;
+};
+
+static constexpr uint32_t kMaxQueuedAreas = 16;
+
+static QueuedArea s_queue[kMaxQueuedAreas];
+static volatile uint32_t s_queueCount = 0;      // Written by flush_cb.
+static volatile uint32_t s_queueCommitted = 0;  // Entries the IRQ may send.
+static volatile uint32_t s_queueSent = 0;       // Advanced by the IRQ.
+static volatile bool s_flushActive = false;
+#if !LV_PORT_DISP_HW_ROTATION
+static uint32_t s_stagingUsed = 0;  // Pixels of s_tmp565 holding queued areas.
+#endif
+static bool s_waitActive = false;
+static uint32_t s_waitLastUs = 0;
+
+static void queued_area_done(void *ctx);
+
+static void kick_queued_area() {
+  const QueuedArea &area = s_queue[s_queueSent];
+  submit_area(area.physXStart, area.physXEnd, area.physYStart, area.physHeight, area.pixels,
+              area.scrollStart, queued_area_done);
+}
+
+// Runs from the DMA IRQ once an area's command list has completed; the next queued area
+// starts straight away: no alarm, no sleep.
+static void queued_area_done(void *ctx) {
+  (void)ctx;
+  area_done_stats();
+  if (s_queue[s_queueSent].closesEvent) event_on_panel();
+
+  lv_disp_drv_t *releaseDrv = s_queue[s_queueSent].releaseDrv;
+  s_queueSent = s_queueSent + 1;
+  if (s_queueSent < s_queueCommitted) {
+    kick_queued_area();
+  } else {
+    s_flushActive = false;
+  }
+  if (releaseDrv) {
+    s_waitActive = false;
+    lv_disp_flush_ready(releaseDrv);
+  }
+}
+
+// Hands every queued area to the IRQ and starts streaming if the panel is idle.
+static void commit_queue() {
+  noInterrupts();
+  s_queueCommitted = s_queueCount;
+  if (!s_flushActive && s_queueSent < s_queueCommitted) {
+    s_flushActive = true;
+    s_stats.bursts++;
+    kick_queued_area();
+  }
+  interrupts();
+}
+
+static void reset_queue() {
+  s_queueCount = 0;
+  s_queueCommitted = 0;
+  s_queueSent = 0;
+#if !LV_PORT_DISP_HW_ROTATION
+  s_stagingUsed = 0;
+#endif
+}
+
+// Blocks until the panel has received every queued area, then recycles the queue.
+static void drain_queue() {
+  commit_queue();
+  const uint32_t spinStartUs = micros();
+  while (s_flushActive) {
+  }
+  s_stats.stallUs += micros() - spinStartUs;
+  reset_queue();
+}
+
+// LVGL calls this in a tight loop while it waits for the previous buffer to finish
+// streaming; the time spent here is CPU time lost to the display.
+static void lv_port_disp_wait(lv_disp_drv_t *disp_drv) {
+  (void)disp_drv;
+  const uint32_t now = micros();
+  if (s_waitActive) {
+    s_stats.stallUs += now - s_waitLastUs;
+  }
+  s_waitActive = true;
+  s_waitLastUs = now;
+}
+#endif
+
+// One panel window of a flushed area. An area is one window, except with panel scrolling
+// where an area that wraps past the panel's last row is sent as two.
+struct PanelWindow {
+  int32_t physYStart;
+  int32_t physHeight;
+  const uint16_t *pixels;
+};
+
+#if LV_PORT_DISP_HW_SCROLL
+static constexpr uint8_t kMaxAreaWindows = 2;
+static int32_t s_scrollStart = 0;  // Last scroll start sent to the panel.
+
+// Logical column x is panel column (x + offset) mod W, i.e. panel row W - 1 - that. The
+// rotated staging rows run from x2 down to x1, so the part past the wrap comes first.
+static uint8_t scrolled_windows(const lv_area_t *area, const uint16_t *staging,
+                                int32_t phys_width, PanelWindow (&out)[kMaxAreaWindows]) {
+  const int32_t w = (int32_t)LVGL_LOGICAL_W;
+  const int32_t columns = area->x2 - area->x1 + 1;
+  const int32_t first = (area->x1 + ui_panel_scroll_offset()) % w;
+  const int32_t wrapped = first + columns - w;
+  if (wrapped <= 0) {
+    out[0] = {w - first - columns, columns, staging};
+    return 1;
+  }
+  out[0] = {w - wrapped, wrapped, staging};
+  out[1] = {0, columns - wrapped, staging + wrapped * phys_width};
+  return 2;
+}
+
+// VSCSAD for the current offset, or -1 when the panel already has it. The first area
+// of a refresh carries the move, so the band follows it in the same burst.
+static int32_t take_scroll_start() {
+  const int32_t start =
+      ((int32_t)LVGL_LOGICAL_W - ui_panel_scroll_offset()) % (int32_t)LVGL_LOGICAL_W;
+  if (start == s_scrollStart) return -1;
+  s_scrollStart = start;
+  return start;
+}
+#else
+static constexpr uint8_t kMaxAreaWindows = 1;
+#endif
 
 static void lv_port_disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   const int32_t logical_width = area->x2 - area->x1 + 1;
@@ -26,79 +309,239 @@ static void lv_port_disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, l
     return;
   }
 
+  if (s_dryRun) {
+    lv_disp_flush_ready(disp_drv);
+    return;
+  }
+
+  s_stats.flushes++;
+
+#if LV_PORT_DISP_DOUBLE_BUFFER
+  if (s_queueCount + kMaxAreaWindows > kMaxQueuedAreas) {
+    drain_queue();
+  } else if (!s_flushActive && s_queueSent == s_queueCount) {
+    reset_queue();
+  }
+#endif
+
+  PanelWindow windows[kMaxAreaWindows];
+  uint8_t windowCount = 1;
+  int32_t scrollStart = -1;
+#if LV_PORT_DISP_HW_ROTATION
+  // The panel already scans in LVGL's landscape order: window == LVGL area.
+  const int32_t phys_x_start = area->x1;
+  const int32_t phys_x_end = area->x2;
+  windows[0] = {area->y1, logical_height, (const uint16_t *)color_p};
+#else
   const int32_t phys_x_start = area->y1;
   const int32_t phys_x_end = area->y2;
-  const int32_t phys_y_start = (int32_t)LVGL_LOGICAL_W - 1 - area->x2;
-  const int32_t phys_y_end = (int32_t)LVGL_LOGICAL_W - 1 - area->x1;
 
-  const int32_t phys_width = phys_x_end - phys_x_start + 1;
-  const int32_t phys_height = phys_y_end - phys_y_start + 1;
-
-  int32_t rows_sent = 0;
-  while (rows_sent < phys_height) {
-    const int32_t stripe_rows = (phys_height - rows_sent > (int32_t)kBufLines)
-                                    ? (int32_t)kBufLines
-                                    : (phys_height - rows_sent);
-    const int32_t pixels = phys_width * stripe_rows;
-
-    for (int32_t row = 0; row < stripe_rows; ++row) {
-      const int32_t phys_y = phys_y_start + rows_sent + row;
-      const int32_t logical_x = (int32_t)LVGL_LOGICAL_W - 1 - phys_y;
-      for (int32_t col = 0; col < phys_width; ++col) {
-        const int32_t phys_x = phys_x_start + col;
-        const int32_t logical_y = phys_x;
-        const int32_t src_index =
-            (logical_y - area->y1) * logical_width + (logical_x - area->x1);
-        const uint16_t src_px = ((uint16_t *)color_p)[src_index];
-        s_tmp565[row * phys_width + col] = kSwapBytesInFlush ? bswap16(src_px) : src_px;
-      }
-    }
+#if LV_PORT_DISP_DOUBLE_BUFFER
+  // The LVGL area never holds more pixels than one draw buffer, so it always fits in an
+  // empty s_tmp565; if earlier areas of this frame are still queued, flush them first.
+  // Slices are rounded to whole words so the next one stays word aligned.
+  const uint32_t areaPixels = ((uint32_t)(logical_width * logical_height) + 1) & ~1u;
+  if (s_stagingUsed + areaPixels > (uint32_t)(LVGL_LOGICAL_W * kBufLines)) {
+    drain_queue();
+  }
+  uint16_t *staging = s_tmp565 + s_stagingUsed;
+  s_stagingUsed += areaPixels;
+#else
+  uint16_t *staging = s_tmp565;
+#endif
+  const uint32_t rotateStartUs = micros();
+  rotate_area(area, color_p, staging);
+  s_stats.rotateUs += micros() - rotateStartUs;
 
-    QSPI_1Wrie_Mode(&qspi);
-    // NOTE: DisplayWindows() assumes a full 280x456 framebuffer and will read out of bounds
-    // when given LVGL's packed tile buffers. Use SetWindows() + RAMWR instead.
-    AMOLED_1IN64_SetWindows((uint32_t)phys_x_start,
-                            (uint32_t)(phys_y_start + rows_sent),
-                            (uint32_t)phys_x_end + 1,
-                            (uint32_t)(phys_y_start + rows_sent + stripe_rows));
-    QSPI_Select(qspi);
-    QSPI_Pixel_Write(qspi, 0x2c);
-
-    QSPI_4Wrie_Mode(&qspi);
-    channel_config_set_dreq(&c, pio_get_dreq(qspi.pio, qspi.sm, true));
-    __asm__ volatile("dmb");
-    dma_channel_configure(
-        dma_tx,
-        &c,
-        &qspi.pio->txf[qspi.sm],
-        (uint8_t *)s_tmp565,
-        pixels * 2,
-        true);
-
-    while (dma_channel_is_busy(dma_tx)) {
-    }
-    __asm__ volatile("dmb");
+#if LV_PORT_DISP_HW_SCROLL
+  windowCount = scrolled_windows(area, staging, logical_height, windows);
+  scrollStart = take_scroll_start();
+#else
+  windows[0] = {(int32_t)LVGL_LOGICAL_W - 1 - area->x2, logical_width, staging};
+#endif
+#endif
 
-    QSPI_Deselect(qspi);
-    if (kPostFlushDelayMs > 0) {
-      DEV_Delay_ms(kPostFlushDelayMs);
+#if LV_PORT_DISP_DOUBLE_BUFFER
+  const bool closesEvent = closes_event(disp_drv);
+  for (uint8_t i = 0; i < windowCount; ++i) {
+    QueuedArea &queued = s_queue[s_queueCount];
+    queued.pixels = windows[i].pixels;
+    queued.physXStart = phys_x_start;
+    queued.physXEnd = phys_x_end;
+    queued.physYStart = windows[i].physYStart;
+    queued.physHeight = windows[i].physHeight;
+    queued.scrollStart = i == 0 ? scrollStart : -1;
+    queued.closesEvent = closesEvent && i + 1 == windowCount;
+    queued.releaseDrv = nullptr;
+    s_queueCount = s_queueCount + 1;
+  }
+#if LV_PORT_DISP_HW_ROTATION
+  s_queue[s_queueCount - 1].releaseDrv = disp_drv;
+  s_waitActive = false;
+  commit_queue();
+#else
+  // The rotated copy owns the pixels now; LVGL can render the next area straight away.
+  const bool lastArea = lv_disp_flush_is_last(disp_drv);
+  lv_disp_flush_ready(disp_drv);
+  if (lastArea) {
+    commit_queue();
+  }
+#endif
+#else
+  for (uint8_t i = 0; i < windowCount; ++i) {
+    submit_area(phys_x_start, phys_x_end, windows[i].physYStart, windows[i].physHeight,
+                windows[i].pixels, i == 0 ? scrollStart : -1, nullptr);
+    const uint32_t spinStartUs = micros();
+    while (QSPI_CmdList_Busy()) {
     }
-
-    rows_sent += stripe_rows;
+    s_stats.stallUs += micros() - spinStartUs;
+    area_done_stats();
   }
+  if (closes_event(disp_drv)) event_on_panel();
 
   lv_disp_flush_ready(disp_drv);
+#endif
+}
+
+#if LV_PORT_DISP_BLEND_HOOK
+static_assert(kRgb565BlendOpaMax == LV_OPA_MAX, "rgb565_blend.h must use LVGL's LV_OPA_MAX");
+
+// The software renderer's blend step. A fill LVGL would store as plain pixels (no source
+// image, no mask or a mask that covers everything, opaque, normal blending) goes to the
+// DMA filler, masked fills and masked or translucent images to the blend kernels; anything
+// else (other blend modes, translucent unmasked fills) to LVGL's own blend. Opaque means
+// what lv_draw_sw_blend_basic() treats as opaque, opa >= LV_OPA_MAX; rgb565_blend.h follows
+// the same cut-offs.
+static void lv_port_disp_blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc) {
+  lv_area_t area;
+  if (dsc->blend_mode != LV_BLEND_MODE_NORMAL || dsc->opa <= LV_OPA_MIN ||
+      (dsc->mask_buf != nullptr && dsc->mask_res == LV_DRAW_MASK_RES_TRANSP) ||
+      !_lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area)) {
+    lv_draw_sw_blend_basic(draw_ctx, dsc);
+    return;
+  }
+  const bool unmasked = dsc->mask_buf == nullptr || dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER;
+  const int32_t stride = lv_area_get_width(draw_ctx->buf_area);
+  uint16_t *dst = (uint16_t *)draw_ctx->buf + stride * (area.y1 - draw_ctx->buf_area->y1) +
+                  (area.x1 - draw_ctx->buf_area->x1);
+  const int32_t w = lv_area_get_width(&area);
+  const int32_t h = lv_area_get_height(&area);
+#if LV_PORT_DISP_DMA_FILL
+  if (dsc->src_buf == nullptr && unmasked && dsc->opa >= LV_OPA_MAX) {
+    s_stats.fills++;
+    s_stats.fillPixels += (uint32_t)(w * h);
+    s_stats.fillByDma += dma_fill_rect(dst, stride, w, h, dsc->color.full);
+    return;
+  }
+#endif
+#if LV_PORT_DISP_SIMD_BLEND
+  const uint8_t *mask = nullptr;
+  int32_t maskStride = 0;
+  if (!unmasked) {
+    maskStride = lv_area_get_width(dsc->mask_area);
+    mask = dsc->mask_buf + maskStride * (area.y1 - dsc->mask_area->y1) +
+           (area.x1 - dsc->mask_area->x1);
+  }
+  if (dsc->src_buf == nullptr && mask != nullptr) {
+    rgb565_blend_fill_mask(dst, stride, w, h, dsc->color.full, mask, maskStride, dsc->opa);
+    s_stats.blends++;
+    s_stats.blendPixels += (uint32_t)(w * h);
+    return;
+  }
+  if (dsc->src_buf != nullptr && (mask != nullptr || dsc->opa < LV_OPA_MAX)) {
+    const int32_t srcStride = lv_area_get_width(dsc->blend_area);
+    const uint16_t *src = (const uint16_t *)dsc->src_buf +
+                          srcStride * (area.y1 - dsc->blend_area->y1) +
+                          (area.x1 - dsc->blend_area->x1);
+    rgb565_blend_map(dst, stride, w, h, src, srcStride, mask, maskStride, dsc->opa);
+    s_stats.blends++;
+    s_stats.blendPixels += (uint32_t)(w * h);
+    return;
+  }
+#endif
+  lv_draw_sw_blend_basic(draw_ctx, dsc);
+}
+
+static void lv_port_disp_draw_ctx_init(lv_disp_drv_t *disp_drv, lv_draw_ctx_t *draw_ctx) {
+  lv_draw_sw_init_ctx(disp_drv, draw_ctx);
+  ((lv_draw_sw_ctx_t *)draw_ctx)->blend = lv_port_disp_blend;
+}
+#endif
+
+static void lv_port_disp_monitor(lv_disp_drv_t *disp_drv, uint32_t time_ms, uint32_t px) {
+  (void)disp_drv;
+  s_stats.frames++;
+  s_stats.frameMsTotal += time_ms;
+  if (time_ms > s_stats.frameMsMax) s_stats.frameMsMax = time_ms;
+  s_stats.pixels += px;
+  ui_refresh_note_frame();
 }
 
 void lv_port_disp_init() {
+#if LV_PORT_DISP_HW_ROTATION
+  AMOLED_1IN64_SetAttributes(HORIZONTAL);
+#endif
+
+  QSPI_CmdList_IRQ_Init();
+#if LV_PORT_DISP_DMA_FILL
+  dma_fill_init();
+#endif
+
+#if LV_PORT_DISP_DOUBLE_BUFFER && LV_PORT_DISP_HW_ROTATION
+  lv_disp_draw_buf_init(&s_draw_buf, s_buf1, s_buf2, LVGL_LOGICAL_W * kBufLines);
+#else
+  // Every other mode hands LVGL its buffer back before the flush returns (software
+  // rotation once the area is in s_tmp565), so a second buffer would sit unused.
   lv_disp_draw_buf_init(&s_draw_buf, s_buf1, nullptr, LVGL_LOGICAL_W * kBufLines);
+#endif
 
   static lv_disp_drv_t disp_drv;
   lv_disp_drv_init(&disp_drv);
   disp_drv.hor_res = LVGL_LOGICAL_W;
   disp_drv.ver_res = LVGL_LOGICAL_H;
   disp_drv.flush_cb = lv_port_disp_flush;
+  disp_drv.monitor_cb = lv_port_disp_monitor;
+#if LV_PORT_DISP_DOUBLE_BUFFER
+  disp_drv.wait_cb = lv_port_disp_wait;
+#endif
   disp_drv.draw_buf = &s_draw_buf;
+#if LV_PORT_DISP_BLEND_HOOK
+  disp_drv.draw_ctx_init = lv_port_disp_draw_ctx_init;
+  disp_drv.draw_ctx_size = sizeof(lv_draw_sw_ctx_t);
+#endif
+
+  lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+#if LV_PORT_DISP_HW_SCROLL
+  // The whole panel height scrolls; the band filter runs after the priority filter.
+  AMOLED_1IN64_SetScrollArea(0, AMOLED_1IN64_HEIGHT, 0);
+  ui_panel_scroll_install(disp);
+#endif
+  // Every refresh passes the region-priority filter first; it is idle until the refresh
+  // governor sets the race tile's priority areas.
+  ui_priority_area_install(disp);
+  s_statsStartUs = micros();
+}
+
+void lv_port_disp_take_stats(LvPortDispStats &out) {
+  noInterrupts();
+  const uint32_t now = micros();
+  out = s_stats;
+  out.windowUs = now - s_statsStartUs;
+  s_stats = LvPortDispStats{};
+  s_statsStartUs = now;
+  interrupts();
+}
 
-  lv_disp_drv_register(&disp_drv);
+void lv_port_disp_mark_event(uint32_t eventUs) {
+  s_eventUs = eventUs;
+  s_eventArmed = true;
+}
+
+void lv_port_disp_set_dry_run(bool dryRun) {
+#if LV_PORT_DISP_DOUBLE_BUFFER
+  if (dryRun) {
+    drain_queue();
+  }
+#endif
+  s_dryRun = dryRun;
 }
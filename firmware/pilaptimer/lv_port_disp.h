@@ -9,6 +9,39 @@
 static const uint16_t LVGL_LOGICAL_W = 456;
 static const uint16_t LVGL_LOGICAL_H = 280;
 
+// Display pipeline counters accumulated since the previous lv_port_disp_take_stats().
+struct LvPortDispStats {
+  uint32_t windowUs;      // Wall time covered by this sample.
+  uint32_t frames;        // LVGL refresh cycles that rendered something.
+  uint32_t frameMsTotal;  // Sum of LVGL render+flush time per refresh.
+  uint32_t frameMsMax;
+  uint32_t pixels;        // Logical pixels refreshed.
+  uint32_t flushes;       // flush_cb invocations.
+  uint32_t bursts;        // Queued frames handed to the panel in one go.
+  uint32_t areas;         // Panel windows opened (one per flushed area).
+  uint32_t rotateUs;      // CPU time spent rotating areas in software.
+  uint32_t cmdUs;         // Window + RAMWR command time, CPU-driven.
+  uint32_t dmaUs;         // Pixel payload time, DMA start to CS release.
+  uint32_t stallUs;       // CPU time blocked waiting on the panel.
+  uint32_t events;        // Samples closed since lv_port_disp_mark_event().
+  uint32_t eventUsTotal;  // Event to last area of the next refresh on the panel.
+  uint32_t eventUsMax;
+  uint32_t fills;         // Solid fills taken by the DMA fill hook (LV_PORT_DISP_DMA_FILL).
+  uint32_t fillPixels;    // Their size.
+  uint32_t fillByDma;     // Pixels of them the DMA wrote; the CPU did short runs and edges.
+  uint32_t blends;        // Masked or translucent blends taken by the kernels
+                          // (LV_PORT_DISP_SIMD_BLEND).
+  uint32_t blendPixels;   // Their size.
+};
+
 void lv_port_disp_init();
+void lv_port_disp_take_stats(LvPortDispStats &out);
+// Starts a latency sample at eventUs (micros()), closed once the panel has received the
+// last area of the next refresh. Call it after pushing the snapshot the event changed,
+// e.g. an IR lap, so the sample ends when the new delta is in panel memory.
+void lv_port_disp_mark_event(uint32_t eventUs);
+// While set, flush_cb releases LVGL's buffer without touching the panel, so refresh time
+// is pure render time (used by the render benchmark).
+void lv_port_disp_set_dry_run(bool dryRun);
 
 #endif
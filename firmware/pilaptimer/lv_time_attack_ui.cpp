@@ -6,6 +6,25 @@
 
 #include "screen_gforce.h"
 #include "screen_reaction.h"
+#include "ui_bind.h"
+#include "ui_digit_clock.h"
+#include "ui_format.h"
+#include "ui_panel_scroll.h"
+#include "ui_styles.h"
+#include "ui_tile_activity.h"
+
+// Build the settings, reaction, G-force and review tiles when navigation first needs them
+// instead of in lv_time_attack_ui_init(). The race tile is always built.
+#ifndef LV_TIME_ATTACK_UI_LAZY_TILES
+#define LV_TIME_ATTACK_UI_LAZY_TILES 1
+#endif
+
+// With lazy tiles, delete a tile's widgets once the tileview settles this many tiles
+// away from it (0 keeps every tile once built). 2 keeps the visible tile's neighbours,
+// so a swipe back shows the tile without rebuilding it.
+#ifndef LV_TIME_ATTACK_UI_TEARDOWN_DISTANCE
+#define LV_TIME_ATTACK_UI_TEARDOWN_DISTANCE 2
+#endif
 
 namespace {
 constexpr uint8_t kMaxDrivers = 10;
@@ -24,13 +43,15 @@ struct UiRefs {
   lv_obj_t *bestLabel;
   lv_obj_t *bestIcon;
   lv_obj_t *lapLabel;
-  lv_obj_t *lapTime;
+  lv_obj_t *lapTime;  // A digit clock, or a plain label if the clock could not be built.
+  bool lapTimeIsLabel;
   lv_obj_t *deltaPill;
   lv_obj_t *deltaLabel;
   lv_obj_t *startBtn;
   lv_obj_t *startLabel;
   lv_obj_t *resetBtn;
   lv_obj_t *resetLabel;
+  lv_obj_t *perfLabel;
 
   lv_obj_t *reportTable;
 
@@ -43,6 +64,18 @@ struct UiRefs {
 };
 
 UiRefs refs{};
+
+// Style values last applied by lv_time_attack_ui_update() (see ui_bind.h).
+struct UiBindings {
+  UiBoundValue deltaPillBg;
+  UiBoundValue deltaText;
+  UiBoundValue startBtnBg;
+  UiBoundValue startBtnText;
+};
+
+UiBindings bound{};
+// onNewLap() nudges the best icon; the next update puts it back beside the label.
+bool bestIconNudged = false;
 void (*startStopHandler)() = nullptr;
 void (*resetHandler)() = nullptr;
 void (*driverPrevHandler)() = nullptr;
@@ -52,37 +85,36 @@ void (*lapsNextHandler)() = nullptr;
 nav_handler_t swipeLeftHandler = nullptr;
 nav_handler_t swipeRightHandler = nullptr;
 tile_change_handler_t tileChangeHandler = nullptr;
+// Tile the tileview last settled on; hidden tiles have their timers and sensor reads
+// paused until they are shown again.
+LvTimeAttackTile visibleTile = LV_TIME_ATTACK_TILE_UNKNOWN;
+// Tiles whose widgets exist; the tile objects themselves are always there.
+bool tileBuilt[kUiTileCount] = {};
+// Last snapshot pushed, applied to a tile when it is (re)built.
+UiSnapshot lastSnapshot{};
+bool haveSnapshot = false;
 
 lv_style_t bestRowStyle;
 
 lv_timer_t *bestIconTimer = nullptr;
 uint8_t lastLapCount = 0;
 
+// Leaderboard as last written to refs.reportTable. The sorted order is kept between
+// updates and a row is only rewritten when its driver or that driver's results change.
+constexpr uint8_t kNoDriver = 0xff;
 
-void formatTime(char *out, size_t outSize, uint32_t ms) {
-  if (outSize == 0) return;
-  uint32_t totalSec = ms / 1000;
-  uint32_t minutes = totalSec / 60;
-  uint32_t seconds = totalSec % 60;
-  uint32_t millisPart = ms % 1000;
-  snprintf(out, outSize, "%lu:%02lu.%03lu",
-           (unsigned long)minutes,
-           (unsigned long)seconds,
-           (unsigned long)millisPart);
-}
+struct LeaderboardEntry {
+  bool valid;
+  uint32_t totalMs;
+  uint32_t bestLapMs;
+  uint32_t bestReactionMs;
+};
 
-void formatTimeMaybe(char *out, size_t outSize, bool valid, uint32_t ms) {
-  if (!valid) {
-    snprintf(out, outSize, "--:--.---");
-    return;
-  }
-  formatTime(out, outSize, ms);
-}
+LeaderboardEntry leaderboard[kMaxDrivers];
+uint8_t leaderboardOrder[kMaxDrivers];
+uint8_t leaderboardRowDriver[kMaxDrivers];
+bool leaderboardLoaded = false;
 
-void formatDelta(char *out, size_t outSize, int32_t deltaMs) {
-  float deltaSec = (float)deltaMs / 1000.0f;
-  snprintf(out, outSize, "%+0.3f", (double)deltaSec);
-}
 
 void setZoom(void *obj, int32_t v) {
   lv_obj_set_style_transform_zoom(static_cast<lv_obj_t *>(obj), v, 0);
@@ -130,6 +162,7 @@ void onNewLap(const UiSnapshot &snapshot) {
   if (snapshot.bestLapMs == snapshot.lastLapMs && snapshot.bestLapMs > 0) {
     lv_obj_clear_flag(refs.bestIcon, LV_OBJ_FLAG_HIDDEN);
     lv_obj_align_to(refs.bestIcon, refs.bestLabel, LV_ALIGN_OUT_RIGHT_MID, -10, 0);
+    bestIconNudged = true;
     if (bestIconTimer) {
       lv_timer_reset(bestIconTimer);
       lv_timer_resume(bestIconTimer);
@@ -137,6 +170,89 @@ void onNewLap(const UiSnapshot &snapshot) {
   }
 }
 
+// Valid runs first, by best lap (a valid run without a lap last), then by driver number.
+bool leaderboardBefore(uint8_t a, uint8_t b) {
+  const LeaderboardEntry &ea = leaderboard[a];
+  const LeaderboardEntry &eb = leaderboard[b];
+  if (ea.valid != eb.valid) return ea.valid;
+  if (ea.valid) {
+    uint32_t aSort = ea.bestLapMs > 0 ? ea.bestLapMs : UINT32_MAX;
+    uint32_t bSort = eb.bestLapMs > 0 ? eb.bestLapMs : UINT32_MAX;
+    if (aSort != bSort) return aSort < bSort;
+  }
+  return a < b;
+}
+
+void writeLeaderboardRow(uint8_t row, uint8_t driverIndex) {
+  const LeaderboardEntry &entry = leaderboard[driverIndex];
+  char buf[24];
+  snprintf(buf, sizeof(buf), "%u", (unsigned)(driverIndex + 1));
+  ui_bind_table_cell(refs.reportTable, row, 0, buf);
+  if (entry.valid) {
+    ui_format_time_ms(buf, sizeof(buf), entry.totalMs);
+    ui_bind_table_cell(refs.reportTable, row, 1, buf);
+    ui_format_time_ms(buf, sizeof(buf), entry.bestLapMs);
+    ui_bind_table_cell(refs.reportTable, row, 2, buf);
+  } else {
+    ui_bind_table_cell(refs.reportTable, row, 1, "--");
+    ui_bind_table_cell(refs.reportTable, row, 2, "--");
+  }
+  if (entry.bestReactionMs > 0) {
+    ui_format_reaction_ms(buf, sizeof(buf), entry.bestReactionMs);
+    ui_bind_table_cell(refs.reportTable, row, 3, buf);
+  } else {
+    ui_bind_table_cell(refs.reportTable, row, 3, "--");
+  }
+}
+
+// Runs every UI refresh, but results only change when a run or reaction completes, so
+// the common case is ten struct compares and no table access.
+void updateLeaderboard(const UiSnapshot &snapshot) {
+  bool changed[kMaxDrivers];
+  bool anyChanged = false;
+  for (uint8_t i = 0; i < kMaxDrivers; ++i) {
+    LeaderboardEntry next{};
+    next.valid = snapshot.driverRunValid[i];
+    next.totalMs = snapshot.driverTotalMs[i];
+    next.bestLapMs = snapshot.driverBestLapMs[i];
+    next.bestReactionMs = snapshot.driverBestReactionMs[i];
+    const LeaderboardEntry &prev = leaderboard[i];
+    changed[i] = !leaderboardLoaded || next.valid != prev.valid || next.totalMs != prev.totalMs ||
+                 next.bestLapMs != prev.bestLapMs || next.bestReactionMs != prev.bestReactionMs;
+    if (changed[i]) {
+      leaderboard[i] = next;
+      anyChanged = true;
+    }
+  }
+  if (!anyChanged) return;
+
+  if (!leaderboardLoaded) {
+    for (uint8_t i = 0; i < kMaxDrivers; ++i) {
+      leaderboardOrder[i] = i;
+      leaderboardRowDriver[i] = kNoDriver;
+    }
+    leaderboardLoaded = true;
+  }
+
+  // The previous order is almost sorted (one driver moved), so insertion sort is linear.
+  for (uint8_t i = 1; i < kMaxDrivers; ++i) {
+    uint8_t driverIndex = leaderboardOrder[i];
+    uint8_t j = i;
+    while (j > 0 && leaderboardBefore(driverIndex, leaderboardOrder[j - 1])) {
+      leaderboardOrder[j] = leaderboardOrder[j - 1];
+      --j;
+    }
+    leaderboardOrder[j] = driverIndex;
+  }
+
+  for (uint8_t i = 0; i < kMaxDrivers; ++i) {
+    uint8_t driverIndex = leaderboardOrder[i];
+    if (leaderboardRowDriver[i] == driverIndex && !changed[driverIndex]) continue;
+    writeLeaderboardRow(i + 1, driverIndex);
+    leaderboardRowDriver[i] = driverIndex;
+  }
+}
+
 void start_btn_event(lv_event_t *e) {
   lv_event_code_t code = lv_event_get_code(e);
   lv_obj_t *obj = lv_event_get_target(e);
@@ -197,51 +313,97 @@ void screen_gesture_event(lv_event_t *e) {
   }
 }
 
+LvTimeAttackTile tileFromObj(lv_obj_t *tile) {
+  if (tile == refs.settingsTile) return LV_TIME_ATTACK_TILE_SETTINGS;
+  if (tile == refs.raceTile) return LV_TIME_ATTACK_TILE_RACE;
+  if (tile == refs.reactionTile) return LV_TIME_ATTACK_TILE_REACTION;
+  if (tile == refs.gforceTile) return LV_TIME_ATTACK_TILE_GFORCE;
+  if (tile == refs.reviewTile) return LV_TIME_ATTACK_TILE_REVIEW;
+  return LV_TIME_ATTACK_TILE_UNKNOWN;
+}
+
+// On-show/on-hide hooks of the tiles that run work of their own.
+void setTileVisible(LvTimeAttackTile tile, bool visible) {
+  switch (tile) {
+    case LV_TIME_ATTACK_TILE_GFORCE:
+      screen_gforce_set_visible(visible);
+      break;
+    default:
+      break;
+  }
+}
+
+void enterTile(LvTimeAttackTile tile) {
+  if (tile == visibleTile) return;
+  setTileVisible(visibleTile, false);
+  visibleTile = tile;
+  setTileVisible(visibleTile, true);
+  ui_tile_activity_set_visible(tile);
+}
+
+void ensureTileBuilt(LvTimeAttackTile tile);
+void teardownTile(LvTimeAttackTile tile);
+
+// Tiles that can scroll into view from the visible one.
+void ensureNeighboursBuilt() {
+  if (visibleTile == LV_TIME_ATTACK_TILE_UNKNOWN) return;
+  if (visibleTile > LV_TIME_ATTACK_TILE_SETTINGS) {
+    ensureTileBuilt((LvTimeAttackTile)(visibleTile - 1));
+  }
+  if (visibleTile < LV_TIME_ATTACK_TILE_REVIEW) {
+    ensureTileBuilt((LvTimeAttackTile)(visibleTile + 1));
+  }
+}
+
+void teardownFarTiles() {
+#if LV_TIME_ATTACK_UI_LAZY_TILES && LV_TIME_ATTACK_UI_TEARDOWN_DISTANCE > 0
+  if (visibleTile == LV_TIME_ATTACK_TILE_UNKNOWN) return;
+  for (uint8_t t = LV_TIME_ATTACK_TILE_SETTINGS; t <= LV_TIME_ATTACK_TILE_REVIEW; ++t) {
+    const int distance = t > visibleTile ? t - visibleTile : visibleTile - t;
+    if (distance >= LV_TIME_ATTACK_UI_TEARDOWN_DISTANCE) teardownTile((LvTimeAttackTile)t);
+  }
+#endif
+}
+
 void tileview_scroll_event(lv_event_t *e) {
-  if (lv_event_get_code(e) != LV_EVENT_VALUE_CHANGED || !tileChangeHandler) return;
-  lv_obj_t *activeTile = lv_tileview_get_tile_act(refs.tileview);
-  LvTimeAttackTile tile = LV_TIME_ATTACK_TILE_UNKNOWN;
-  if (activeTile == refs.settingsTile) {
-    tile = LV_TIME_ATTACK_TILE_SETTINGS;
-  } else if (activeTile == refs.raceTile) {
-    tile = LV_TIME_ATTACK_TILE_RACE;
-  } else if (activeTile == refs.reactionTile) {
-    tile = LV_TIME_ATTACK_TILE_REACTION;
-  } else if (activeTile == refs.gforceTile) {
-    tile = LV_TIME_ATTACK_TILE_GFORCE;
-  } else if (activeTile == refs.reviewTile) {
-    tile = LV_TIME_ATTACK_TILE_REVIEW;
-  }
-  tileChangeHandler(tile);
+  const lv_event_code_t code = lv_event_get_code(e);
+  if (code == LV_EVENT_SCROLL_BEGIN) {
+    // A swipe can end on either neighbour; build both before the first scrolled frame.
+    ensureNeighboursBuilt();
+    ui_panel_scroll_begin(refs.tileview);
+    return;
+  }
+  if (code == LV_EVENT_SCROLL_END) {
+    ui_panel_scroll_end();
+    return;
+  }
+  if (code != LV_EVENT_VALUE_CHANGED) return;
+  const LvTimeAttackTile tile = tileFromObj(lv_tileview_get_tile_act(refs.tileview));
+  ensureTileBuilt(tile);
+  enterTile(tile);
+  teardownFarTiles();
+  if (tileChangeHandler) tileChangeHandler(tile);
 }
 
 lv_obj_t *makeSpinboxRow(lv_obj_t *parent, const char *labelText,
                          lv_obj_t **minusBtn, lv_obj_t **spinbox, lv_obj_t **plusBtn) {
   lv_obj_t *row = lv_obj_create(parent);
   lv_obj_set_size(row, 420, 80);
-  lv_obj_set_style_bg_opa(row, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(row, 0, 0);
-  lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
-  lv_obj_set_flex_align(row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-  lv_obj_set_style_pad_gap(row, 12, 0);
+  ui_style_add(row, UI_STYLE_ROW);
   lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
 
   lv_obj_t *label = lv_label_create(row);
   lv_label_set_text(label, labelText);
-  lv_obj_set_style_text_color(label, lv_color_hex(0x8fa0b6), 0);
-  lv_obj_set_style_text_font(label, &lv_font_montserrat_24, 0);
+  ui_style_add(label, UI_STYLE_CAPTION);
   lv_obj_set_width(label, 140);
   lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_LEFT, 0);
 
   *minusBtn = lv_btn_create(row);
   lv_obj_set_size(*minusBtn, 68, 68);
-  lv_obj_set_style_radius(*minusBtn, 18, 0);
-  lv_obj_set_style_bg_color(*minusBtn, lv_color_hex(0x1e2a38), 0);
-  lv_obj_set_style_bg_opa(*minusBtn, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(*minusBtn, 0, 0);
+  ui_style_add(*minusBtn, UI_STYLE_BUTTON);
   lv_obj_t *minusLabel = lv_label_create(*minusBtn);
   lv_label_set_text(minusLabel, "-");
-  lv_obj_set_style_text_font(minusLabel, &lv_font_montserrat_32, 0);
+  ui_style_add(minusLabel, UI_STYLE_TEXT_32);
   lv_obj_center(minusLabel);
 
   *spinbox = lv_spinbox_create(row);
@@ -250,10 +412,8 @@ lv_obj_t *makeSpinboxRow(lv_obj_t *parent, const char *labelText,
   lv_spinbox_set_step(*spinbox, 1);
   lv_obj_set_size(*spinbox, 80, 56);
   lv_obj_set_style_text_align(*spinbox, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_set_style_text_font(*spinbox, &lv_font_montserrat_48, 0);
-  lv_obj_set_style_text_color(*spinbox, lv_color_hex(0xf5f8ff), 0);
-  lv_obj_set_style_bg_opa(*spinbox, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(*spinbox, 0, 0);
+  ui_style_add(*spinbox, UI_STYLE_CONTAINER);
+  ui_style_add(*spinbox, UI_STYLE_VALUE_48);
   lv_obj_set_style_pad_all(*spinbox, 0, 0);
   lv_obj_set_style_pad_row(*spinbox, 0, 0);
   lv_obj_set_style_bg_opa(*spinbox, LV_OPA_TRANSP, LV_STATE_FOCUSED | LV_STATE_EDITED | LV_STATE_PRESSED);
@@ -263,17 +423,181 @@ lv_obj_t *makeSpinboxRow(lv_obj_t *parent, const char *labelText,
 
   *plusBtn = lv_btn_create(row);
   lv_obj_set_size(*plusBtn, 68, 68);
-  lv_obj_set_style_radius(*plusBtn, 18, 0);
-  lv_obj_set_style_bg_color(*plusBtn, lv_color_hex(0x1e2a38), 0);
-  lv_obj_set_style_bg_opa(*plusBtn, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(*plusBtn, 0, 0);
+  ui_style_add(*plusBtn, UI_STYLE_BUTTON);
   lv_obj_t *plusLabel = lv_label_create(*plusBtn);
   lv_label_set_text(plusLabel, "+");
-  lv_obj_set_style_text_font(plusLabel, &lv_font_montserrat_32, 0);
+  ui_style_add(plusLabel, UI_STYLE_TEXT_32);
   lv_obj_center(plusLabel);
 
   return row;
 }
+void updateSettings(const UiSnapshot &snapshot) {
+  if (!refs.driverSpinbox) return;
+  bool controlsEnabled = snapshot.state != UI_RUNNING;
+  ui_bind_state(refs.driverMinusBtn, LV_STATE_DISABLED, !controlsEnabled);
+  ui_bind_state(refs.driverPlusBtn, LV_STATE_DISABLED, !controlsEnabled);
+  ui_bind_state(refs.lapsMinusBtn, LV_STATE_DISABLED, !controlsEnabled);
+  ui_bind_state(refs.lapsPlusBtn, LV_STATE_DISABLED, !controlsEnabled);
+
+  ui_bind_spinbox(refs.driverSpinbox, snapshot.selectedDriver);
+  ui_bind_spinbox(refs.lapsSpinbox, snapshot.selectedLaps);
+}
+
+void buildReviewTile() {
+  lv_obj_t *reviewContainer = lv_obj_create(refs.reviewTile);
+  lv_obj_set_size(reviewContainer, lv_disp_get_hor_res(nullptr), lv_disp_get_ver_res(nullptr));
+  ui_style_add(reviewContainer, UI_STYLE_COLUMN);
+  lv_obj_clear_flag(reviewContainer, LV_OBJ_FLAG_SCROLLABLE);
+
+  lv_obj_t *reportTitle = lv_label_create(reviewContainer);
+  lv_label_set_text(reportTitle, "LEADERBOARD");
+  ui_style_add(reportTitle, UI_STYLE_TITLE);
+
+  refs.reportTable = lv_table_create(reviewContainer);
+  lv_obj_set_size(refs.reportTable, 420, 210);
+  lv_table_set_col_cnt(refs.reportTable, 4);
+  lv_table_set_row_cnt(refs.reportTable, kMaxDrivers + 1);
+  lv_table_set_col_width(refs.reportTable, 0, 60);
+  lv_table_set_col_width(refs.reportTable, 1, 140);
+  lv_table_set_col_width(refs.reportTable, 2, 120);
+  lv_table_set_col_width(refs.reportTable, 3, 100);
+  lv_obj_set_style_text_font(refs.reportTable, &ui_font_montserrat_20, 0);
+  lv_obj_set_style_border_width(refs.reportTable, 0, 0);
+  lv_obj_set_style_bg_color(refs.reportTable, lv_color_hex(0x000000), 0);
+  lv_obj_set_style_bg_opa(refs.reportTable, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_text_color(refs.reportTable, lv_color_hex(0xffffff), 0);
+  lv_obj_set_style_text_color(refs.reportTable, lv_color_hex(0xffffff), LV_PART_ITEMS);
+  lv_obj_set_style_bg_color(refs.reportTable, lv_color_hex(0x000000), LV_PART_ITEMS);
+  lv_obj_set_style_bg_opa(refs.reportTable, LV_OPA_TRANSP, LV_PART_ITEMS);
+  lv_obj_set_style_border_width(refs.reportTable, 1, LV_PART_ITEMS);
+  lv_obj_set_style_border_color(refs.reportTable, lv_color_hex(0xffffff), LV_PART_ITEMS);
+  lv_table_set_cell_value(refs.reportTable, 0, 0, "D");
+  lv_table_set_cell_value(refs.reportTable, 0, 1, "BEST TOTAL");
+  lv_table_set_cell_value(refs.reportTable, 0, 2, "BEST LAP");
+  lv_table_set_cell_value(refs.reportTable, 0, 3, "BEST RT");
+
+  leaderboardLoaded = false;
+  if (haveSnapshot) updateLeaderboard(lastSnapshot);
+}
+
+void buildSettingsTile() {
+  lv_obj_t *settingsTitle = lv_label_create(refs.settingsTile);
+  lv_label_set_text(settingsTitle, "SETTINGS");
+  ui_style_add(settingsTitle, UI_STYLE_CAPTION);
+  lv_obj_align(settingsTitle, LV_ALIGN_TOP_LEFT, 16, 12);
+
+  lv_obj_t *settingsContainer = lv_obj_create(refs.settingsTile);
+  lv_obj_set_size(settingsContainer, 420, LV_SIZE_CONTENT);
+  ui_style_add(settingsContainer, UI_STYLE_COLUMN);
+  lv_obj_set_style_pad_gap(settingsContainer, 16, 0);
+  lv_obj_clear_flag(settingsContainer, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_align(settingsContainer, LV_ALIGN_TOP_MID, 0, 56);
+
+  (void)makeSpinboxRow(settingsContainer, "DRIVER",
+                       &refs.driverMinusBtn, &refs.driverSpinbox, &refs.driverPlusBtn);
+
+  (void)makeSpinboxRow(settingsContainer, "LAPS",
+                       &refs.lapsMinusBtn, &refs.lapsSpinbox, &refs.lapsPlusBtn);
+  lv_spinbox_set_range(refs.lapsSpinbox, 1, kMaxLaps);
+
+  lv_obj_add_event_cb(refs.driverMinusBtn, driver_minus_event, LV_EVENT_ALL, nullptr);
+  lv_obj_add_event_cb(refs.driverPlusBtn, driver_plus_event, LV_EVENT_ALL, nullptr);
+  lv_obj_add_event_cb(refs.lapsMinusBtn, laps_minus_event, LV_EVENT_ALL, nullptr);
+  lv_obj_add_event_cb(refs.lapsPlusBtn, laps_plus_event, LV_EVENT_ALL, nullptr);
+
+  if (haveSnapshot) updateSettings(lastSnapshot);
+}
+
+lv_obj_t *tileObj(LvTimeAttackTile tile) {
+  switch (tile) {
+    case LV_TIME_ATTACK_TILE_SETTINGS:
+      return refs.settingsTile;
+    case LV_TIME_ATTACK_TILE_RACE:
+      return refs.raceTile;
+    case LV_TIME_ATTACK_TILE_REACTION:
+      return refs.reactionTile;
+    case LV_TIME_ATTACK_TILE_GFORCE:
+      return refs.gforceTile;
+    case LV_TIME_ATTACK_TILE_REVIEW:
+      return refs.reviewTile;
+    default:
+      return nullptr;
+  }
+}
+
+void ensureTileBuilt(LvTimeAttackTile tile) {
+  if (tile == LV_TIME_ATTACK_TILE_UNKNOWN || tileBuilt[tile]) return;
+  const uint32_t heapBefore = ui_tile_activity_heap_used();
+  switch (tile) {
+    case LV_TIME_ATTACK_TILE_SETTINGS:
+      buildSettingsTile();
+      break;
+    case LV_TIME_ATTACK_TILE_REACTION:
+      screen_reaction_attach(refs.reactionTile);
+      break;
+    case LV_TIME_ATTACK_TILE_GFORCE:
+      screen_gforce_attach(refs.gforceTile);
+      break;
+    case LV_TIME_ATTACK_TILE_REVIEW:
+      buildReviewTile();
+      break;
+    default:
+      break;
+  }
+  tileBuilt[tile] = true;
+  setTileVisible(tile, tile == visibleTile);
+  const uint32_t heapAfter = ui_tile_activity_heap_used();
+  ui_tile_activity_built(tile, heapAfter > heapBefore ? heapAfter - heapBefore : 0);
+  ui_tile_activity_sample_heap();
+}
+
+// The race tile stays; every other tile keeps its state outside LVGL (the last snapshot,
+// the reaction and G-force modules' own state) and is rebuilt from it.
+void teardownTile(LvTimeAttackTile tile) {
+  if (tile == LV_TIME_ATTACK_TILE_RACE || tile == LV_TIME_ATTACK_TILE_UNKNOWN ||
+      !tileBuilt[tile]) {
+    return;
+  }
+  switch (tile) {
+    case LV_TIME_ATTACK_TILE_REACTION:
+      screen_reaction_detach();
+      break;
+    case LV_TIME_ATTACK_TILE_GFORCE:
+      screen_gforce_detach();
+      break;
+    case LV_TIME_ATTACK_TILE_SETTINGS:
+      lv_obj_clean(refs.settingsTile);
+      refs.driverMinusBtn = nullptr;
+      refs.driverPlusBtn = nullptr;
+      refs.driverSpinbox = nullptr;
+      refs.lapsMinusBtn = nullptr;
+      refs.lapsPlusBtn = nullptr;
+      refs.lapsSpinbox = nullptr;
+      break;
+    case LV_TIME_ATTACK_TILE_REVIEW:
+      lv_obj_clean(refs.reviewTile);
+      refs.reportTable = nullptr;
+      leaderboardLoaded = false;
+      break;
+    default:
+      break;
+  }
+  tileBuilt[tile] = false;
+  ui_tile_activity_torn_down(tile);
+}
+
+// Programmatic jumps animate across every tile in between, so those are built too; the
+// ones left far away are torn down again when the tileview settles.
+void showTile(LvTimeAttackTile tile) {
+  lv_obj_t *obj = tileObj(tile);
+  if (!refs.tileview || !obj) return;
+  if (visibleTile != LV_TIME_ATTACK_TILE_UNKNOWN) {
+    const int step = tile > visibleTile ? 1 : -1;
+    for (int t = visibleTile; t != tile; t += step) ensureTileBuilt((LvTimeAttackTile)t);
+  }
+  ensureTileBuilt(tile);
+  lv_obj_set_tile(refs.tileview, obj, LV_ANIM_ON);
+}
 }  // namespace
 
 void lv_time_attack_ui_init(void (*startStopCb)(),
@@ -294,15 +618,14 @@ void lv_time_attack_ui_init(void (*startStopCb)(),
   lv_style_set_bg_opa(&bestRowStyle, LV_OPA_COVER);
   lv_style_set_text_color(&bestRowStyle, lv_color_hex(0xffe6a3));
 
+  ui_styles_init();
   refs.screen = lv_obj_create(nullptr);
-  lv_obj_set_style_bg_color(refs.screen, lv_color_hex(0x0b0f14), 0);
-  lv_obj_set_style_bg_opa(refs.screen, LV_OPA_COVER, 0);
+  ui_style_add(refs.screen, UI_STYLE_TILE);
   lv_obj_clear_flag(refs.screen, LV_OBJ_FLAG_SCROLLABLE);
 
   refs.tileview = lv_tileview_create(refs.screen);
   lv_obj_set_size(refs.tileview, lv_disp_get_hor_res(nullptr), lv_disp_get_ver_res(nullptr));
-  lv_obj_set_style_bg_opa(refs.tileview, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(refs.tileview, 0, 0);
+  ui_style_add(refs.tileview, UI_STYLE_CONTAINER);
   lv_obj_set_scrollbar_mode(refs.tileview, LV_SCROLLBAR_MODE_OFF);
   lv_obj_add_event_cb(refs.tileview, tileview_scroll_event, LV_EVENT_SCROLL_BEGIN, nullptr);
   lv_obj_add_event_cb(refs.tileview, tileview_scroll_event, LV_EVENT_SCROLL_END, nullptr);
@@ -318,14 +641,14 @@ void lv_time_attack_ui_init(void (*startStopCb)(),
   // Swipe left on the main timer tile to reach Reaction Race (G-Force is one more swipe).
   // Swipe right on the main timer tile to reach Settings.
   lv_obj_add_event_cb(refs.raceTile, screen_gesture_event, LV_EVENT_GESTURE, nullptr);
-  screen_gforce_attach(refs.gforceTile);
-  screen_reaction_attach(refs.reactionTile);
+  tileBuilt[LV_TIME_ATTACK_TILE_RACE] = true;
+  enterTile(LV_TIME_ATTACK_TILE_RACE);
 
   // Race tile
   refs.bestLabel = lv_label_create(refs.raceTile);
   lv_label_set_text(refs.bestLabel, "BEST --:--.---");
   lv_obj_set_style_text_color(refs.bestLabel, lv_color_hex(0xc3d2e4), 0);
-  lv_obj_set_style_text_font(refs.bestLabel, &lv_font_montserrat_24, 0);
+  lv_obj_set_style_text_font(refs.bestLabel, &ui_font_montserrat_24, 0);
   lv_obj_set_width(refs.bestLabel, 240);
   lv_label_set_long_mode(refs.bestLabel, LV_LABEL_LONG_CLIP);
   lv_obj_align(refs.bestLabel, LV_ALIGN_TOP_LEFT, 16, 12);
@@ -333,26 +656,35 @@ void lv_time_attack_ui_init(void (*startStopCb)(),
   refs.bestIcon = lv_label_create(refs.raceTile);
   lv_label_set_text(refs.bestIcon, LV_SYMBOL_OK);
   lv_obj_set_style_text_color(refs.bestIcon, lv_color_hex(0xffd166), 0);
-  lv_obj_set_style_text_font(refs.bestIcon, &lv_font_montserrat_20, 0);
+  lv_obj_set_style_text_font(refs.bestIcon, &ui_font_montserrat_20, 0);
   lv_obj_add_flag(refs.bestIcon, LV_OBJ_FLAG_HIDDEN);
 
   refs.lapLabel = lv_label_create(refs.raceTile);
   lv_label_set_text(refs.lapLabel, "LAP 0/0");
   lv_obj_set_style_text_color(refs.lapLabel, lv_color_hex(0xc3d2e4), 0);
-  lv_obj_set_style_text_font(refs.lapLabel, &lv_font_montserrat_48, 0);
+  lv_obj_set_style_text_font(refs.lapLabel, &ui_font_montserrat_48, 0);
   lv_obj_set_width(refs.lapLabel, 220);
   lv_obj_set_style_text_align(refs.lapLabel, LV_TEXT_ALIGN_RIGHT, 0);
   lv_label_set_long_mode(refs.lapLabel, LV_LABEL_LONG_CLIP);
   lv_obj_align(refs.lapLabel, LV_ALIGN_TOP_RIGHT, -16, 12);
 
-  refs.lapTime = lv_label_create(refs.raceTile);
-  lv_label_set_text(refs.lapTime, "--:--.---");
-  lv_obj_set_style_text_color(refs.lapTime, lv_color_hex(0xf5f8ff), 0);
-  lv_obj_set_style_text_font(refs.lapTime, &lv_font_montserrat_48, 0);
-  lv_obj_set_width(refs.lapTime, 320);
-  lv_label_set_long_mode(refs.lapTime, LV_LABEL_LONG_CLIP);
+  // Redrawn every refresh while running, so it only repaints the digits that changed.
+  // Its glyph images live outside LVGL's heap; without them the time is a label.
+  refs.lapTime = ui_digit_clock_create(refs.raceTile, &ui_font_montserrat_48,
+                                       lv_color_hex(0xf5f8ff), 320);
+  refs.lapTimeIsLabel = refs.lapTime == nullptr;
+  if (refs.lapTimeIsLabel) {
+    refs.lapTime = lv_label_create(refs.raceTile);
+    lv_obj_set_style_text_color(refs.lapTime, lv_color_hex(0xf5f8ff), 0);
+    lv_obj_set_style_text_font(refs.lapTime, &ui_font_montserrat_48, 0);
+    lv_obj_set_width(refs.lapTime, 320);
+    lv_obj_set_style_text_align(refs.lapTime, LV_TEXT_ALIGN_CENTER, 0);
+    lv_label_set_long_mode(refs.lapTime, LV_LABEL_LONG_CLIP);
+    lv_label_set_text(refs.lapTime, "--:--.---");
+  } else {
+    ui_digit_clock_set_text(refs.lapTime, "--:--.---");
+  }
   lv_obj_align(refs.lapTime, LV_ALIGN_TOP_MID, 0, 72);
-  lv_obj_set_style_text_align(refs.lapTime, LV_TEXT_ALIGN_CENTER, 0);
 
   refs.deltaPill = lv_obj_create(refs.raceTile);
   lv_obj_set_size(refs.deltaPill, 180, 44);
@@ -366,7 +698,7 @@ void lv_time_attack_ui_init(void (*startStopCb)(),
   refs.deltaLabel = lv_label_create(refs.deltaPill);
   lv_label_set_text(refs.deltaLabel, "---.---");
   lv_obj_set_style_text_color(refs.deltaLabel, lv_color_hex(0xdfe8f3), 0);
-  lv_obj_set_style_text_font(refs.deltaLabel, &lv_font_montserrat_24, 0);
+  lv_obj_set_style_text_font(refs.deltaLabel, &ui_font_montserrat_24, 0);
   lv_obj_set_width(refs.deltaLabel, 160);
   lv_obj_set_style_text_align(refs.deltaLabel, LV_TEXT_ALIGN_CENTER, 0);
   lv_obj_center(refs.deltaLabel);
@@ -374,17 +706,14 @@ void lv_time_attack_ui_init(void (*startStopCb)(),
   lv_obj_t *buttonRow = lv_obj_create(refs.raceTile);
   lv_obj_set_size(buttonRow, 420, 72);
   lv_obj_align(buttonRow, LV_ALIGN_BOTTOM_MID, 0, -14);
-  lv_obj_set_style_bg_opa(buttonRow, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(buttonRow, 0, 0);
-  lv_obj_set_flex_flow(buttonRow, LV_FLEX_FLOW_ROW);
-  lv_obj_set_flex_align(buttonRow, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+  ui_style_add(buttonRow, UI_STYLE_ROW);
+  lv_obj_set_style_flex_main_place(buttonRow, LV_FLEX_ALIGN_SPACE_BETWEEN, 0);
   lv_obj_clear_flag(buttonRow, LV_OBJ_FLAG_SCROLLABLE);
 
   refs.startBtn = lv_btn_create(buttonRow);
   lv_obj_set_size(refs.startBtn, 200, 64);
-  lv_obj_set_style_radius(refs.startBtn, 18, 0);
+  ui_style_add(refs.startBtn, UI_STYLE_BUTTON);
   lv_obj_set_style_bg_color(refs.startBtn, lv_color_hex(0x21c17a), 0);
-  lv_obj_set_style_bg_opa(refs.startBtn, LV_OPA_COVER, 0);
   lv_obj_set_style_shadow_width(refs.startBtn, 12, 0);
   lv_obj_set_style_shadow_color(refs.startBtn, lv_color_hex(0x0b2f1f), 0);
   lv_obj_set_style_shadow_opa(refs.startBtn, LV_OPA_50, 0);
@@ -393,17 +722,15 @@ void lv_time_attack_ui_init(void (*startStopCb)(),
 
   refs.startLabel = lv_label_create(refs.startBtn);
   lv_label_set_text(refs.startLabel, "START");
-  lv_obj_set_style_text_font(refs.startLabel, &lv_font_montserrat_24, 0);
+  ui_style_add(refs.startLabel, UI_STYLE_TEXT_24);
   lv_obj_center(refs.startLabel);
 
   refs.resetBtn = lv_btn_create(buttonRow);
   lv_obj_set_size(refs.resetBtn, 200, 64);
-  lv_obj_set_style_radius(refs.resetBtn, 18, 0);
-  lv_obj_set_style_bg_color(refs.resetBtn, lv_color_hex(0x1e2a38), 0);
-  lv_obj_set_style_bg_opa(refs.resetBtn, LV_OPA_COVER, 0);
+  ui_style_add(refs.resetBtn, UI_STYLE_BUTTON);
   lv_obj_set_style_border_width(refs.resetBtn, 1, 0);
   lv_obj_set_style_border_color(refs.resetBtn, lv_color_hex(0x2e4052), 0);
-  lv_obj_set_style_shadow_width(refs.resetBtn, 10, 0);
+  lv_obj_set_style_shadow_width(refs.resetBtn, 12, 0);
   lv_obj_set_style_shadow_color(refs.resetBtn, lv_color_hex(0x0b1118), 0);
   lv_obj_set_style_shadow_opa(refs.resetBtn, LV_OPA_50, 0);
   lv_obj_set_style_text_color(refs.resetBtn, lv_color_hex(0xe5edf7), 0);
@@ -411,7 +738,7 @@ void lv_time_attack_ui_init(void (*startStopCb)(),
 
   refs.resetLabel = lv_label_create(refs.resetBtn);
   lv_label_set_text(refs.resetLabel, "RESET");
-  lv_obj_set_style_text_font(refs.resetLabel, &lv_font_montserrat_24, 0);
+  ui_style_add(refs.resetLabel, UI_STYLE_TEXT_24);
   lv_obj_center(refs.resetLabel);
 
   lv_obj_set_style_transform_pivot_x(refs.startBtn, 100, 0);
@@ -419,76 +746,15 @@ void lv_time_attack_ui_init(void (*startStopCb)(),
   lv_obj_set_style_transform_pivot_x(refs.resetBtn, 100, 0);
   lv_obj_set_style_transform_pivot_y(refs.resetBtn, 32, 0);
 
-  // Reporting tile
-  lv_obj_t *reviewContainer = lv_obj_create(refs.reviewTile);
-  lv_obj_set_size(reviewContainer, lv_disp_get_hor_res(nullptr), lv_disp_get_ver_res(nullptr));
-  lv_obj_set_style_bg_opa(reviewContainer, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(reviewContainer, 0, 0);
-  lv_obj_set_flex_flow(reviewContainer, LV_FLEX_FLOW_COLUMN);
-  lv_obj_set_flex_align(reviewContainer, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-  lv_obj_set_style_pad_gap(reviewContainer, 12, 0);
-  lv_obj_clear_flag(reviewContainer, LV_OBJ_FLAG_SCROLLABLE);
-
-  lv_obj_t *reportTitle = lv_label_create(reviewContainer);
-  lv_label_set_text(reportTitle, "LEADERBOARD");
-  lv_obj_set_style_text_color(reportTitle, lv_color_hex(0x8fa0b6), 0);
-  lv_obj_set_style_text_font(reportTitle, &lv_font_montserrat_20, 0);
-
-  refs.reportTable = lv_table_create(reviewContainer);
-  lv_obj_set_size(refs.reportTable, 420, 210);
-  lv_table_set_col_cnt(refs.reportTable, 4);
-  lv_table_set_row_cnt(refs.reportTable, kMaxDrivers + 1);
-  lv_table_set_col_width(refs.reportTable, 0, 60);
-  lv_table_set_col_width(refs.reportTable, 1, 140);
-  lv_table_set_col_width(refs.reportTable, 2, 120);
-  lv_table_set_col_width(refs.reportTable, 3, 100);
-  lv_obj_set_style_text_font(refs.reportTable, &lv_font_montserrat_20, 0);
-  lv_obj_set_style_border_width(refs.reportTable, 0, 0);
-  lv_obj_set_style_bg_color(refs.reportTable, lv_color_hex(0x000000), 0);
-  lv_obj_set_style_bg_opa(refs.reportTable, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_text_color(refs.reportTable, lv_color_hex(0xffffff), 0);
-  lv_obj_set_style_text_color(refs.reportTable, lv_color_hex(0xffffff), LV_PART_ITEMS);
-  lv_obj_set_style_bg_color(refs.reportTable, lv_color_hex(0x000000), LV_PART_ITEMS);
-  lv_obj_set_style_bg_opa(refs.reportTable, LV_OPA_TRANSP, LV_PART_ITEMS);
-  lv_obj_set_style_border_width(refs.reportTable, 1, LV_PART_ITEMS);
-  lv_obj_set_style_border_color(refs.reportTable, lv_color_hex(0xffffff), LV_PART_ITEMS);
-  lv_table_set_cell_value(refs.reportTable, 0, 0, "D");
-  lv_table_set_cell_value(refs.reportTable, 0, 1, "BEST TOTAL");
-  lv_table_set_cell_value(refs.reportTable, 0, 2, "BEST LAP");
-  lv_table_set_cell_value(refs.reportTable, 0, 3, "BEST RT");
-
-  // Settings tile
-  lv_obj_t *settingsTitle = lv_label_create(refs.settingsTile);
-  lv_label_set_text(settingsTitle, "SETTINGS");
-  lv_obj_set_style_text_color(settingsTitle, lv_color_hex(0x8fa0b6), 0);
-  lv_obj_set_style_text_font(settingsTitle, &lv_font_montserrat_24, 0);
-  lv_obj_align(settingsTitle, LV_ALIGN_TOP_LEFT, 16, 12);
-
-  lv_obj_t *settingsContainer = lv_obj_create(refs.settingsTile);
-  lv_obj_set_size(settingsContainer, 420, LV_SIZE_CONTENT);
-  lv_obj_set_style_bg_opa(settingsContainer, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(settingsContainer, 0, 0);
-  lv_obj_set_flex_flow(settingsContainer, LV_FLEX_FLOW_COLUMN);
-  lv_obj_set_flex_align(settingsContainer, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-  lv_obj_set_style_pad_gap(settingsContainer, 16, 0);
-  lv_obj_clear_flag(settingsContainer, LV_OBJ_FLAG_SCROLLABLE);
-  lv_obj_align(settingsContainer, LV_ALIGN_TOP_MID, 0, 56);
-
-  (void)makeSpinboxRow(settingsContainer, "DRIVER",
-                       &refs.driverMinusBtn, &refs.driverSpinbox, &refs.driverPlusBtn);
-
-  (void)makeSpinboxRow(settingsContainer, "LAPS",
-                       &refs.lapsMinusBtn, &refs.lapsSpinbox, &refs.lapsPlusBtn);
-  lv_spinbox_set_range(refs.lapsSpinbox, 1, kMaxLaps);
-
-  lv_obj_add_event_cb(refs.driverMinusBtn, driver_minus_event, LV_EVENT_ALL, nullptr);
-  lv_obj_add_event_cb(refs.driverPlusBtn, driver_plus_event, LV_EVENT_ALL, nullptr);
-  lv_obj_add_event_cb(refs.lapsMinusBtn, laps_minus_event, LV_EVENT_ALL, nullptr);
-  lv_obj_add_event_cb(refs.lapsPlusBtn, laps_plus_event, LV_EVENT_ALL, nullptr);
-
   bestIconTimer = lv_timer_create(hideBestIcon, kBestIconMs, nullptr);
   lv_timer_pause(bestIconTimer);
 
+#if !LV_TIME_ATTACK_UI_LAZY_TILES
+  for (uint8_t t = LV_TIME_ATTACK_TILE_SETTINGS; t <= LV_TIME_ATTACK_TILE_REVIEW; ++t) {
+    ensureTileBuilt((LvTimeAttackTile)t);
+  }
+#endif
+
   lv_scr_load(refs.screen);
 }
 
@@ -504,151 +770,120 @@ void lv_time_attack_ui_set_tile_change_handler(tile_change_handler_t cb) {
   tileChangeHandler = cb;
 }
 
+LvTimeAttackTile lv_time_attack_ui_get_visible_tile() {
+  return visibleTile;
+}
+
+uint8_t lv_time_attack_ui_get_priority_areas(lv_area_t (&out)[3]) {
+  if (visibleTile != LV_TIME_ATTACK_TILE_RACE || !refs.raceTile) return 0;
+  // Mid-scroll the tile is moving; every area has to be drawn with it.
+  lv_area_t view;
+  lv_area_t tile;
+  lv_obj_get_coords(refs.tileview, &view);
+  lv_obj_get_coords(refs.raceTile, &tile);
+  if (tile.x1 != view.x1 || tile.y1 != view.y1) return 0;
+  lv_obj_get_coords(refs.lapLabel, &out[0]);
+  lv_obj_get_coords(refs.lapTime, &out[1]);
+  lv_obj_get_coords(refs.deltaPill, &out[2]);
+  return 3;
+}
+
 lv_obj_t *lv_time_attack_ui_get_screen() {
   return refs.screen;
 }
 
 void lv_time_attack_ui_show_race_tile() {
-  if (!refs.tileview || !refs.raceTile) return;
-  lv_obj_set_tile(refs.tileview, refs.raceTile, LV_ANIM_ON);
+  showTile(LV_TIME_ATTACK_TILE_RACE);
 }
 
 void lv_time_attack_ui_show_reaction_tile() {
-  if (!refs.tileview || !refs.reactionTile) return;
-  lv_obj_set_tile(refs.tileview, refs.reactionTile, LV_ANIM_ON);
+  showTile(LV_TIME_ATTACK_TILE_REACTION);
 }
 
 void lv_time_attack_ui_show_settings_tile() {
-  if (!refs.tileview || !refs.settingsTile) return;
-  lv_obj_set_tile(refs.tileview, refs.settingsTile, LV_ANIM_ON);
+  showTile(LV_TIME_ATTACK_TILE_SETTINGS);
 }
 
 void lv_time_attack_ui_show_gforce_tile() {
-  if (!refs.tileview || !refs.gforceTile) return;
-  lv_obj_set_tile(refs.tileview, refs.gforceTile, LV_ANIM_ON);
+  showTile(LV_TIME_ATTACK_TILE_GFORCE);
 }
 
-void lv_time_attack_ui_update(const UiSnapshot &snapshot) {
-  char line[48];
+void lv_time_attack_ui_show_review_tile() {
+  showTile(LV_TIME_ATTACK_TILE_REVIEW);
+}
 
-  bool controlsEnabled = snapshot.state != UI_RUNNING;
-  if (controlsEnabled) {
-    lv_obj_clear_state(refs.driverMinusBtn, LV_STATE_DISABLED);
-    lv_obj_clear_state(refs.driverPlusBtn, LV_STATE_DISABLED);
-    lv_obj_clear_state(refs.lapsMinusBtn, LV_STATE_DISABLED);
-    lv_obj_clear_state(refs.lapsPlusBtn, LV_STATE_DISABLED);
-  } else {
-    lv_obj_add_state(refs.driverMinusBtn, LV_STATE_DISABLED);
-    lv_obj_add_state(refs.driverPlusBtn, LV_STATE_DISABLED);
-    lv_obj_add_state(refs.lapsMinusBtn, LV_STATE_DISABLED);
-    lv_obj_add_state(refs.lapsPlusBtn, LV_STATE_DISABLED);
+void lv_time_attack_ui_set_perf_kpx(uint32_t kpxPerSec) {
+  if (!refs.raceTile) return;
+  if (!refs.perfLabel) {
+    // Sits in the gap between the delta pill and the button row.
+    refs.perfLabel = lv_label_create(refs.raceTile);
+    lv_obj_set_style_text_color(refs.perfLabel, lv_color_hex(0x5f6f82), 0);
+    lv_obj_set_style_text_font(refs.perfLabel, &ui_font_montserrat_20, 0);
+    lv_obj_align(refs.perfLabel, LV_ALIGN_TOP_MID, 0, 170);
   }
+  char line[24];
+  snprintf(line, sizeof(line), "%lu kpx/s", (unsigned long)kpxPerSec);
+  lv_label_set_text(refs.perfLabel, line);
+}
 
-  lv_spinbox_set_value(refs.driverSpinbox, snapshot.selectedDriver);
-  lv_spinbox_set_value(refs.lapsSpinbox, snapshot.selectedLaps);
+void lv_time_attack_ui_update(const UiSnapshot &snapshot) {
+  char line[48];
+  ui_tile_activity_note(UI_TILE_SUBSYSTEM_RACE_UPDATE);
+  ui_tile_activity_sample_heap();
+  lastSnapshot = snapshot;
+  haveSnapshot = true;
+
+  updateSettings(snapshot);
 
   char timeBuf[24];
-  formatTimeMaybe(timeBuf, sizeof(timeBuf), snapshot.bestLapMs > 0, snapshot.bestLapMs);
+  ui_format_time_ms_maybe(timeBuf, sizeof(timeBuf), snapshot.bestLapMs > 0, snapshot.bestLapMs);
   snprintf(line, sizeof(line), "BEST %s", timeBuf);
-  lv_label_set_text(refs.bestLabel, line);
-  lv_obj_align_to(refs.bestIcon, refs.bestLabel, LV_ALIGN_OUT_RIGHT_MID, 6, 0);
+  if (ui_bind_label(refs.bestLabel, line) || bestIconNudged) {
+    lv_obj_align_to(refs.bestIcon, refs.bestLabel, LV_ALIGN_OUT_RIGHT_MID, 6, 0);
+    bestIconNudged = false;
+  }
 
   uint8_t lapDisplay = snapshot.lapCount;
   if (snapshot.state == UI_RUNNING && lapDisplay < snapshot.selectedLaps) {
     lapDisplay++;
   }
   snprintf(line, sizeof(line), "LAP %u/%u", (unsigned)lapDisplay, (unsigned)snapshot.selectedLaps);
-  lv_label_set_text(refs.lapLabel, line);
+  ui_bind_label(refs.lapLabel, line);
 
-  formatTimeMaybe(timeBuf, sizeof(timeBuf), snapshot.state == UI_RUNNING || snapshot.state == UI_FINISHED,
+  ui_format_time_ms_maybe(timeBuf, sizeof(timeBuf), snapshot.state == UI_RUNNING || snapshot.state == UI_FINISHED,
                   snapshot.sessionMs);
-  lv_label_set_text(refs.lapTime, timeBuf);
+  if (refs.lapTimeIsLabel) {
+    ui_bind_label(refs.lapTime, timeBuf);
+  } else {
+    ui_bind_digit_clock(refs.lapTime, timeBuf);
+  }
 
   if (snapshot.lapCount > 0 && snapshot.bestLapMs > 0) {
-    formatDelta(line, sizeof(line), snapshot.deltaMs);
-    lv_label_set_text(refs.deltaLabel, line);
+    ui_format_delta_ms(line, sizeof(line), snapshot.deltaMs);
+    ui_bind_label(refs.deltaLabel, line);
     lv_color_t pillColor = (snapshot.deltaMs <= 0) ? lv_color_hex(0x1b5e3b) : lv_color_hex(0x5c1f28);
     lv_color_t textColor = (snapshot.deltaMs <= 0) ? lv_color_hex(0x8cf5be) : lv_color_hex(0xf6a3af);
-    lv_obj_set_style_bg_color(refs.deltaPill, pillColor, 0);
-    lv_obj_set_style_text_color(refs.deltaLabel, textColor, 0);
+    ui_bind_bg_color(refs.deltaPill, bound.deltaPillBg, pillColor);
+    ui_bind_text_color(refs.deltaLabel, bound.deltaText, textColor);
   } else {
-    lv_label_set_text(refs.deltaLabel, "---.---");
-    lv_obj_set_style_bg_color(refs.deltaPill, lv_color_hex(0x1a2633), 0);
-    lv_obj_set_style_text_color(refs.deltaLabel, lv_color_hex(0xdfe8f3), 0);
+    ui_bind_label(refs.deltaLabel, "---.---");
+    ui_bind_bg_color(refs.deltaPill, bound.deltaPillBg, lv_color_hex(0x1a2633));
+    ui_bind_text_color(refs.deltaLabel, bound.deltaText, lv_color_hex(0xdfe8f3));
   }
 
   const bool running = snapshot.state == UI_RUNNING || snapshot.state == UI_ARMED;
-  lv_label_set_text(refs.startLabel, running ? "STOP" : "START");
-  lv_obj_set_style_bg_color(refs.startBtn, running ? lv_color_hex(0xe05a63) : lv_color_hex(0x21c17a), 0);
-  lv_obj_set_style_text_color(refs.startBtn, running ? lv_color_hex(0x2a0f12) : lv_color_hex(0x08140e), 0);
+  ui_bind_label(refs.startLabel, running ? "STOP" : "START");
+  ui_bind_bg_color(refs.startBtn, bound.startBtnBg,
+                   running ? lv_color_hex(0xe05a63) : lv_color_hex(0x21c17a));
+  ui_bind_text_color(refs.startBtn, bound.startBtnText,
+                     running ? lv_color_hex(0x2a0f12) : lv_color_hex(0x08140e));
 
-  if (snapshot.state == UI_RUNNING) {
-    lv_obj_add_state(refs.resetBtn, LV_STATE_DISABLED);
-  } else {
-    lv_obj_clear_state(refs.resetBtn, LV_STATE_DISABLED);
-  }
+  ui_bind_state(refs.resetBtn, LV_STATE_DISABLED, snapshot.state == UI_RUNNING);
 
   if (snapshot.lapCount > lastLapCount) {
     onNewLap(snapshot);
   }
   lastLapCount = snapshot.lapCount;
 
-  uint8_t driverOrder[kMaxDrivers];
-  for (uint8_t i = 0; i < kMaxDrivers; ++i) {
-    driverOrder[i] = i;
-  }
-
-  for (uint8_t i = 0; i < kMaxDrivers; ++i) {
-    for (uint8_t j = i + 1; j < kMaxDrivers; ++j) {
-      uint8_t a = driverOrder[i];
-      uint8_t b = driverOrder[j];
-      bool aValid = snapshot.driverRunValid[a];
-      bool bValid = snapshot.driverRunValid[b];
-      uint32_t aBest = snapshot.driverBestLapMs[a];
-      uint32_t bBest = snapshot.driverBestLapMs[b];
-      uint32_t aSort = (aValid && aBest > 0) ? aBest : UINT32_MAX;
-      uint32_t bSort = (bValid && bBest > 0) ? bBest : UINT32_MAX;
-
-      bool shouldSwap = false;
-      if (aValid != bValid) {
-        shouldSwap = bValid;
-      } else if (aValid && bValid) {
-        if (bSort < aSort) {
-          shouldSwap = true;
-        } else if (bSort == aSort && b < a) {
-          shouldSwap = true;
-        }
-      } else if (b < a) {
-        shouldSwap = true;
-      }
-
-      if (shouldSwap) {
-        driverOrder[i] = b;
-        driverOrder[j] = a;
-      }
-    }
-  }
-
-  for (uint8_t i = 0; i < kMaxDrivers; ++i) {
-    uint8_t driverIndex = driverOrder[i];
-    uint8_t row = i + 1;
-    snprintf(line, sizeof(line), "%u", (unsigned)(driverIndex + 1));
-    lv_table_set_cell_value(refs.reportTable, row, 0, line);
-    if (snapshot.driverRunValid[driverIndex]) {
-      formatTime(timeBuf, sizeof(timeBuf), snapshot.driverTotalMs[driverIndex]);
-      lv_table_set_cell_value(refs.reportTable, row, 1, timeBuf);
-      formatTime(timeBuf, sizeof(timeBuf), snapshot.driverBestLapMs[driverIndex]);
-      lv_table_set_cell_value(refs.reportTable, row, 2, timeBuf);
-    } else {
-      lv_table_set_cell_value(refs.reportTable, row, 1, "--");
-      lv_table_set_cell_value(refs.reportTable, row, 2, "--");
-    }
-
-    if (snapshot.driverBestReactionMs[driverIndex] > 0) {
-      format_reaction_ms(timeBuf, sizeof(timeBuf), snapshot.driverBestReactionMs[driverIndex]);
-      lv_table_set_cell_value(refs.reportTable, row, 3, timeBuf);
-    } else {
-      lv_table_set_cell_value(refs.reportTable, row, 3, "--");
-    }
-  }
+  if (refs.reportTable) updateLeaderboard(snapshot);
 }
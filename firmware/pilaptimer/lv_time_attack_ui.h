@@ -42,11 +42,21 @@ enum LvTimeAttackTile {
 };
 typedef void (*tile_change_handler_t)(LvTimeAttackTile tile);
 void lv_time_attack_ui_set_tile_change_handler(tile_change_handler_t cb);
+// Tile the tileview last settled on (updated before the tile change handler runs).
+LvTimeAttackTile lv_time_attack_ui_get_visible_tile();
 void lv_time_attack_ui_show_race_tile();
 void lv_time_attack_ui_show_reaction_tile();
 void lv_time_attack_ui_show_settings_tile();
 void lv_time_attack_ui_show_gforce_tile();
+void lv_time_attack_ui_show_review_tile();
 void lv_time_attack_ui_update(const UiSnapshot &snapshot);
+// Screen areas of the lap counter, running time and delta pill, for region-priority
+// refresh (ui_priority_area.h). Returns how many were written to out, 0 unless the race
+// tile is built and settled on screen.
+uint8_t lv_time_attack_ui_get_priority_areas(lv_area_t (&out)[3]);
+// Small diagnostics line on the race tile ("<n> kpx/s"); created on first use. Formatted
+// here rather than by the caller so its glyphs are in the UI sources font_subset scans.
+void lv_time_attack_ui_set_perf_kpx(uint32_t kpxPerSec);
 lv_obj_t *lv_time_attack_ui_get_screen();
 
 #endif
@@ -15,6 +15,7 @@
 #include "fonts.h"
 #include "screen_reaction.h"
 #include "ui_state.h"
+#include "ui_format.h"
 #include "sd_logger.h"
 
 #include "boot_splash_v4_280x456_rgb565.h"
@@ -27,10 +28,17 @@
 #define LV_CONF_INCLUDE_SIMPLE
 #include <lvgl.h>
 
+#include "dma_fill.h"
 #include "lv_port_disp.h"
+#include "rgb565_blend.h"
 #include "lv_port_indev.h"
 #include "lv_time_attack_ui.h"
 #include "screen_nav.h"
+#include "ui_bind.h"
+#include "ui_panel_scroll.h"
+#include "ui_priority_area.h"
+#include "ui_refresh.h"
+#include "ui_tile_activity.h"
 
 lv_obj_t *screen_gforce_get_screen(void);
 #endif
@@ -58,6 +66,28 @@ static const UWORD UI_ROTATION = ROTATE_270;
 #define REACTION_DEBUG 0
 #endif
 
+// Periodically prints LVGL frame time, flush volume and display stall time, the frame
+// rate and CPU headroom per refresh mode (ui_refresh.h), and shows the flushed pixel rate
+// on the race tile.
+#ifndef DISP_STATS_DEBUG
+#define DISP_STATS_DEBUG 0
+#endif
+
+// Renders the race and G-force tiles at boot with the panel transfer disabled and prints
+// the average full-frame render time, then the CPU cycles per pixel of solid fills done
+// by LVGL's software fill and by DMA (dma_fill.h), and of masked and translucent blends
+// done by LVGL's software blend and by the blend kernels (rgb565_blend.h). Compare builds
+// with LV_COLOR_16_SWAP 1 and 0.
+#ifndef DISP_RENDER_BENCH
+#define DISP_RENDER_BENCH 0
+#endif
+
+// 1: invalidate the whole screen every loop (old tearing workaround, ~128k px per frame).
+// 0: LVGL only redraws what widgets invalidated.
+#ifndef LVGL_FULL_INVALIDATE
+#define LVGL_FULL_INVALIDATE 0
+#endif
+
 // IMPORTANT: Do NOT use GP6/GP7 (I2C). Use GP16 (wire buzzer + to GP16, - to GND).
 static const uint8_t  BUZZER_PIN = 16;
 
@@ -71,13 +101,13 @@ static const uint16_t POLL_MS              = 10;
 static const uint16_t TOUCH_HOLD_MS        = 120;
 static const uint16_t BEEP_DEBOUNCE_MS     = 250;
 static const uint16_t UI_REFRESH_MS        = 250;
-static const uint16_t LVGL_UI_REFRESH_MS   = 100;
 static const uint32_t REACTION_AMBER_STEP_MS = 500;
 static const uint32_t REACTION_ARMED_COUNTDOWN_MS = 3000;
 static const uint32_t REACTION_RANDOM_MIN_MS = 400;
 static const uint32_t REACTION_RANDOM_MAX_MS = 1600;
 static const uint32_t REACTION_FALSE_START_LOCKOUT_MS = 2000;
 static const uint32_t REACTION_ACTION_DEBOUNCE_MS = 150;
+static const uint32_t DISP_STATS_INTERVAL_MS = 5000;
 static const uint32_t REACTION_IMU_POLL_MS = 30;
 static const uint32_t REACTION_DEBOUNCE_MS = 100;
 static const uint32_t REACTION_POST_GREEN_IGNORE_MS = 80;
@@ -110,7 +140,19 @@ static void ShowBootSplashImage() {
     }
   }
 
+#if DISP_STATS_DEBUG
+  const uint32_t frameStartUs = micros();
+  AMOLED_1IN64_Display(splash_frame);
+  const uint32_t frameUs = micros() - frameStartUs;
+  const uint32_t frameBytes = (uint32_t)(splash_pixels * sizeof(UWORD));
+  // bytes per microsecond == MB/s
+  const uint32_t mbPerSecX100 = frameUs ? (uint32_t)((uint64_t)frameBytes * 100ULL / frameUs) : 0;
+  Serial.printf("DISP full_frame bytes=%lu us=%lu MB_s=%lu.%02lu\n",
+                (unsigned long)frameBytes, (unsigned long)frameUs,
+                (unsigned long)(mbPerSecX100 / 100), (unsigned long)(mbPerSecX100 % 100));
+#else
   AMOLED_1IN64_Display(splash_frame);
+#endif
   delay(2000);
   free(splash_frame);
 }
@@ -272,12 +314,14 @@ static void RotateTouch(uint16_t nx, uint16_t ny, uint16_t &rx, uint16_t &ry) {
 
 volatile bool gIrSeen = false;
 volatile uint32_t gIrSeenMs = 0;
+volatile uint32_t gIrSeenUs = 0;  // Same edge, for the lap-to-panel latency sample.
 static bool gIrActive = false;
 static uint32_t gIrReleaseStartMs = 0;
 static uint32_t gIrLastReleaseMs = 0;
 
 void IRAM_ATTR IrIsr() {
   gIrSeenMs = (uint32_t)millis();
+  gIrSeenUs = (uint32_t)micros();
   gIrSeen = true;
 }
 
@@ -314,26 +358,6 @@ static void DrawValueBox(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const c
   DrawCenteredText(x, y, w, h, value, &Font24, WHITE, DARKBLUE);
 }
 
-static void FormatTime(char *out, size_t outSize, uint32_t ms) {
-  if (outSize == 0) return;
-  uint32_t totalSec = ms / 1000;
-  uint32_t minutes = totalSec / 60;
-  uint32_t seconds = totalSec % 60;
-  uint32_t millisPart = ms % 1000;
-  snprintf(out, outSize, "%lu:%02lu.%03lu",
-           (unsigned long)minutes,
-           (unsigned long)seconds,
-           (unsigned long)millisPart);
-}
-
-static void FormatTimeMaybe(char *out, size_t outSize, bool valid, uint32_t ms) {
-  if (!valid) {
-    snprintf(out, outSize, "--:--.---");
-    return;
-  }
-  FormatTime(out, outSize, ms);
-}
-
 static uint32_t ElapsedSince(uint32_t now, uint32_t startMs) {
   if (now < startMs) {
     return 0;
@@ -395,6 +419,9 @@ static bool gUiDirty = true;
 static uint32_t gLastLvglUiMs = 0;
 static bool gReactionUiDirty = true;
 static uint32_t gLastReactionUiMs = 0;
+// IR edge of the last lap, handed to lv_port_disp_mark_event() once its snapshot is out.
+static uint32_t gLapPanelUs = 0;
+static bool gLapPanelPending = false;
 #endif
 // Buttons (idle)
 static const Button BTN_DRIVER_MINUS = {UI_STEP_MINUS_X, UI_DRIVER_Y + UI_STEP_Y_OFFSET, UI_STEP_BTN, UI_STEP_BTN, "-"};
@@ -449,12 +476,12 @@ static void DrawIdleScreen() {
   char timeBuf[24];
   uint16_t infoY = UI_SECTION_Y + 22;
   if (run.valid) {
-    FormatTime(timeBuf, sizeof(timeBuf), run.totalMs);
+    ui_format_time_ms(timeBuf, sizeof(timeBuf), run.totalMs);
     snprintf(line, sizeof(line), "Total: %s", timeBuf);
     Paint_DrawString_EN(UI_RIGHT_X, infoY, line, &Font16, WHITE, BLACK);
     infoY += 22;
 
-    FormatTime(timeBuf, sizeof(timeBuf), run.bestMs);
+    ui_format_time_ms(timeBuf, sizeof(timeBuf), run.bestMs);
     snprintf(line, sizeof(line), "Best:  %s", timeBuf);
     Paint_DrawString_EN(UI_RIGHT_X, infoY, line, &Font16, WHITE, BLACK);
     infoY += 22;
@@ -504,15 +531,15 @@ static void DrawRunningScreen() {
   uint32_t currentLapMs = (gLapCount == 0) ? ElapsedSince(now, gStartMs)
                                            : ElapsedSince(now, gLastLapStartMs);
   char timeBuf[24];
-  FormatTime(timeBuf, sizeof(timeBuf), currentLapMs);
+  ui_format_time_ms(timeBuf, sizeof(timeBuf), currentLapMs);
   DrawValueBox(UI_MARGIN, UI_SECTION_Y + 56, LOGICAL_W - (UI_MARGIN * 2), 46, timeBuf);
   Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 108, "Current Lap", &Font16, WHITE, BLACK);
 
-  FormatTimeMaybe(timeBuf, sizeof(timeBuf), gLapCount > 0, gLastLapMs);
+  ui_format_time_ms_maybe(timeBuf, sizeof(timeBuf), gLapCount > 0, gLastLapMs);
   snprintf(line, sizeof(line), "Last: %s", timeBuf);
   Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 132, line, &Font16, WHITE, BLACK);
 
-  FormatTimeMaybe(timeBuf, sizeof(timeBuf), gBestLapMs > 0, gBestLapMs);
+  ui_format_time_ms_maybe(timeBuf, sizeof(timeBuf), gBestLapMs > 0, gBestLapMs);
   snprintf(line, sizeof(line), "Best: %s", timeBuf);
   Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 154, line, &Font16, WHITE, BLACK);
 
@@ -522,7 +549,7 @@ static void DrawRunningScreen() {
     Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 176, line, &Font16, (delta <= 0) ? GREEN : RED, BLACK);
   }
 
-  FormatTime(timeBuf, sizeof(timeBuf), gSessionMs);
+  ui_format_time_ms(timeBuf, sizeof(timeBuf), gSessionMs);
   snprintf(line, sizeof(line), "Session: %s", timeBuf);
   Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 202, line, &Font16, WHITE, BLACK);
 
@@ -547,15 +574,15 @@ static void DrawFinishedScreen() {
   snprintf(line, sizeof(line), "Laps %u", (unsigned)gSelectedLaps);
   Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 22, line, &Font16, WHITE, BLACK);
 
-  FormatTimeMaybe(timeBuf, sizeof(timeBuf), run.valid, run.totalMs);
+  ui_format_time_ms_maybe(timeBuf, sizeof(timeBuf), run.valid, run.totalMs);
   DrawCenteredText(UI_MARGIN, UI_SECTION_Y + 52, LOGICAL_W - (UI_MARGIN * 2), 40, timeBuf, &Font24, WHITE, BLACK);
   Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 96, "Total Time", &Font16, WHITE, BLACK);
 
-  FormatTimeMaybe(timeBuf, sizeof(timeBuf), run.valid, run.bestMs);
+  ui_format_time_ms_maybe(timeBuf, sizeof(timeBuf), run.valid, run.bestMs);
   snprintf(line, sizeof(line), "Best:  %s", timeBuf);
   Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 122, line, &Font16, WHITE, BLACK);
 
-  FormatTimeMaybe(timeBuf, sizeof(timeBuf), run.valid, run.avgMs);
+  ui_format_time_ms_maybe(timeBuf, sizeof(timeBuf), run.valid, run.avgMs);
   snprintf(line, sizeof(line), "Avg:   %s", timeBuf);
   Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 144, line, &Font16, WHITE, BLACK);
 
@@ -574,15 +601,15 @@ static void DrawStatsScreen() {
   DrawHeader("Run Stats");
 
   char timeBuf[24];
-  FormatTimeMaybe(timeBuf, sizeof(timeBuf), selected.valid, selected.totalMs);
+  ui_format_time_ms_maybe(timeBuf, sizeof(timeBuf), selected.valid, selected.totalMs);
   snprintf(line, sizeof(line), "Total: %s", timeBuf);
   Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y, line, &Font16, WHITE, BLACK);
 
-  FormatTimeMaybe(timeBuf, sizeof(timeBuf), selected.valid, selected.bestMs);
+  ui_format_time_ms_maybe(timeBuf, sizeof(timeBuf), selected.valid, selected.bestMs);
   snprintf(line, sizeof(line), "Best:  %s", timeBuf);
   Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 22, line, &Font16, WHITE, BLACK);
 
-  FormatTimeMaybe(timeBuf, sizeof(timeBuf), selected.valid, selected.avgMs);
+  ui_format_time_ms_maybe(timeBuf, sizeof(timeBuf), selected.valid, selected.avgMs);
   snprintf(line, sizeof(line), "Avg:   %s", timeBuf);
   Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 44, line, &Font16, WHITE, BLACK);
 
@@ -597,7 +624,7 @@ static void DrawStatsScreen() {
     RunStats &other = gDriverRuns[compareDriver - 1];
     snprintf(line, sizeof(line), "Driver %u", (unsigned)compareDriver);
     Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 102, line, &Font16, WHITE, BLACK);
-    FormatTimeMaybe(timeBuf, sizeof(timeBuf), other.valid, other.bestMs);
+    ui_format_time_ms_maybe(timeBuf, sizeof(timeBuf), other.valid, other.bestMs);
     snprintf(line, sizeof(line), "Best: %s", timeBuf);
     Paint_DrawString_EN(UI_MARGIN, UI_SECTION_Y + 124, line, &Font16, WHITE, BLACK);
   } else {
@@ -827,6 +854,9 @@ static bool ReactionPollImu(uint32_t now, float &accelDeltaG, float &gyroDps) {
   float gy = 0.0f;
   float gz = 0.0f;
 
+#if USE_LVGL_UI
+  ui_tile_activity_note(UI_TILE_SUBSYSTEM_IMU_READ);
+#endif
   if (!imu_qmi8658_read_accel(ax, ay, az)) return false;
   imu_qmi8658_read_gyro(gx, gy, gz);
 
@@ -961,6 +991,8 @@ static void HandleReactionSwipeRight() {
 
 static void HandleTileChange(LvTimeAttackTile tile) {
   ReactionSetModeActive(tile == LV_TIME_ATTACK_TILE_REACTION);
+  // Reaction snapshots are only built while the tile is visible; catch up on entry.
+  gReactionUiDirty = true;
 }
 
 static void HandleMainSwipeLeft() {
@@ -977,6 +1009,266 @@ static void HandleMainSwipeRight() {
 static void HandleReactionTap() {
   gReactionActionPending = true;
 }
+
+#if DISP_STATS_DEBUG
+static void LogDisplayStats() {
+  LvPortDispStats stats{};
+  lv_port_disp_take_stats(stats);
+  if (stats.windowUs == 0) return;
+  const uint32_t avgFrameMs = stats.frames ? (stats.frameMsTotal / stats.frames) : 0;
+  const uint32_t fpsX10 = (uint32_t)((uint64_t)stats.frames * 10000000ULL / stats.windowUs);
+  const uint32_t stallX10 = (uint32_t)((uint64_t)stats.stallUs * 1000ULL / stats.windowUs);
+  const uint32_t pxPerSec = (uint32_t)((uint64_t)stats.pixels * 1000000ULL / stats.windowUs);
+  const uint32_t cmdUsPerArea = stats.areas ? (stats.cmdUs / stats.areas) : 0;
+  const uint32_t payloadUsPerArea = stats.areas ? (stats.dmaUs / stats.areas) : 0;
+  const uint32_t payloadMbPerSecX100 =
+      stats.dmaUs ? (uint32_t)((uint64_t)stats.pixels * 2ULL * 100ULL / stats.dmaUs) : 0;
+  Serial.printf("DISP fps=%lu.%lu frame_ms avg=%lu max=%lu flushes=%lu bursts=%lu px=%lu px_s=%lu rotate_ms=%lu dma_ms=%lu stall=%lu.%lu%%\n",
+                (unsigned long)(fpsX10 / 10), (unsigned long)(fpsX10 % 10),
+                (unsigned long)avgFrameMs, (unsigned long)stats.frameMsMax,
+                (unsigned long)stats.flushes, (unsigned long)stats.bursts,
+                (unsigned long)stats.pixels, (unsigned long)pxPerSec,
+                (unsigned long)(stats.rotateUs / 1000), (unsigned long)(stats.dmaUs / 1000),
+                (unsigned long)(stallX10 / 10), (unsigned long)(stallX10 % 10));
+  Serial.printf("DISP areas=%lu cmd_us/area=%lu payload_us/area=%lu payload_MB_s=%lu.%02lu\n",
+                (unsigned long)stats.areas, (unsigned long)cmdUsPerArea,
+                (unsigned long)payloadUsPerArea,
+                (unsigned long)(payloadMbPerSecX100 / 100), (unsigned long)(payloadMbPerSecX100 % 100));
+  if (stats.fills) {
+    Serial.printf("DISP dma_fill n=%lu px=%lu dma_px=%lu\n", (unsigned long)stats.fills,
+                  (unsigned long)stats.fillPixels, (unsigned long)stats.fillByDma);
+  }
+  if (stats.blends) {
+    Serial.printf("DISP simd_blend n=%lu px=%lu\n", (unsigned long)stats.blends,
+                  (unsigned long)stats.blendPixels);
+  }
+  if (stats.events) {
+    Serial.printf("DISP lap_to_panel n=%lu avg_us=%lu max_us=%lu\n",
+                  (unsigned long)stats.events, (unsigned long)(stats.eventUsTotal / stats.events),
+                  (unsigned long)stats.eventUsMax);
+  }
+
+  UiPriorityAreaStats priority{};
+  ui_priority_area_take_stats(priority);
+  Serial.printf("UI priority frames=%lu background=%lu held_areas=%lu held_px=%lu\n",
+                (unsigned long)priority.priorityFrames, (unsigned long)priority.backgroundFrames,
+                (unsigned long)priority.heldAreas, (unsigned long)priority.heldPixels);
+
+  UiPanelScrollStats panelScroll{};
+  ui_panel_scroll_take_stats(panelScroll);
+  if (panelScroll.transitions) {
+    Serial.printf("UI panel_scroll transitions=%lu band_frames=%lu band_px=%lu full_px=%lu "
+                  "saved_kb=%lu\n",
+                  (unsigned long)panelScroll.transitions, (unsigned long)panelScroll.bandFrames,
+                  (unsigned long)panelScroll.bandPixels, (unsigned long)panelScroll.fullPixels,
+                  (unsigned long)((panelScroll.fullPixels - panelScroll.bandPixels) * 2 / 1024));
+  }
+
+  UiBindStats bind{};
+  ui_bind_take_stats(bind);
+  Serial.printf("UI bind applied=%lu skipped=%lu\n",
+                (unsigned long)bind.applied, (unsigned long)bind.skipped);
+
+  UiTileActivity tiles[kUiTileCount];
+  ui_tile_activity_take(tiles);
+  for (uint8_t t = 0; t < kUiTileCount; ++t) {
+    if (tiles[t].visibleMs == 0 && tiles[t].builds == 0 && tiles[t].teardowns == 0) continue;
+    Serial.printf("UI tile=%s visible_ms=%lu builds=%lu teardowns=%lu build_bytes=%lu heap_peak=%lu",
+                  ui_tile_activity_tile_name(t), (unsigned long)tiles[t].visibleMs,
+                  (unsigned long)tiles[t].builds, (unsigned long)tiles[t].teardowns,
+                  (unsigned long)tiles[t].buildBytes, (unsigned long)tiles[t].heapPeak);
+    for (uint8_t sub = 0; sub < UI_TILE_SUBSYSTEM_COUNT; ++sub) {
+      Serial.printf(" %s=%lu", ui_tile_activity_subsystem_name(sub),
+                    (unsigned long)tiles[t].runs[sub]);
+    }
+    Serial.printf("\n");
+  }
+
+  UiRefreshModeStats refresh[UI_REFRESH_MODE_COUNT];
+  ui_refresh_take_stats(refresh);
+  for (uint8_t m = 0; m < UI_REFRESH_MODE_COUNT; ++m) {
+    if (refresh[m].ms == 0) continue;
+    const uint32_t modeFpsX10 = (uint32_t)((uint64_t)refresh[m].frames * 10000ULL / refresh[m].ms);
+    const uint32_t busyX10 = (uint32_t)((uint64_t)refresh[m].busyUs / refresh[m].ms);
+    const uint32_t headroomX10 = busyX10 < 1000 ? 1000 - busyX10 : 0;
+    Serial.printf("REFRESH mode=%s ms=%lu frames=%lu fps=%lu.%lu busy=%lu.%lu%% headroom=%lu.%lu%%\n",
+                  ui_refresh_mode_name(m), (unsigned long)refresh[m].ms,
+                  (unsigned long)refresh[m].frames,
+                  (unsigned long)(modeFpsX10 / 10), (unsigned long)(modeFpsX10 % 10),
+                  (unsigned long)(busyX10 / 10), (unsigned long)(busyX10 % 10),
+                  (unsigned long)(headroomX10 / 10), (unsigned long)(headroomX10 % 10));
+  }
+
+  lv_time_attack_ui_set_perf_kpx(pxPerSec / 1000);
+}
+#endif
+#endif
+
+#if USE_LVGL_UI && DISP_RENDER_BENCH
+static void SettleLvgl(uint32_t ms) {
+  const uint32_t start = millis();
+  uint32_t last = start;
+  while (millis() - start < ms) {
+    const uint32_t now = millis();
+    lv_tick_inc(now - last);
+    last = now;
+    lv_timer_handler();
+  }
+}
+
+static void BenchRenderTile(const char *name, void (*show)()) {
+  static const uint32_t kFrames = 30;
+  show();
+  SettleLvgl(1000);
+
+  uint32_t totalUs = 0;
+  uint32_t maxUs = 0;
+  for (uint32_t i = 0; i < kFrames; ++i) {
+    lv_obj_invalidate(lv_scr_act());
+    const uint32_t startUs = micros();
+    lv_refr_now(nullptr);
+    const uint32_t us = micros() - startUs;
+    totalUs += us;
+    if (us > maxUs) maxUs = us;
+  }
+  Serial.printf("RENDER tile=%s swap=%d frames=%lu avg_us=%lu max_us=%lu\n",
+                name, (int)LV_COLOR_16_SWAP, (unsigned long)kFrames,
+                (unsigned long)(totalUs / kFrames), (unsigned long)maxUs);
+}
+
+// Fills a w x h rectangle at column x of a draw-buffer-sized buffer, first the way
+// LVGL's software blend fills an opaque, unmasked rectangle (lv_color_fill() per row),
+// then with dma_fill_rect(), and prints the CPU cycles each took per pixel.
+static void BenchFill(int32_t x, int32_t w, int32_t h) {
+  static const uint32_t kReps = 50;
+  static const int32_t kStride = LVGL_LOGICAL_W;
+  alignas(4) static lv_color_t buf[LVGL_LOGICAL_W * 80];
+  const lv_color_t color = lv_color_hex(0x1E88E5);
+
+  uint32_t startUs = micros();
+  for (uint32_t r = 0; r < kReps; ++r) {
+    lv_color_t *row = buf + x;
+    for (int32_t y = 0; y < h; ++y, row += kStride) lv_color_fill(row, color, w);
+  }
+  const uint32_t swUs = micros() - startUs;
+
+  startUs = micros();
+  for (uint32_t r = 0; r < kReps; ++r) {
+    dma_fill_rect((uint16_t *)(buf + x), kStride, w, h, color.full);
+  }
+  const uint32_t dmaUs = micros() - startUs;
+
+  const uint64_t pixels = (uint64_t)kReps * w * h;
+  const uint64_t cyclesPerUs = rp2040.f_cpu() / 1000000;
+  const uint32_t swX100 = (uint32_t)((uint64_t)swUs * cyclesPerUs * 100 / pixels);
+  const uint32_t dmaX100 = (uint32_t)((uint64_t)dmaUs * cyclesPerUs * 100 / pixels);
+  Serial.printf("FILL x=%ld w=%ld h=%ld sw_cyc_px=%lu.%02lu dma_cyc_px=%lu.%02lu\n",
+                (long)x, (long)w, (long)h,
+                (unsigned long)(swX100 / 100), (unsigned long)(swX100 % 100),
+                (unsigned long)(dmaX100 / 100), (unsigned long)(dmaX100 % 100));
+}
+
+// Blends a w x h rectangle into a draw-buffer-sized buffer, first through LVGL's
+// lv_draw_sw_blend_basic() on a draw context covering that buffer, then with the
+// rgb565_blend kernels, and prints the CPU cycles each took per pixel. map: a source
+// image (the glow sprites), otherwise a solid colour; masked: through an anti-aliased
+// text-like mask (60% empty, 25% solid, the rest edges). One blend each over the same
+// background is compared first; same=0 means the kernels differ from this LVGL build.
+static void BenchBlend(const char *name, bool map, bool masked, int32_t w, int32_t h,
+                       lv_opa_t opa) {
+  static const uint32_t kReps = 20;
+  static const int32_t kStride = LVGL_LOGICAL_W;
+  alignas(4) static lv_color_t buf[LVGL_LOGICAL_W * 80];
+  alignas(4) static lv_color_t kern[LVGL_LOGICAL_W * 80];
+  alignas(4) static lv_color_t src[LVGL_LOGICAL_W * 80];
+  alignas(4) static lv_opa_t mask[LVGL_LOGICAL_W * 80];
+  uint32_t seed = 1;
+  for (int32_t i = 0; i < w * h; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    const uint32_t r = (seed >> 16) % 100;
+    mask[i] = r < 60 ? 0 : r < 85 ? LV_OPA_COVER : (lv_opa_t)(1 + (seed >> 8) % 254);
+    src[i].full = (uint16_t)seed;
+  }
+  for (int32_t i = 0; i < kStride * 80; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    buf[i].full = (uint16_t)(seed >> 16);
+  }
+  memcpy(kern, buf, sizeof(kern));
+  const lv_color_t color = lv_color_hex(0x1E88E5);
+
+  lv_area_t bufArea = {0, 0, (lv_coord_t)(kStride - 1), 79};
+  lv_area_t area = {0, 0, (lv_coord_t)(w - 1), (lv_coord_t)(h - 1)};
+  lv_draw_ctx_t ctx{};
+  ctx.buf = buf;
+  ctx.buf_area = &bufArea;
+  ctx.clip_area = &area;
+  lv_draw_sw_blend_dsc_t dsc{};
+  dsc.blend_area = &area;
+  dsc.src_buf = map ? src : nullptr;
+  dsc.color = color;
+  dsc.mask_buf = masked ? mask : nullptr;
+  dsc.mask_res = masked ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
+  dsc.mask_area = &area;
+  dsc.opa = opa;
+  dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+  const lv_opa_t *m = masked ? mask : nullptr;
+  auto kernels = [&] {
+    if (map) {
+      rgb565_blend_map((uint16_t *)kern, kStride, w, h, (const uint16_t *)src, w, m, w, opa);
+    } else {
+      rgb565_blend_fill_mask((uint16_t *)kern, kStride, w, h, color.full, m, w, opa);
+    }
+  };
+
+  // lv_draw_sw_blend_basic() looks up the display being refreshed.
+  _lv_refr_set_disp_refreshing(lv_disp_get_default());
+  lv_draw_sw_blend_basic(&ctx, &dsc);
+  kernels();
+  const bool same = memcmp(buf, kern, sizeof(buf)) == 0;
+
+  uint32_t startUs = micros();
+  for (uint32_t r = 0; r < kReps; ++r) lv_draw_sw_blend_basic(&ctx, &dsc);
+  const uint32_t lvglUs = micros() - startUs;
+  _lv_refr_set_disp_refreshing(nullptr);
+
+  startUs = micros();
+  for (uint32_t r = 0; r < kReps; ++r) kernels();
+  const uint32_t simdUs = micros() - startUs;
+
+  const uint64_t pixels = (uint64_t)kReps * w * h;
+  const uint64_t cyclesPerUs = rp2040.f_cpu() / 1000000;
+  const uint32_t lvglX100 = (uint32_t)((uint64_t)lvglUs * cyclesPerUs * 100 / pixels);
+  const uint32_t simdX100 = (uint32_t)((uint64_t)simdUs * cyclesPerUs * 100 / pixels);
+  Serial.printf("BLEND case=%s w=%ld h=%ld opa=%u same=%d lvgl_cyc_px=%lu.%02lu "
+                "simd_cyc_px=%lu.%02lu\n",
+                name, (long)w, (long)h, (unsigned)opa, (int)same,
+                (unsigned long)(lvglX100 / 100), (unsigned long)(lvglX100 % 100),
+                (unsigned long)(simdX100 / 100), (unsigned long)(simdX100 % 100));
+}
+
+static void RunRenderBench() {
+  lv_port_disp_set_dry_run(true);
+  BenchRenderTile("race", lv_time_attack_ui_show_race_tile);
+  BenchRenderTile("gforce", lv_time_attack_ui_show_gforce_tile);
+  dma_fill_init();
+  BenchFill(0, LVGL_LOGICAL_W, 80);  // A whole draw buffer: one run.
+  BenchFill(0, 320, 56);             // Lap clock background, one run per row.
+  BenchFill(1, 180, 44);             // Odd start column: CPU head pixel per row.
+  BenchFill(0, 40, 40);              // Rows below kRgb565FillMinWords: all CPU.
+  BenchBlend("text", false, true, 320, 56, LV_OPA_COVER);      // Lap clock digits.
+  BenchBlend("text_opa50", false, true, 320, 56, LV_OPA_50);
+  BenchBlend("glow_sprite", true, true, 64, 64, LV_OPA_COVER);  // ui_glow_sprite.h.
+  BenchBlend("sprite_opa50", true, true, 64, 64, LV_OPA_50);
+  BenchBlend("image_opa50", true, false, LVGL_LOGICAL_W, 80, LV_OPA_50);
+  // LV_OPA_MAX, where masked fills and images switch to the mask alone at different opacities.
+  BenchBlend("text_opa_max", false, true, 320, 56, LV_OPA_MAX);
+  BenchBlend("sprite_opa_max", true, true, 64, 64, LV_OPA_MAX);
+  lv_time_attack_ui_show_race_tile();
+  SettleLvgl(1000);
+  lv_port_disp_set_dry_run(false);
+  lv_obj_invalidate(lv_scr_act());
+}
 #endif
 
 // ----------------- Arduino -----------------
@@ -997,7 +1289,6 @@ void setup() {
 
   QSPI_GPIO_Init(qspi);
   QSPI_PIO_Init(qspi);
-  QSPI_1Wrie_Mode(&qspi);
 
   AMOLED_1IN64_Init();
   AMOLED_1IN64_SetBrightness(100);
@@ -1065,6 +1356,7 @@ void setup() {
 #else
   lv_init();
   lv_port_disp_init();
+  ui_refresh_init(lv_disp_get_default());
   lv_port_indev_init();
   lv_time_attack_ui_init(HandleStartStop,
                          HandleReset,
@@ -1086,6 +1378,10 @@ void setup() {
   gState = UI_IDLE;
   ReactionSetModeActive(false);
   RenderState();
+
+#if USE_LVGL_UI && DISP_RENDER_BENCH
+  RunRenderBench();
+#endif
 }
 
 void loop() {
@@ -1099,10 +1395,14 @@ void loop() {
     lv_tick_inc(delta);
     lastTick = now;
   }
+#if LVGL_FULL_INVALIDATE
   if (!screen_nav_is_transitioning()) {
     lv_obj_invalidate(lv_scr_act());
   }
+#endif
+  const uint32_t lvglStartUs = micros();
   lv_timer_handler();
+  uint32_t uiBusyUs = micros() - lvglStartUs;
 #else
   uint32_t now = millis();
 #endif
@@ -1153,11 +1453,17 @@ void loop() {
 #endif
   }
   uint32_t irMs = now;
+#if USE_LVGL_UI
+  uint32_t irUs = micros();
+#endif
   bool irTrigger = false;
   bool signalActive = (digitalRead(IR_IN_PIN) == LOW);
   if (gIrSeen) {
     noInterrupts();
     irMs = gIrSeenMs;
+#if USE_LVGL_UI
+    irUs = gIrSeenUs;
+#endif
     gIrSeen = false;
     interrupts();
     signalActive = true;
@@ -1201,6 +1507,10 @@ void loop() {
         gBestLapMs = gLastLapMs;
       }
       gDeltaMs = (int32_t)gLastLapMs - (int32_t)gBestLapMs;
+#if USE_LVGL_UI
+      gLapPanelUs = irUs;
+      gLapPanelPending = true;
+#endif
 
       Serial.printf("LAP %u time=%lu ms\n", (unsigned)gLapCount, (unsigned long)gLastLapMs);
       sd_logger_log_lap(gSelectedDriver,
@@ -1236,7 +1546,8 @@ void loop() {
   }
 
 #if USE_LVGL_UI
-  if (gUiDirty || (uint32_t)(now - gLastLvglUiMs) >= LVGL_UI_REFRESH_MS) {
+  const uint32_t snapshotStartUs = micros();
+  if (gUiDirty || (uint32_t)(now - gLastLvglUiMs) >= ui_refresh_snapshot_ms()) {
     gLastLvglUiMs = now;
     gUiDirty = false;
     UiSnapshot snapshot{};
@@ -1265,10 +1576,14 @@ void loop() {
       snapshot.currentLapMs = 0;
     }
     lv_time_attack_ui_update(snapshot);
+    if (gLapPanelPending) {
+      gLapPanelPending = false;
+      lv_port_disp_mark_event(gLapPanelUs);
+    }
   }
 
-  if (gReactionModeActive &&
-      (gReactionUiDirty || (uint32_t)(now - gLastReactionUiMs) >= LVGL_UI_REFRESH_MS)) {
+  if (lv_time_attack_ui_get_visible_tile() == LV_TIME_ATTACK_TILE_REACTION &&
+      (gReactionUiDirty || (uint32_t)(now - gLastReactionUiMs) >= ui_refresh_snapshot_ms())) {
     gLastReactionUiMs = now;
     gReactionUiDirty = false;
     ReactionUiSnapshot reactionSnapshot{};
@@ -1296,6 +1611,17 @@ void loop() {
     reactionSnapshot.bestReactionMs = gReactionBestMs;
     screen_reaction_update(reactionSnapshot);
   }
+  uiBusyUs += micros() - snapshotStartUs;
+  ui_refresh_add_busy_us(uiBusyUs);
+  ui_refresh_update(now, gState, gReactionState);
+
+#if DISP_STATS_DEBUG
+  static uint32_t lastDispStatsMs = 0;
+  if ((uint32_t)(now - lastDispStatsMs) >= DISP_STATS_INTERVAL_MS) {
+    lastDispStatsMs = now;
+    LogDisplayStats();
+  }
+#endif
 #endif
 
 #if !USE_LVGL_UI
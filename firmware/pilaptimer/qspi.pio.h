@@ -8,84 +8,74 @@
 #include "hardware/pio.h"
 #endif
 
-// --------------- //
-// qspi_4wire_data //
-// --------------- //
+// -------- //
+// qspi_txn //
+// -------- //
 
-#define qspi_4wire_data_wrap_target 0
-#define qspi_4wire_data_wrap 1
-#define qspi_4wire_data_pio_version 0
+#define qspi_txn_wrap_target 4
+#define qspi_txn_wrap 23
+#define qspi_txn_pio_version 0
 
-static const uint16_t qspi_4wire_data_program_instructions[] = {
-            //     .wrap_target
-    0x7004, //  0: out    pins, 4         side 0
-    0xb842, //  1: nop                    side 1
-            //     .wrap
-};
-
-#if !PICO_NO_HARDWARE
-static const struct pio_program qspi_4wire_data_program = {
-    .instructions = qspi_4wire_data_program_instructions,
-    .length = 2,
-    .origin = -1,
-    .pio_version = qspi_4wire_data_pio_version,
-#if PICO_PIO_VERSION > 0
-    .used_gpio_ranges = 0x0
-#endif
-};
-
-static inline pio_sm_config qspi_4wire_data_program_get_default_config(uint offset) {
-    pio_sm_config c = pio_get_default_sm_config();
-    sm_config_set_wrap(&c, offset + qspi_4wire_data_wrap_target, offset + qspi_4wire_data_wrap);
-    sm_config_set_sideset(&c, 2, true, false);
-    return c;
-}
-#endif
-
-// --------------- //
-// qspi_1write_cmd //
-// --------------- //
+#define qspi_txn_offset_header 4u
 
-#define qspi_1write_cmd_wrap_target 0
-#define qspi_1write_cmd_wrap 1
-#define qspi_1write_cmd_pio_version 0
-
-static const uint16_t qspi_1write_cmd_program_instructions[] = {
+static const uint16_t qspi_txn_program_instructions[] = {
+    0xe047, //  0: set    y, 7
+    0x7001, //  1: out    pins, 1         side 0
+    0x1881, //  2: jmp    y--, 1          side 1
+    0x0040, //  3: jmp    x--, 0
             //     .wrap_target
-    0x7001, //  0: out    pins, 1         side 0
-    0xb842, //  1: nop                    side 1
+    0x80a0, //  4: pull   block
+    0x6042, //  5: out    y, 2
+    0x603e, //  6: out    x, 30
+    0x0060, //  7: jmp    !y, 0
+    0x0089, //  8: jmp    y--, 9
+    0x0074, //  9: jmp    !y, 20
+    0x6070, // 10: out    null, 16
+    0x7004, // 11: out    pins, 4         side 0
+    0xb842, // 12: nop                    side 1
+    0x7004, // 13: out    pins, 4         side 0
+    0xb842, // 14: nop                    side 1
+    0x7004, // 15: out    pins, 4         side 0
+    0xb842, // 16: nop                    side 1
+    0x7004, // 17: out    pins, 4         side 0
+    0x184a, // 18: jmp    x--, 10         side 1
+    0x0004, // 19: jmp    4
+    0x7004, // 20: out    pins, 4         side 0
+    0xb842, // 21: nop                    side 1
+    0x7004, // 22: out    pins, 4         side 0
+    0x1854, // 23: jmp    x--, 20         side 1
             //     .wrap
 };
 
 #if !PICO_NO_HARDWARE
-static const struct pio_program qspi_1write_cmd_program = {
-    .instructions = qspi_1write_cmd_program_instructions,
-    .length = 2,
+static const struct pio_program qspi_txn_program = {
+    .instructions = qspi_txn_program_instructions,
+    .length = 24,
     .origin = -1,
-    .pio_version = qspi_1write_cmd_pio_version,
+    .pio_version = qspi_txn_pio_version,
 #if PICO_PIO_VERSION > 0
     .used_gpio_ranges = 0x0
 #endif
 };
 
-static inline pio_sm_config qspi_1write_cmd_program_get_default_config(uint offset) {
+static inline pio_sm_config qspi_txn_program_get_default_config(uint offset) {
     pio_sm_config c = pio_get_default_sm_config();
-    sm_config_set_wrap(&c, offset + qspi_1write_cmd_wrap_target, offset + qspi_1write_cmd_wrap);
+    sm_config_set_wrap(&c, offset + qspi_txn_wrap_target, offset + qspi_txn_wrap);
     sm_config_set_sideset(&c, 2, true, false);
     return c;
 }
 
 #include "hardware/clocks.h"
 #include "hardware/gpio.h"
-static inline void qspi_4wire_data_program_init(PIO pio, uint sm, uint offset, uint pin_scl, uint out_base, uint out_pin_num) {
-    pio_sm_config c = qspi_4wire_data_program_get_default_config( offset );  
+static inline void qspi_txn_program_init(PIO pio, uint sm, uint offset, uint pin_scl, uint out_base, uint out_pin_num) {
+    pio_sm_config c = qspi_txn_program_get_default_config( offset );
     // CLK
     pio_gpio_init(pio, pin_scl);
     pio_sm_set_consecutive_pindirs(pio, sm, pin_scl, 1, true);
     sm_config_set_sideset_pins(&c, pin_scl);
-    // DAT
+    // DAT: 1-wire phases drive DIO0 and hold DIO1..3 low
     sm_config_set_out_pins(&c, out_base, out_pin_num);
-    sm_config_set_out_shift(&c, false, true, 8);
+    sm_config_set_out_shift(&c, false, true, 32);
     for (uint32_t pin_offset = 0; pin_offset < out_pin_num; pin_offset++) {
         pio_gpio_init(pio, out_base + pin_offset);
     }
@@ -93,30 +83,9 @@ static inline void qspi_4wire_data_program_init(PIO pio, uint sm, uint offset, u
     // PIO CLK
     sm_config_set_clkdiv( &c, 1.0f);
     // INIT
-    pio_sm_init( pio, sm, offset, &c );
-    pio_sm_clear_fifos( pio , sm);
-    pio_sm_set_enabled( pio, sm, true );
-}
-static inline void qspi_1write_cmd_program_init(PIO pio, uint sm, uint offset, uint pin_scl, uint out_base, uint out_pin_num) {
-    pio_sm_config c = qspi_1write_cmd_program_get_default_config( offset );
-    // CLK
-    pio_gpio_init(pio, pin_scl);
-    pio_sm_set_consecutive_pindirs(pio, sm, pin_scl, 1, true);
-    sm_config_set_sideset_pins(&c, pin_scl);
-    // DAT
-    sm_config_set_out_pins(&c, out_base, out_pin_num);
-    sm_config_set_out_shift(&c, false, true, 8);
-    for (uint32_t pin_offset = 0; pin_offset < out_pin_num; pin_offset++) {
-        pio_gpio_init(pio, out_base + pin_offset);
-    }
-    pio_sm_set_consecutive_pindirs(pio, sm, out_base, out_pin_num, true);
-    // PIO CLK
-    sm_config_set_clkdiv( &c, 1.0f);
-    // INIT
-    pio_sm_init( pio, sm, offset, &c );
+    pio_sm_init( pio, sm, offset + qspi_txn_offset_header, &c );
     pio_sm_clear_fifos( pio , sm);
     pio_sm_set_enabled( pio, sm, true );
 }
 
 #endif
-
@@ -0,0 +1,115 @@
+#include "qspi_cmdlist.h"
+
+#include <stdint.h>
+#include <string.h>
+
+// CO5300 QSPI opcodes, see QSPI_REGISTER_Write()/QSPI_Pixel_Write().
+#define QSPI_OP_REGISTER_WRITE 0x02
+#define QSPI_OP_PIXEL_WRITE    0x32
+
+static uint8_t *QSPI_CmdList_Reserve(qspi_cmdlist_t *list, uint32_t len, uint8_t segments){
+    if(list->byte_count + len > QSPI_CMDLIST_MAX_BYTES) return nullptr;
+    if(list->seg_count + segments > QSPI_CMDLIST_MAX_SEGMENTS) return nullptr;
+    uint8_t *out = &list->bytes[list->byte_count];
+    list->byte_count += len;
+    return out;
+}
+
+static void QSPI_CmdList_AddSegment(qspi_cmdlist_t *list, const uint8_t *data, uint32_t len,
+                                    uint8_t flags){
+    qspi_segment_t *seg = &list->seg[list->seg_count++];
+    seg->data = data;
+    seg->len = len;
+    seg->flags = flags;
+}
+
+/******************************************************************************
+function : Reset a command list to empty
+parameter:
+    list : command list
+******************************************************************************/
+void QSPI_CmdList_Init(qspi_cmdlist_t *list){
+    list->byte_count = 0;
+    list->seg_count = 0;
+}
+
+/******************************************************************************
+function : Append a 1-wire register write with its parameters
+parameter:
+    list        : command list
+    reg         : register address
+    params      : parameter bytes (may be NULL when param_count is 0)
+    param_count : number of parameter bytes
+******************************************************************************/
+bool QSPI_CmdList_Register(qspi_cmdlist_t *list, uint8_t reg,
+                           const uint8_t *params, uint8_t param_count){
+    if(param_count > QSPI_CMDLIST_MAX_PARAMS) return false;
+    const uint32_t count = 4 + param_count;
+    const uint32_t len = QSPI_TXN_HEADER_BYTES + 4 * QSPI_Txn_Words(count);
+    uint8_t *out = QSPI_CmdList_Reserve(list, len, 1);
+    if(!out) return false;
+
+    QSPI_Txn_Header(out, QSPI_TXN_1WIRE, count);
+    uint8_t *cmd = out + QSPI_TXN_HEADER_BYTES;
+    cmd[0] = QSPI_OP_REGISTER_WRITE;
+    cmd[1] = 0x00;
+    cmd[2] = reg;
+    cmd[3] = 0x00;
+    if(param_count) memcpy(&cmd[4], params, param_count);
+    memset(&cmd[count], 0, len - QSPI_TXN_HEADER_BYTES - count);
+
+    QSPI_CmdList_AddSegment(list, out, len, QSPI_SEG_SELECT | QSPI_SEG_DESELECT);
+    return true;
+}
+
+// RAMWR-style header (1-wire 32 00 reg 00) followed by the payload phase header.
+static bool QSPI_CmdList_PixelPhase(qspi_cmdlist_t *list, uint8_t reg, uint32_t mode,
+                                    const void *data, uint32_t count, uint32_t len,
+                                    uint8_t payload_flags){
+    uint8_t *out = QSPI_CmdList_Reserve(list, 2 * QSPI_TXN_HEADER_BYTES + 4, 2);
+    if(!out) return false;
+
+    QSPI_Txn_Header(out, QSPI_TXN_1WIRE, 4);
+    uint8_t *cmd = out + QSPI_TXN_HEADER_BYTES;
+    cmd[0] = QSPI_OP_PIXEL_WRITE;
+    cmd[1] = 0x00;
+    cmd[2] = reg;
+    cmd[3] = 0x00;
+    QSPI_Txn_Header(cmd + 4, mode, count);
+
+    // Command words and payload are one PIO word stream; the executor chains the two DMA
+    // transfers so nothing runs on the CPU between them.
+    QSPI_CmdList_AddSegment(list, out, 2 * QSPI_TXN_HEADER_BYTES + 4, QSPI_SEG_SELECT);
+    QSPI_CmdList_AddSegment(list, (const uint8_t *)data, len, QSPI_SEG_DESELECT | payload_flags);
+    return true;
+}
+
+/******************************************************************************
+function : Append a pixel write: 1-wire header then 4-wire payload, one CS frame
+parameter:
+    list : command list
+    reg  : RGB pixel interface register address (0x2c = RAMWR)
+    data : payload in bus byte order, streamed in place by DMA (4-byte aligned)
+    len  : payload length in bytes
+******************************************************************************/
+bool QSPI_CmdList_Pixels(qspi_cmdlist_t *list, uint8_t reg, const void *data, uint32_t len){
+    if(len == 0 || len > QSPI_TXN_MAX_COUNT) return false;
+    if((uintptr_t)data & 3) return false;
+    return QSPI_CmdList_PixelPhase(list, reg, QSPI_TXN_4WIRE, data, len, len, 0);
+}
+
+/******************************************************************************
+function : Append a pixel write of native RGB565 pixels, one CS frame
+parameter:
+    list   : command list
+    reg    : RGB pixel interface register address (0x2c = RAMWR)
+    pixels : little-endian RGB565, streamed in place by 16-bit DMA
+    count  : number of pixels
+******************************************************************************/
+bool QSPI_CmdList_Pixels565(qspi_cmdlist_t *list, uint8_t reg, const uint16_t *pixels,
+                            uint32_t count){
+    if(count == 0 || count > QSPI_TXN_MAX_COUNT) return false;
+    if((uintptr_t)pixels & 1) return false;
+    return QSPI_CmdList_PixelPhase(list, reg, QSPI_TXN_RGB565, pixels, count, count * 2,
+                                   QSPI_SEG_RGB565);
+}
@@ -0,0 +1,84 @@
+#ifndef _QSPI_CMDLIST_H_
+#define _QSPI_CMDLIST_H_
+
+#include <stdint.h>
+
+// A QSPI command list is a short sequence of CS-framed transactions that the DMA
+// executor in qspi_pio.cpp streams to the panel without CPU involvement per byte.
+// Everything goes to the single qspi_txn PIO program (qspi.pio) as 32-bit FIFO words;
+// each 1-wire or 4-wire phase is announced in-band by a header word, so a transaction
+// never needs a state machine switch. A transaction is one segment, or a command segment
+// followed by a payload segment that the executor chains in hardware. Byte segments are
+// streamed with 32-bit byte-swapped DMA, so they must start on a 4-byte boundary and
+// are read in whole words; RGB565 segments use 16-bit DMA.
+//
+// Building a list only touches this struct, so the encoding can be checked on the host
+// (firmware/host/check_qspi_cmdlist.cpp).
+
+#define QSPI_CMDLIST_MAX_BYTES    64
+#define QSPI_CMDLIST_MAX_SEGMENTS 8
+#define QSPI_CMDLIST_MAX_PARAMS   8
+
+#define QSPI_SEG_SELECT   0x01  // Drive CS low before the segment
+#define QSPI_SEG_DESELECT 0x02  // Wait for the PIO to go idle and release CS after;
+                                // without it the next segment is chained by DMA
+#define QSPI_SEG_RGB565   0x04  // Native RGB565 pixels, one 16-bit DMA beat each
+
+#define QSPI_TXN_HEADER_BYTES 4
+#define QSPI_TXN_MAX_COUNT    (1u << 30)
+
+// Phase modes understood by qspi_txn (header bits 31..30).
+#define QSPI_TXN_1WIRE  0u  // Bytes on DIO0, four per FIFO word
+#define QSPI_TXN_4WIRE  1u  // Bytes on DIO0..3, four per FIFO word
+#define QSPI_TXN_RGB565 2u  // Native RGB565 pixels on DIO0..3, one per FIFO word (bits 15..0),
+                            // sent high byte first
+
+// Phase header: mode in bits 31..30, count - 1 in bits 29..0. Byte phases are followed by
+// count bytes rounded up to whole words, RGB565 phases by count words.
+static inline uint32_t QSPI_Txn_HeaderWord(uint32_t mode, uint32_t count){
+    return (mode << 30) | ((count - 1) & (QSPI_TXN_MAX_COUNT - 1));
+}
+
+// Header word in bus order, for byte buffers streamed by byte-swapped DMA.
+static inline void QSPI_Txn_Header(uint8_t *out, uint32_t mode, uint32_t count){
+    const uint32_t word = QSPI_Txn_HeaderWord(mode, count);
+    out[0] = (uint8_t)(word >> 24);
+    out[1] = (uint8_t)(word >> 16);
+    out[2] = (uint8_t)(word >> 8);
+    out[3] = (uint8_t)word;
+}
+
+static inline uint32_t QSPI_Txn_Words(uint32_t count){
+    return (count + 3) / 4;
+}
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t len;
+    uint8_t flags;
+} qspi_segment_t;
+
+// Command bytes live in the list itself, so a list must not be copied or moved
+// between building and completion. Pixel payloads are referenced, not copied.
+typedef struct {
+    alignas(4) uint8_t bytes[QSPI_CMDLIST_MAX_BYTES];
+    uint16_t byte_count;
+    qspi_segment_t seg[QSPI_CMDLIST_MAX_SEGMENTS];
+    uint8_t seg_count;
+} qspi_cmdlist_t;
+
+void QSPI_CmdList_Init(qspi_cmdlist_t *list);
+// Same bus bytes as QSPI_REGISTER_Write(reg) + one QSPI_DATA_Write() per parameter, in
+// one CS-framed 1-wire transaction. Returns false (list unchanged) when it does not fit.
+bool QSPI_CmdList_Register(qspi_cmdlist_t *list, uint8_t reg,
+                           const uint8_t *params, uint8_t param_count);
+// Same bus bytes as QSPI_Pixel_Write(reg) followed by a 4-wire burst of len payload
+// bytes, all under one CS assertion. data must be 4-byte aligned and up to 3 bytes past
+// len may be read (and dropped by the PIO); len must not exceed QSPI_TXN_MAX_COUNT.
+bool QSPI_CmdList_Pixels(qspi_cmdlist_t *list, uint8_t reg, const void *data, uint32_t len);
+// As QSPI_CmdList_Pixels(), but for count native (little-endian) RGB565 pixels; the PIO
+// puts them on the bus high byte first, so no CPU byte swap is needed.
+bool QSPI_CmdList_Pixels565(qspi_cmdlist_t *list, uint8_t reg, const uint16_t *pixels,
+                            uint32_t count);
+
+#endif // _QSPI_CMDLIST_H_
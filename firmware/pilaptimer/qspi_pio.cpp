@@ -27,12 +27,13 @@
 # THE SOFTWARE.
 ******************************************************************************/
 #include "qspi_pio.h"
+#include "DEV_Config.h"
 #include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
 pio_qspi_t qspi = {
     .pio = pio0,
     .sm = 0,
-    .sm_4wire = 0,
-    .sm_1wire = 1,
     .pin_cs = PIN_CS,
     .pin_sclk = PIN_SCLK,
     .pin_dio0 = PIN_DIO0,
@@ -71,12 +72,30 @@ void QSPI_Select(pio_qspi_t qspi){
     gpio_put(qspi.pin_cs,0);
 }
 
+/******************************************************************************
+function : Wait until every queued bit has been clocked out
+parameter:
+    qspi : QSPI structure
+Info:
+    qspi_txn stalls on the next header once a phase is complete, so an empty FIFO
+    followed by a fresh TX stall means the bus is idle.
+******************************************************************************/	
+void QSPI_Wait_Idle(pio_qspi_t qspi){
+    const uint32_t stall_mask = 1u << (PIO_FDEBUG_TXSTALL_LSB + qspi.sm);
+    while(!pio_sm_is_tx_fifo_empty(qspi.pio, qspi.sm)){
+    }
+    qspi.pio->fdebug = stall_mask;
+    while(!(qspi.pio->fdebug & stall_mask)){
+    }
+}
+
 /******************************************************************************
 function : QSPI Deselect
 parameter:
     qspi : QSPI structure
 ******************************************************************************/	
 void QSPI_Deselect(pio_qspi_t qspi){
+    QSPI_Wait_Idle(qspi);
     gpio_put(qspi.pin_cs,1);
 }
 
@@ -84,97 +103,269 @@ void QSPI_Deselect(pio_qspi_t qspi){
 function : QSPI PIO initialization
 parameter:
     qspi : QSPI structure
+Info:
+    One state machine runs qspi_txn for both 1-wire command and 4-wire data phases;
+    the other state machines of the PIO block stay free.
 ******************************************************************************/	
 void QSPI_PIO_Init(pio_qspi_t qspi){
-    uint offset = pio_add_program(qspi.pio, &qspi_4wire_data_program);
-    qspi_4wire_data_program_init(qspi.pio, qspi.sm_4wire, offset, PIN_SCLK, PIN_DIO0, 4);
-
-    offset = pio_add_program(qspi.pio, &qspi_1write_cmd_program);
-    qspi_1write_cmd_program_init(qspi.pio, qspi.sm_1wire, offset, PIN_SCLK, PIN_DIO0, 1);
-    pio_sm_clear_fifos(qspi.pio, qspi.sm_1wire);
-
-    pio_sm_set_enabled(qspi.pio, qspi.sm_4wire, false);  
-    pio_sm_set_enabled(qspi.pio, qspi.sm_1wire, false);  
+    uint offset = pio_add_program(qspi.pio, &qspi_txn_program);
+    qspi_txn_program_init(qspi.pio, qspi.sm, offset, PIN_SCLK, PIN_DIO0, 4);
 }
 
 /******************************************************************************
-function : QSPI PIO one-line mode, generally used to send commands
+function : QSPI PIO sends one FIFO word (first bus byte in bits 31..24)
 parameter:
     qspi : QSPI structure
 ******************************************************************************/	
-void QSPI_1Wrie_Mode(pio_qspi_t *qspi){
-    pio_sm_set_enabled(qspi->pio, qspi->sm_4wire, false);  
-    pio_sm_set_enabled(qspi->pio, qspi->sm_1wire, true);  
-    qspi->sm = qspi->sm_1wire;
+static void QSPI_PIO_Write(pio_qspi_t qspi, uint32_t word){
+    pio_sm_put_blocking(qspi.pio, qspi.sm, word);
 }
 
 /******************************************************************************
-function : QSPI PIO four-wire mode, generally used to send data
+function : Announce the next phase to qspi_txn
 parameter:
-    qspi : QSPI structure
+    qspi      : QSPI structure
+    mode  : QSPI_TXN_1WIRE, QSPI_TXN_4WIRE or QSPI_TXN_RGB565
+    count : bytes (pixels for QSPI_TXN_RGB565) that follow, 1 .. QSPI_TXN_MAX_COUNT
+Info:
+    Byte phases follow as QSPI_Txn_Words(count) FIFO words, RGB565 phases as one word
+    per pixel, from blocking writes or from one or more DMA transfers.
 ******************************************************************************/	
-void QSPI_4Wrie_Mode(pio_qspi_t *qspi){
-    pio_sm_set_enabled(qspi->pio, qspi->sm_4wire, true); 
-    pio_sm_set_enabled(qspi->pio, qspi->sm_1wire, false);   
-    qspi->sm = qspi->sm_4wire;
+void QSPI_Phase_Begin(pio_qspi_t qspi, uint32_t mode, uint32_t count){
+    QSPI_PIO_Write(qspi, QSPI_Txn_HeaderWord(mode, count));
 }
 
 /******************************************************************************
-function : QSPI PIO sends data
+function : QSPI PIO 1-wire mode sends data
 parameter:
     qspi : QSPI structure
 ******************************************************************************/	
-static void QSPI_PIO_Write(pio_qspi_t qspi, uint32_t val){
-    pio_sm_put_blocking(qspi.pio, qspi.sm, val << 24);
+void QSPI_DATA_Write(pio_qspi_t qspi, uint32_t val){
+    QSPI_Phase_Begin(qspi, QSPI_TXN_1WIRE, 1);
+    QSPI_PIO_Write(qspi, (val & 0xff) << 24);
 }
 
 /******************************************************************************
-function : QSPI PIO 1-wire mode sends data
+function : QSPI PIO 1-wire mode configuration register
 parameter:
     qspi : QSPI structure
+    addr : Register address
 ******************************************************************************/	
-void QSPI_DATA_Write(pio_qspi_t qspi, uint32_t val){
-    QSPI_PIO_Write(qspi,val);
+void QSPI_REGISTER_Write(pio_qspi_t qspi, uint32_t addr){
+    //1 WIRE CMD + ADDR: 02 00 addr 00
+    QSPI_Phase_Begin(qspi, QSPI_TXN_1WIRE, 4);
+    QSPI_PIO_Write(qspi, 0x02000000u | ((addr & 0xff) << 8));
 }
 
 /******************************************************************************
-function : QSPI PIO 1-wire mode sends data
+function : QSPI RGB pixel interface one line to send address
 parameter:
     qspi : QSPI structure
+    addr : RGB pixel interface register address
+Info:
+    Follow with QSPI_Pixel_Stream(), or QSPI_Phase_Begin() and the pixel data as
+    words.
 ******************************************************************************/	
-void QSPI_CMD_Write(pio_qspi_t qspi, uint32_t val){
-    QSPI_PIO_Write(qspi,val);
+void QSPI_Pixel_Write(pio_qspi_t qspi, uint32_t addr){
+    //1 WIRE CMD + ADDR: 32 00 addr 00
+    QSPI_Phase_Begin(qspi, QSPI_TXN_1WIRE, 4);
+    QSPI_PIO_Write(qspi, 0x32000000u | ((addr & 0xff) << 8));
 }
 
 /******************************************************************************
-function : QSPI PIO 1-wire mode configuration register
+function : Send up to three bytes as their own 4-wire phase from the CPU
+******************************************************************************/	
+static void QSPI_Pixel_Bytes(pio_qspi_t qspi, const uint8_t *data, uint32_t len){
+    if(len == 0) return;
+    uint32_t word = 0;
+    for(uint32_t i = 0; i < len; i++){
+        word |= (uint32_t)data[i] << (24 - 8 * i);
+    }
+    QSPI_Phase_Begin(qspi, QSPI_TXN_4WIRE, len);
+    QSPI_PIO_Write(qspi, word);
+}
+
+/******************************************************************************
+function : Send pixel data in 4-wire mode and wait for the DMA to finish
 parameter:
     qspi : QSPI structure
-    addr : Register address
+    data : pixel bytes in bus order (any alignment)
+    len  : number of bytes
+Info:
+    The word-aligned body goes out as one 32-bit DMA transfer; unaligned head and
+    tail bytes become short phases of their own, so the bus sees the same bytes.
 ******************************************************************************/	
-void QSPI_REGISTER_Write(pio_qspi_t qspi, uint32_t addr){
-    //1 WIRE CMD
-    QSPI_CMD_Write(qspi,0x02);
+void QSPI_Pixel_Stream(pio_qspi_t qspi, const void *data, uint32_t len){
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t head = (4 - ((uintptr_t)p & 3)) & 3;
+    if(head > len) head = len;
+    QSPI_Pixel_Bytes(qspi, p, head);
+    p += head;
+    len -= head;
+
+    const uint32_t body = len & ~3u;
+    if(body){
+        QSPI_Phase_Begin(qspi, QSPI_TXN_4WIRE, body);
+        dma_channel_config cfg = c;
+        channel_config_set_dreq(&cfg, pio_get_dreq(qspi.pio, qspi.sm, true));
+        dma_channel_configure(dma_tx,
+                              &cfg,
+                              &qspi.pio->txf[qspi.sm],  // Destination pointer (PIO TX FIFO)
+                              p,                        // Source pointer (data buffer)
+                              body / 4,                 // Data length (unit: 32-bit words)
+                              true);                    // Start transferring immediately
+        while(dma_channel_is_busy(dma_tx));
+    }
+    QSPI_Pixel_Bytes(qspi, p + body, len - body);
+}
+
+static pio_qspi_t *cmdlist_qspi = nullptr;
+static const qspi_cmdlist_t *cmdlist_active = nullptr;
+static volatile bool cmdlist_busy = false;
+static uint8_t cmdlist_index = 0;
+static qspi_cmdlist_done_t cmdlist_done = nullptr;
+static void *cmdlist_ctx = nullptr;
+static uint32_t cmdlist_payload_start_us = 0;
+static int cmdlist_chain_dma = -1;
+
+// c moves 32-bit words with byte swap, so the first byte in memory is the first byte on
+// the bus, exactly as QSPI_PIO_Write() packs it. RGB565 payloads use 16-bit beats without
+// swap: the write is replicated into both halves and qspi_txn sends bits 15..0.
+static dma_channel_config QSPI_CmdList_SegmentConfig(const qspi_segment_t *seg){
+    dma_channel_config cfg = c;
+    channel_config_set_dreq(&cfg, pio_get_dreq(cmdlist_qspi->pio, cmdlist_qspi->sm, true));
+    if(seg->flags & QSPI_SEG_RGB565){
+        channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+        channel_config_set_bswap(&cfg, false);
+    }
+    return cfg;
+}
 
-    //1 WIRE ADDR
-    QSPI_DATA_Write(qspi,0x00);
-    QSPI_DATA_Write(qspi,addr);
-    QSPI_DATA_Write(qspi,0x00);
+static uint32_t QSPI_CmdList_Transfers(const qspi_segment_t *seg){
+    return (seg->flags & QSPI_SEG_RGB565) ? seg->len / 2 : QSPI_Txn_Words(seg->len);
 }
 
 /******************************************************************************
-function : QSPI RGB pixel interface one line to send address
+function : Start the DMA transfer(s) for the transaction at cmdlist_index
+Info:
+    A segment without QSPI_SEG_DESELECT is chained in hardware to the next one, so
+    the command bytes and the pixel payload reach the PIO as one stream.
+******************************************************************************/
+static void QSPI_CmdList_StartTransaction(void){
+    const qspi_segment_t *seg = &cmdlist_active->seg[cmdlist_index];
+    const bool chained = !(seg->flags & QSPI_SEG_DESELECT) &&
+                         cmdlist_index + 1 < cmdlist_active->seg_count;
+    volatile void *txf = &cmdlist_qspi->pio->txf[cmdlist_qspi->sm];
+
+    if(seg->flags & QSPI_SEG_SELECT){
+        QSPI_Select(*cmdlist_qspi);
+    }
+
+    dma_channel_config head = QSPI_CmdList_SegmentConfig(seg);
+    if(chained){
+        const qspi_segment_t *next = seg + 1;
+        dma_channel_config tail = QSPI_CmdList_SegmentConfig(next);
+        channel_config_set_chain_to(&tail, (uint)cmdlist_chain_dma);
+        dma_channel_configure((uint)cmdlist_chain_dma, &tail, txf, next->data,
+                              QSPI_CmdList_Transfers(next), false);
+
+        channel_config_set_chain_to(&head, (uint)cmdlist_chain_dma);
+        channel_config_set_irq_quiet(&head, true);
+        cmdlist_payload_start_us = time_us_32();
+    }
+    __asm__ volatile("dmb");
+    dma_channel_configure(dma_tx, &head, txf, seg->data, QSPI_CmdList_Transfers(seg), true);
+}
+
+/******************************************************************************
+function : DMA completion: finish the transaction, then start the next or complete
+******************************************************************************/
+static void QSPI_CmdList_IRQ(void){
+    bool fired = false;
+    if(dma_channel_get_irq0_status(dma_tx)){
+        dma_channel_acknowledge_irq0(dma_tx);
+        fired = true;
+    }
+    if(cmdlist_chain_dma >= 0 && dma_channel_get_irq0_status((uint)cmdlist_chain_dma)){
+        dma_channel_acknowledge_irq0((uint)cmdlist_chain_dma);
+        fired = true;
+    }
+    // AMOLED_1IN64_Display/Clear share dma_tx and poll for completion themselves.
+    if(!fired || !cmdlist_busy) return;
+
+    // Skip past the chained payload segment, if any.
+    const qspi_segment_t *seg = &cmdlist_active->seg[cmdlist_index];
+    while(!(seg->flags & QSPI_SEG_DESELECT) && cmdlist_index + 1 < cmdlist_active->seg_count){
+        cmdlist_index++;
+        seg++;
+    }
+
+    // At most a FIFO's worth of words is still shifting out when the DMA completes.
+    QSPI_Deselect(*cmdlist_qspi);
+
+    cmdlist_index++;
+    if(cmdlist_index < cmdlist_active->seg_count){
+        QSPI_CmdList_StartTransaction();
+        return;
+    }
+
+    // Clear state before the callback so it may submit the next list.
+    qspi_cmdlist_done_t done = cmdlist_done;
+    void *ctx = cmdlist_ctx;
+    cmdlist_busy = false;
+    if(done) done(ctx);
+}
+
+/******************************************************************************
+function : Claim the chain channel and route DMA completion to the executor
+******************************************************************************/
+void QSPI_CmdList_IRQ_Init(void){
+    if(cmdlist_chain_dma < 0){
+        cmdlist_chain_dma = dma_claim_unused_channel(true);
+    }
+    dma_channel_acknowledge_irq0(dma_tx);
+    dma_channel_acknowledge_irq0((uint)cmdlist_chain_dma);
+    dma_channel_set_irq0_enabled(dma_tx, true);
+    dma_channel_set_irq0_enabled((uint)cmdlist_chain_dma, true);
+    irq_add_shared_handler(DMA_IRQ_0, QSPI_CmdList_IRQ, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+}
+
+/******************************************************************************
+function : Start executing a command list and return immediately
 parameter:
     qspi : QSPI structure
-    addr : RGB pixel interface register address
-******************************************************************************/	
-void QSPI_Pixel_Write(pio_qspi_t qspi, uint32_t addr){
-    //1 WIRE CMD
-    QSPI_CMD_Write(qspi,0x32);
-    
-    //1 WIRE ADDR
-    QSPI_DATA_Write(qspi,0x00);
-    QSPI_DATA_Write(qspi,addr);
-    QSPI_DATA_Write(qspi,0x00);
-    WAIT_TIME();
+    list : command list, must stay valid until done is called
+    done : completion callback (interrupt context), may be NULL
+    ctx  : passed to done
+******************************************************************************/
+void QSPI_CmdList_Submit(pio_qspi_t *qspi, const qspi_cmdlist_t *list,
+                         qspi_cmdlist_done_t done, void *ctx){
+    if(list->seg_count == 0){
+        if(done) done(ctx);
+        return;
+    }
+    cmdlist_qspi = qspi;
+    cmdlist_active = list;
+    cmdlist_index = 0;
+    cmdlist_done = done;
+    cmdlist_ctx = ctx;
+    cmdlist_payload_start_us = time_us_32();
+    cmdlist_busy = true;
+    QSPI_CmdList_StartTransaction();
+}
+
+/******************************************************************************
+function : True while a submitted command list is still streaming
+******************************************************************************/
+bool QSPI_CmdList_Busy(void){
+    return cmdlist_busy;
+}
+
+/******************************************************************************
+function : Time the last list's chained command + payload transaction started
+           (time_us_32 clock)
+******************************************************************************/
+uint32_t QSPI_CmdList_PayloadStartUs(void){
+    return cmdlist_payload_start_us;
 }
@@ -30,6 +30,7 @@
 #define _QSPI_PIO_H_
 
 #include "qspi.pio.h"
+#include "qspi_cmdlist.h"
 #include "hardware/pio.h"
 #include "hardware/gpio.h"
 
@@ -47,8 +48,6 @@
 typedef struct pio_qspi {
     PIO pio;
     uint8_t sm;
-    uint8_t sm_4wire;
-    uint8_t sm_1wire;
     uint8_t pin_cs;
     uint8_t pin_sclk;
     uint8_t pin_dio0;
@@ -64,11 +63,23 @@ extern pio_qspi_t qspi;
 void QSPI_GPIO_Init(pio_qspi_t qspi);
 void QSPI_Select(pio_qspi_t qspi);
 void QSPI_Deselect(pio_qspi_t qspi);
+void QSPI_Wait_Idle(pio_qspi_t qspi);
 void QSPI_PIO_Init(pio_qspi_t qspi);
-void QSPI_1Wrie_Mode(pio_qspi_t *qspi);
-void QSPI_4Wrie_Mode(pio_qspi_t *qspi);
+void QSPI_Phase_Begin(pio_qspi_t qspi, uint32_t mode, uint32_t count);
 void QSPI_DATA_Write(pio_qspi_t qspi, uint32_t val);
 void QSPI_REGISTER_Write(pio_qspi_t qspi, uint32_t addr);
 void QSPI_Pixel_Write(pio_qspi_t qspi, uint32_t addr);
+void QSPI_Pixel_Stream(pio_qspi_t qspi, const void *data, uint32_t len);
+
+// Command lists (qspi_cmdlist.h) executed by dma_tx plus one chained channel.
+// QSPI_CmdList_Submit() returns as soon as the first transaction is started; the
+// DMA_IRQ_0 handler releases CS between transactions and calls done from interrupt
+// context.
+typedef void (*qspi_cmdlist_done_t)(void *ctx);
+void QSPI_CmdList_IRQ_Init(void);
+void QSPI_CmdList_Submit(pio_qspi_t *qspi, const qspi_cmdlist_t *list,
+                         qspi_cmdlist_done_t done, void *ctx);
+bool QSPI_CmdList_Busy(void);
+uint32_t QSPI_CmdList_PayloadStartUs(void);
 
 #endif // _QSPI_PIO_H
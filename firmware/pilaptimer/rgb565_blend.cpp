@@ -0,0 +1,168 @@
+#include "rgb565_blend.h"
+
+#include <string.h>
+
+// The ACLE SIMD32 intrinsics (UXTB16, USUB16, SEL) come with the M33's DSP extension.
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#define RGB565_BLEND_DSP 1
+#else
+#define RGB565_BLEND_DSP 0
+#endif
+
+namespace {
+constexpr uint32_t kSpread = 0x07E0F81Fu;  // G in bits 21-26, R in 11-15, B in 0-4.
+constexpr uint32_t kLanes = 0x00010001u;   // Multiplier that copies a value into both lanes.
+
+inline uint32_t load32(const void *p) {
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline void store32(void *p, uint32_t v) {
+  memcpy(p, &v, sizeof(v));
+}
+
+// Mask bytes 0 and 2, and 1 and 3, in halfword lanes.
+inline uint32_t bytes02(uint32_t x) {
+#if RGB565_BLEND_DSP
+  return __uxtb16(x);
+#else
+  return x & 0x00FF00FFu;
+#endif
+}
+
+inline uint32_t bytes13(uint32_t x) {
+#if RGB565_BLEND_DSP
+  return __uxtb16(__ror(x, 8));
+#else
+  return (x >> 8) & 0x00FF00FFu;
+#endif
+}
+
+// Per halfword lane: x >= y ? a : b.
+inline uint32_t select_ge16(uint32_t x, uint32_t y, uint32_t a, uint32_t b) {
+#if RGB565_BLEND_DSP
+  (void)__usub16(x, y);  // Sets the GE flags SEL picks by.
+  return __sel(a, b);
+#else
+  const uint32_t lo = (x & 0xFFFFu) >= (y & 0xFFFFu) ? a : b;
+  const uint32_t hi = (x >> 16) >= (y >> 16) ? a : b;
+  return (lo & 0xFFFFu) | (hi & 0xFFFF0000u);
+#endif
+}
+
+// How the blend turns two mask values (halfword lanes) into lv_color_mix() weights.
+struct Weights {
+  bool opaque;         // The mask alone decides; opa is not used.
+  uint32_t opa;
+  uint32_t opaLanes;   // opa in both lanes.
+  uint32_t fullLanes;  // Mask value from which a lane takes opa unscaled.
+
+  // lv_color_mix() only uses the top 5 bits of its 8-bit weight, rounded: (m + 4) >> 3.
+  uint32_t operator()(uint32_t lanes) const {
+    if (!opaque) {
+      const uint32_t scaled = ((lanes * opa) >> 8) & 0x00FF00FFu;
+      lanes = select_ge16(lanes, fullLanes, opaLanes, scaled);
+    }
+    return ((lanes + 0x00040004u) >> 3) & 0x003F003Fu;
+  }
+};
+
+Weights make_weights(bool opaque, uint8_t opa, uint32_t full) {
+  return Weights{opaque, opa, opa * kLanes, full * kLanes};
+}
+
+inline uint32_t spread(uint32_t px) { return (px | px << 16) & kSpread; }
+
+inline uint32_t unspread(uint32_t s) { return (s | s >> 16) & 0xFFFFu; }
+
+// lv_color_mix() on spread pixels with a 5-bit weight.
+inline uint32_t mix_spread(uint32_t fg, uint32_t bg, uint32_t w5) {
+  return ((((fg - bg) * w5) >> 5) + bg) & kSpread;
+}
+
+// Two pixels, pixel 0 in the low half of fg, bg and the weight lanes.
+inline uint32_t mix2(uint32_t fg, uint32_t bg, uint32_t w) {
+  const uint32_t lo = mix_spread(spread(fg & 0xFFFFu), spread(bg & 0xFFFFu), w & 0xFFFFu);
+  const uint32_t hi = mix_spread(spread(fg >> 16), spread(bg >> 16), w >> 16);
+  return unspread(lo) | unspread(hi) << 16;
+}
+
+inline uint16_t mix1(uint32_t fg, uint16_t bg, uint32_t w5) {
+  return (uint16_t)unspread(mix_spread(spread(fg), spread(bg), w5));
+}
+
+// One row through the mask. kMap: the foreground comes from src, otherwise it is color.
+template <bool kMap>
+void blend_row(uint16_t *d, const uint16_t *src, uint16_t color, const uint8_t *m, int32_t w,
+               const Weights &weights) {
+  const uint32_t color2 = color * kLanes;
+  int32_t x = 0;
+  // Word-align dst; src and the mask are read unaligned.
+  if (((uintptr_t)d & 2) && w > 0) {
+    d[0] = mix1(kMap ? src[0] : color, d[0], weights(m[0]) & 0xFFFFu);
+    x = 1;
+  }
+  for (; x + 4 <= w; x += 4) {
+    const uint32_t mw = load32(m + x);
+    if (mw == 0) continue;
+    const uint32_t fg01 = kMap ? load32(src + x) : color2;
+    const uint32_t fg23 = kMap ? load32(src + x + 2) : color2;
+    if (mw == 0xFFFFFFFFu && weights.opaque) {
+      store32(d + x, fg01);
+      store32(d + x + 2, fg23);
+      continue;
+    }
+    const uint32_t even = weights(bytes02(mw));  // Pixels 0 and 2.
+    const uint32_t odd = weights(bytes13(mw));   // Pixels 1 and 3.
+    store32(d + x, mix2(fg01, load32(d + x), (even & 0xFFFFu) | odd << 16));
+    store32(d + x + 2, mix2(fg23, load32(d + x + 2), even >> 16 | (odd & 0xFFFF0000u)));
+  }
+  for (; x < w; ++x) {
+    if (m[x]) d[x] = mix1(kMap ? src[x] : color, d[x], weights(m[x]) & 0xFFFFu);
+  }
+}
+
+// One row at a single weight (image without a mask).
+void mix_row(uint16_t *d, const uint16_t *src, int32_t w, uint32_t w5) {
+  const uint32_t lanes = w5 * kLanes;
+  int32_t x = 0;
+  if (((uintptr_t)d & 2) && w > 0) {
+    d[0] = mix1(src[0], d[0], w5);
+    x = 1;
+  }
+  for (; x + 2 <= w; x += 2) store32(d + x, mix2(load32(src + x), load32(d + x), lanes));
+  if (x < w) d[x] = mix1(src[x], d[x], w5);
+}
+}  // namespace
+
+void rgb565_blend_fill_mask(uint16_t *dst, int32_t stride, int32_t w, int32_t h, uint16_t color,
+                            const uint8_t *mask, int32_t mask_stride, uint8_t opa) {
+  // fill_normal() takes the mask alone from LV_OPA_MAX and gives a fully covered pixel the
+  // overall opacity; map_normal() takes the mask alone only above LV_OPA_MAX and gives
+  // anything from LV_OPA_MAX the overall opacity.
+  const Weights weights = make_weights(opa >= kRgb565BlendOpaMax, opa, 0xFF);
+  for (int32_t y = 0; y < h; ++y, dst += stride, mask += mask_stride) {
+    blend_row<false>(dst, nullptr, color, mask, w, weights);
+  }
+}
+
+void rgb565_blend_map(uint16_t *dst, int32_t stride, int32_t w, int32_t h, const uint16_t *src,
+                      int32_t src_stride, const uint8_t *mask, int32_t mask_stride, uint8_t opa) {
+  if (mask == nullptr) {
+    for (int32_t y = 0; y < h; ++y, dst += stride, src += src_stride) {
+      if (opa >= kRgb565BlendOpaMax) {
+        memcpy(dst, src, (size_t)w * sizeof(uint16_t));
+      } else {
+        mix_row(dst, src, w, (opa + 4u) >> 3);
+      }
+    }
+    return;
+  }
+  const Weights weights = make_weights(opa > kRgb565BlendOpaMax, opa, kRgb565BlendOpaMax);
+  for (int32_t y = 0; y < h; ++y, dst += stride, src += src_stride, mask += mask_stride) {
+    blend_row<true>(dst, src, 0, mask, w, weights);
+  }
+}
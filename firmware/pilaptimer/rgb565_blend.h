@@ -0,0 +1,42 @@
+#ifndef RGB565_BLEND_H
+#define RGB565_BLEND_H
+
+#include <stdint.h>
+
+// Masked and translucent RGB565 blends meant to give the same pixels as LVGL's software
+// blend (LV_COLOR_DEPTH 16, LV_COLOR_16_SWAP 0): every pixel is lv_color_mix(fg, bg, opa)
+// with opa taken from the mask and the overall opacity as fill_normal() and map_normal()
+// do. What has been checked: host/bench_blend, against the vendored LVGL 8.1, at every
+// opacity except where 8.1's opaque cut-off differs from 8.3's (kRgb565BlendOpaMax below).
+// Against the firmware's 8.4 they are checked only by the same= field of the BLEND lines
+// of DISP_RENDER_BENCH on the target.
+//
+// Pixels are loaded and stored in pairs and the mask four bytes at a time. All-zero mask
+// words are skipped and fully covered ones stored without mixing. The rest splits the
+// mask word into two halfword-lane pairs (UXTB16), scales two lanes by the opacity in
+// one multiply and picks full opacity per lane with USUB16/SEL, so the mask handling
+// works on two pixels per operation. The colour mix does not: it is LVGL's one multiply
+// per pixel over a spread 0x07E0F81F word. The DSP extension has no lane-wise multiply,
+// and RGB565 fields do not sit on byte or halfword lanes. Built for Cortex-M33 with the
+// DSP extension these are ACLE intrinsics; elsewhere (host) plain C with the same results.
+//
+// Whether they are faster than LVGL is not established. In plain C on the host they lose
+// on opaque text and sprites; only target BLEND cycle counts can justify enabling
+// LV_PORT_DISP_SIMD_BLEND.
+//
+// Rows are stride (dst), src_stride and mask_stride elements apart; nothing may overlap.
+
+// LV_OPA_MAX. Following lv_draw_sw_blend_basic() in 8.3 and later, not 8.1, an overall
+// opacity at or above it makes a masked fill or an unmasked image opaque, a masked image
+// only above it; and a mask value at or above it takes the overall opacity as is when
+// blending an image.
+static const uint8_t kRgb565BlendOpaMax = 253;
+
+// color through mask (glyphs, anti-aliased edges) at overall opacity opa.
+void rgb565_blend_fill_mask(uint16_t *dst, int32_t stride, int32_t w, int32_t h, uint16_t color,
+                            const uint8_t *mask, int32_t mask_stride, uint8_t opa);
+// src over dst through mask (nullptr: none) at overall opacity opa.
+void rgb565_blend_map(uint16_t *dst, int32_t stride, int32_t w, int32_t h, const uint16_t *src,
+                      int32_t src_stride, const uint8_t *mask, int32_t mask_stride, uint8_t opa);
+
+#endif
@@ -0,0 +1,33 @@
+#include "rgb565_fill.h"
+
+namespace {
+uint32_t fill_run(uint16_t *dst, uint32_t count, uint16_t color, rgb565_fill_words_t fill_words) {
+  if (((uintptr_t)dst & 2) && count) {
+    *dst++ = color;
+    count--;
+  }
+  const uint32_t word = color * 0x00010001u;
+  const uint32_t words = count / 2;
+  uint32_t *d = (uint32_t *)dst;
+  uint32_t filled = 0;
+  if (words >= kRgb565FillMinWords) {
+    fill_words(d, word, words);
+    filled = words * 2;
+  } else {
+    for (uint32_t i = 0; i < words; ++i) d[i] = word;
+  }
+  if (count & 1) dst[count - 1] = color;
+  return filled;
+}
+}  // namespace
+
+uint32_t rgb565_fill_rect(uint16_t *dst, int32_t stride, int32_t w, int32_t h, uint16_t color,
+                          rgb565_fill_words_t fill_words) {
+  if (w <= 0 || h <= 0) return 0;
+  if (w == stride) return fill_run(dst, (uint32_t)w * h, color, fill_words);
+  uint32_t filled = 0;
+  for (int32_t y = 0; y < h; ++y, dst += stride) {
+    filled += fill_run(dst, (uint32_t)w, color, fill_words);
+  }
+  return filled;
+}
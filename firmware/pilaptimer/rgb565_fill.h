@@ -0,0 +1,22 @@
+#ifndef RGB565_FILL_H
+#define RGB565_FILL_H
+
+#include <stdint.h>
+
+// Writes count copies of word to the word-aligned dst. The display port backs it with a
+// DMA channel reading one fixed source word (dma_fill.h); the host tools use a loop.
+typedef void (*rgb565_fill_words_t)(uint32_t *dst, uint32_t word, uint32_t count);
+
+// Runs shorter than this many words are stored by the CPU: setting up a transfer costs
+// more than the pixels.
+static const uint32_t kRgb565FillMinWords = 32;
+
+// Fills a w x h rectangle of dst, whose rows are stride pixels apart, with color. A
+// rectangle as wide as its stride is one run, anything narrower one run per row. A run
+// starting on an odd pixel gets its first pixel, and a run ending on one its last, from
+// the CPU; the whole words between them go to fill_words when there are at least
+// kRgb565FillMinWords. Returns the pixels fill_words wrote.
+uint32_t rgb565_fill_rect(uint16_t *dst, int32_t stride, int32_t w, int32_t h, uint16_t color,
+                          rgb565_fill_words_t fill_words);
+
+#endif
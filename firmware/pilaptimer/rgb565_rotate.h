@@ -0,0 +1,15 @@
+#ifndef RGB565_ROTATE_H
+#define RGB565_ROTATE_H
+
+#include <stdint.h>
+
+// Rotates a packed w x h RGB565 image 90 degrees counter-clockwise into dst, which
+// becomes h pixels wide and w rows tall: dst[r * h + c] = src[c * w + (w - 1 - r)].
+// This is the landscape (LVGL) -> portrait (panel) mapping used by the display port.
+//
+// Works in 16x16 tiles and moves two pixels per 32-bit load/store, so the inner loop
+// has no multiplies and half the memory operations of a per-pixel gather.
+// Any w/h (odd sizes included); src and dst must not overlap.
+void rgb565_rotate_ccw(const uint16_t *src, int32_t w, int32_t h, uint16_t *dst);
+
+#endif
@@ -1,12 +1,14 @@
 #include "screen_gforce.h"
 
 #include <math.h>
-#include <stdio.h>
 
 #include <Arduino.h>
 
 #include "imu_qmi8658.h"
 #include "screen_nav.h"
+#include "ui_format.h"
+#include "ui_styles.h"
+#include "ui_tile_activity.h"
 
 static lv_obj_t *gforceScreen = nullptr;
 
@@ -24,6 +26,7 @@ constexpr int32_t kCircleSize = 170;
 constexpr int32_t kBallSize = 14;
 constexpr int32_t kTickLength = 10;
 constexpr int32_t kSmallTickLength = 6;
+constexpr uint8_t kTickCount = 10;
 
 // Axis mapping for the installed PCB orientation.
 // Adjust these indexes/signs after a real-world test if forward/left do not match.
@@ -62,7 +65,12 @@ struct GForceState {
 
 GForceRefs refs{};
 GForceState state{};
+// Calibration and peaks outlive the widgets; a rebuilt tile shows the kept values.
+bool stateStarted = false;
 lv_timer_t *updateTimer = nullptr;
+// lv_line keeps a pointer to its points, so they live here rather than in the LVGL heap.
+lv_point_t tickPoints[kTickCount][2];
+uint8_t tickPointsUsed = 0;
 
 void reset_peaks() {
   state.peakForward = 0.0f;
@@ -121,16 +129,16 @@ void update_ball(float gx, float gy) {
 void update_labels(float forward, float brake, float left, float right) {
   char buf[16];
 
-  snprintf(buf, sizeof(buf), "%.2f", (double)forward);
+  ui_format_fixed2(buf, sizeof(buf), forward);
   lv_label_set_text(refs.labelTop, buf);
 
-  snprintf(buf, sizeof(buf), "%.2f", (double)brake);
+  ui_format_fixed2(buf, sizeof(buf), brake);
   lv_label_set_text(refs.labelBottom, buf);
 
-  snprintf(buf, sizeof(buf), "%.2f", (double)left);
+  ui_format_fixed2(buf, sizeof(buf), left);
   lv_label_set_text(refs.labelLeft, buf);
 
-  snprintf(buf, sizeof(buf), "%.2f", (double)right);
+  ui_format_fixed2(buf, sizeof(buf), right);
   lv_label_set_text(refs.labelRight, buf);
 }
 
@@ -161,7 +169,9 @@ void update_timer_cb(lv_timer_t *timer) {
     return;
   }
 
+  ui_tile_activity_note(UI_TILE_SUBSYSTEM_GFORCE_TICK);
   float acc[3] = {0.0f, 0.0f, 0.0f};
+  ui_tile_activity_note(UI_TILE_SUBSYSTEM_IMU_READ);
   if (!imu_qmi8658_read_accel(acc[0], acc[1], acc[2])) {
     return;
   }
@@ -213,8 +223,8 @@ void update_timer_cb(lv_timer_t *timer) {
 }
 
 lv_obj_t *create_tick(lv_obj_t *parent, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint8_t width) {
-  lv_point_t *points = static_cast<lv_point_t *>(lv_mem_alloc(sizeof(lv_point_t) * 2));
-  if (!points) return nullptr;
+  if (tickPointsUsed >= kTickCount) return nullptr;
+  lv_point_t *points = tickPoints[tickPointsUsed++];
   points[0].x = x1;
   points[0].y = y1;
   points[1].x = x2;
@@ -232,6 +242,7 @@ void build_ticks(lv_obj_t *parent) {
   int32_t centerX = lv_obj_get_width(parent) / 2;
   int32_t centerY = lv_obj_get_height(parent) / 2;
   int32_t radius = kCircleSize / 2;
+  tickPointsUsed = 0;
 
   create_tick(parent, centerX - kTickLength, centerY, centerX + kTickLength, centerY, 2);
   create_tick(parent, centerX, centerY - kTickLength, centerX, centerY + kTickLength, 2);
@@ -250,9 +261,9 @@ void build_ticks(lv_obj_t *parent) {
 }
 
 void build_gforce_screen(lv_obj_t *root) {
+  ui_styles_init();
   refs.root = root;
-  lv_obj_set_style_bg_color(refs.root, lv_color_hex(0x0b0f14), 0);
-  lv_obj_set_style_bg_opa(refs.root, LV_OPA_COVER, 0);
+  ui_style_add(refs.root, UI_STYLE_TILE);
   lv_obj_clear_flag(refs.root, LV_OBJ_FLAG_SCROLLABLE);
 
   refs.target = lv_obj_create(refs.root);
@@ -268,35 +279,30 @@ void build_gforce_screen(lv_obj_t *root) {
 
   refs.ball = lv_obj_create(refs.root);
   lv_obj_set_size(refs.ball, kBallSize, kBallSize);
-  lv_obj_set_style_radius(refs.ball, LV_RADIUS_CIRCLE, 0);
+  ui_style_add(refs.ball, UI_STYLE_CIRCLE);
   lv_obj_set_style_bg_color(refs.ball, lv_color_hex(0xff5a3d), 0);
   lv_obj_set_style_bg_opa(refs.ball, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(refs.ball, 0, 0);
   lv_obj_clear_flag(refs.ball, LV_OBJ_FLAG_CLICKABLE);
 
   refs.labelTop = lv_label_create(refs.root);
-  lv_obj_set_style_text_font(refs.labelTop, &lv_font_montserrat_32, 0);
-  lv_obj_set_style_text_color(refs.labelTop, lv_color_hex(0xf5f8ff), 0);
+  ui_style_add(refs.labelTop, UI_STYLE_VALUE_32);
   lv_obj_align(refs.labelTop, LV_ALIGN_TOP_MID, 0, 18);
 
   refs.labelBottom = lv_label_create(refs.root);
-  lv_obj_set_style_text_font(refs.labelBottom, &lv_font_montserrat_32, 0);
-  lv_obj_set_style_text_color(refs.labelBottom, lv_color_hex(0xf5f8ff), 0);
+  ui_style_add(refs.labelBottom, UI_STYLE_VALUE_32);
   lv_obj_align(refs.labelBottom, LV_ALIGN_BOTTOM_MID, 0, -18);
 
   refs.labelLeft = lv_label_create(refs.root);
-  lv_obj_set_style_text_font(refs.labelLeft, &lv_font_montserrat_24, 0);
-  lv_obj_set_style_text_color(refs.labelLeft, lv_color_hex(0xf5f8ff), 0);
+  ui_style_add(refs.labelLeft, UI_STYLE_VALUE_24);
   lv_obj_align(refs.labelLeft, LV_ALIGN_LEFT_MID, 10, -10);
 
   refs.labelRight = lv_label_create(refs.root);
-  lv_obj_set_style_text_font(refs.labelRight, &lv_font_montserrat_24, 0);
-  lv_obj_set_style_text_color(refs.labelRight, lv_color_hex(0xf5f8ff), 0);
+  ui_style_add(refs.labelRight, UI_STYLE_VALUE_24);
   lv_obj_align(refs.labelRight, LV_ALIGN_RIGHT_MID, -10, -10);
 
   refs.labelMax = lv_label_create(refs.root);
   lv_label_set_text(refs.labelMax, "Max");
-  lv_obj_set_style_text_font(refs.labelMax, &lv_font_montserrat_20, 0);
+  lv_obj_set_style_text_font(refs.labelMax, &ui_font_montserrat_20, 0);
   lv_obj_set_style_text_color(refs.labelMax, lv_color_hex(0x9aa7b7), 0);
   lv_obj_align(refs.labelMax, LV_ALIGN_BOTTOM_LEFT, 18, -24);
 
@@ -312,15 +318,22 @@ void build_gforce_screen(lv_obj_t *root) {
 
   refs.resetLabel = lv_label_create(refs.resetBtn);
   lv_label_set_text(refs.resetLabel, LV_SYMBOL_REFRESH);
-  lv_obj_set_style_text_font(refs.resetLabel, &lv_font_montserrat_32, 0);
-  lv_obj_set_style_text_color(refs.resetLabel, lv_color_hex(0xf5f8ff), 0);
+  ui_style_add(refs.resetLabel, UI_STYLE_VALUE_32);
   lv_obj_center(refs.resetLabel);
 
   updateTimer = lv_timer_create(update_timer_cb, kUpdateMs, nullptr);
 
-  start_calibration();
-  update_labels(0.0f, 0.0f, 0.0f, 0.0f);
-  update_ball(0.0f, 0.0f);
+  if (!stateStarted) {
+    stateStarted = true;
+    start_calibration();
+  }
+  if (state.calibrating) {
+    update_labels(0.0f, 0.0f, 0.0f, 0.0f);
+    update_ball(0.0f, 0.0f);
+  } else {
+    update_labels(state.peakForward, state.peakBrake, state.peakLeft, state.peakRight);
+    update_ball(clampf(state.filtered[0], -2.0f, 2.0f), clampf(state.filtered[1], -2.0f, 2.0f));
+  }
 }
 }  // namespace
 
@@ -340,3 +353,25 @@ void screen_gforce_attach(lv_obj_t *parent) {
   gforceScreen = parent;
   build_gforce_screen(gforceScreen);
 }
+
+void screen_gforce_detach(void) {
+  if (!gforceScreen) return;
+  if (updateTimer) {
+    lv_timer_del(updateTimer);
+    updateTimer = nullptr;
+  }
+  lv_obj_clean(gforceScreen);
+  refs = GForceRefs{};
+  gforceScreen = nullptr;
+}
+
+void screen_gforce_set_visible(bool visible) {
+  if (!updateTimer) return;
+  if (!visible) {
+    lv_timer_pause(updateTimer);
+    return;
+  }
+  if (state.calibrating) start_calibration();
+  lv_timer_reset(updateTimer);
+  lv_timer_resume(updateTimer);
+}
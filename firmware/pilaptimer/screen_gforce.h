@@ -5,3 +5,9 @@
 void screen_gforce_init(void);
 lv_obj_t *screen_gforce_get_screen(void);
 void screen_gforce_attach(lv_obj_t *parent);
+// Deletes the widgets and the update timer; calibration and peaks are kept for the next
+// attach.
+void screen_gforce_detach(void);
+// Tile lifecycle: the update timer (and with it the IMU reads) only runs while visible.
+// An interrupted gravity calibration restarts on show.
+void screen_gforce_set_visible(bool visible);
@@ -3,7 +3,25 @@
 #include <lvgl.h>
 #include <stdio.h>
 
+#include "ui_bind.h"
+#include "ui_format.h"
+#include "ui_glow_sprite.h"
+#include "ui_styles.h"
+#include "ui_tile_activity.h"
+
 namespace {
+constexpr lv_coord_t kLightSize = 60;
+constexpr uint8_t kLightCount = 4;
+// Glow blur width (as a style shadow_width) and opacity of a lit light.
+constexpr lv_coord_t kGlowWidth = 24;
+constexpr lv_opa_t kGlowOpa = LV_OPA_60;
+
+// A light is its unlit disc plus a glow sprite on top, shown while it is lit.
+struct ReactionLight {
+  lv_obj_t *disc;
+  lv_obj_t *glow;
+};
+
 struct ReactionRefs {
   lv_obj_t *root;
   lv_obj_t *statusLabel;
@@ -11,54 +29,87 @@ struct ReactionRefs {
   lv_obj_t *bestLabel;
   lv_obj_t *armBtn;
   lv_obj_t *armLabel;
-  lv_obj_t *amberLeft[3];
-  lv_obj_t *greenLeft;
-  lv_obj_t *amberRight[3];
-  lv_obj_t *greenRight;
+  ReactionLight amberLeft[3];
+  ReactionLight greenLeft;
+  ReactionLight amberRight[3];
+  ReactionLight greenRight;
 };
 
 ReactionRefs refs{};
+// Lit amber and green lights, rendered while the tile is built (ui_glow_sprite.h).
+lv_img_dsc_t amberSprite;
+lv_img_dsc_t greenSprite;
+
+// Values last applied by screen_reaction_update() (see ui_bind.h).
+struct ReactionBindings {
+  UiBoundValue amberLeft[3];
+  UiBoundValue greenLeft;
+  UiBoundValue amberRight[3];
+  UiBoundValue greenRight;
+  UiBoundValue statusText;
+  UiBoundValue armBtnBg;
+};
+
+ReactionBindings bound{};
+// Last snapshot pushed, applied again when the tile is rebuilt after a detach.
+ReactionUiSnapshot lastSnapshot{};
 reaction_handler_t swipeLeftHandler = nullptr;
 reaction_handler_t swipeRightHandler = nullptr;
 reaction_handler_t actionHandler = nullptr;
 reaction_handler_t armHandler = nullptr;
 
-void set_light(lv_obj_t *light, lv_color_t color, bool on) {
-  lv_obj_set_style_bg_color(light, on ? color : lv_color_hex(0x202830), 0);
-  lv_obj_set_style_bg_opa(light, on ? LV_OPA_COVER : LV_OPA_40, 0);
-  lv_obj_set_style_shadow_color(light, color, 0);
-  lv_obj_set_style_shadow_width(light, on ? 24 : 0, 0);
-  lv_obj_set_style_shadow_opa(light, on ? LV_OPA_60 : LV_OPA_TRANSP, 0);
+void set_light(const ReactionLight &light, UiBoundValue &boundOn, bool on) {
+  if (!ui_bind_changed(boundOn, on)) return;
+  if (on) {
+    lv_obj_clear_flag(light.glow, LV_OBJ_FLAG_HIDDEN);
+  } else {
+    lv_obj_add_flag(light.glow, LV_OBJ_FLAG_HIDDEN);
+  }
 }
 
-void create_light_column(lv_obj_t *parent, lv_align_t align, int16_t xOffset, int16_t yOffset,
-                         lv_obj_t *amber[3], lv_obj_t **green) {
-  static constexpr int kLightSize = 60;
-  static constexpr int kLightCount = 4;
+// The glow sprite is a sibling drawn right after its disc, so lights further down the
+// column still paint over it the way they painted over a style shadow. Like that
+// shadow, the column clips the glow to its own width.
+ReactionLight create_light(lv_obj_t *column, uint8_t index, const lv_img_dsc_t *sprite,
+                           lv_color_t color) {
+  ReactionLight light;
+  light.disc = lv_obj_create(column);
+  lv_obj_set_size(light.disc, kLightSize, kLightSize);
+  ui_style_add(light.disc, UI_STYLE_CIRCLE);
+  lv_obj_set_style_bg_color(light.disc, lv_color_hex(0x202830), 0);
+  lv_obj_set_style_bg_opa(light.disc, LV_OPA_40, 0);
 
+  light.glow = lv_img_create(column);
+  lv_obj_add_flag(light.glow, LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_HIDDEN);
+  lv_obj_clear_flag(light.glow, LV_OBJ_FLAG_CLICKABLE);
+  if (sprite->data) {
+    lv_img_set_src(light.glow, sprite);
+    lv_obj_set_pos(light.glow, 0, index * kLightSize - kGlowWidth / 2);
+  } else {
+    // Out of memory for the sprite: a lit light is a plain disc without glow.
+    lv_obj_set_size(light.glow, kLightSize, kLightSize);
+    lv_obj_set_pos(light.glow, 0, index * kLightSize);
+    ui_style_add(light.glow, UI_STYLE_CIRCLE);
+    lv_obj_set_style_bg_color(light.glow, color, 0);
+    lv_obj_set_style_bg_opa(light.glow, LV_OPA_COVER, 0);
+  }
+  return light;
+}
+
+void create_light_column(lv_obj_t *parent, lv_align_t align, int16_t xOffset, int16_t yOffset,
+                         ReactionLight amber[3], ReactionLight *green) {
   lv_obj_t *lightColumn = lv_obj_create(parent);
   lv_obj_set_size(lightColumn, kLightSize, kLightSize * kLightCount);
-  lv_obj_set_style_bg_opa(lightColumn, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(lightColumn, 0, 0);
+  ui_style_add(lightColumn, UI_STYLE_COLUMN);
   lv_obj_set_style_pad_all(lightColumn, 0, 0);
-  lv_obj_set_flex_flow(lightColumn, LV_FLEX_FLOW_COLUMN);
-  lv_obj_set_flex_align(lightColumn, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER,
-                        LV_FLEX_ALIGN_CENTER);
   lv_obj_set_style_pad_gap(lightColumn, 0, 0);
   lv_obj_align(lightColumn, align, xOffset, yOffset);
   lv_obj_clear_flag(lightColumn, LV_OBJ_FLAG_SCROLLABLE);
 
-  for (int i = 0; i < 3; ++i) {
-    amber[i] = lv_obj_create(lightColumn);
-    lv_obj_set_size(amber[i], kLightSize, kLightSize);
-    lv_obj_set_style_radius(amber[i], LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(amber[i], 0, 0);
+  for (uint8_t i = 0; i < 3; ++i) {
+    amber[i] = create_light(lightColumn, i, &amberSprite, lv_color_hex(0xffc857));
   }
-
-  *green = lv_obj_create(lightColumn);
-  lv_obj_set_size(*green, kLightSize, kLightSize);
-  lv_obj_set_style_radius(*green, LV_RADIUS_CIRCLE, 0);
-  lv_obj_set_style_border_width(*green, 0, 0);
+  *green = create_light(lightColumn, 3, &greenSprite, lv_color_hex(0x3ddc97));
 }
 
 void update_status_style(ReactionState state) {
@@ -68,7 +119,7 @@ void update_status_style(ReactionState state) {
   } else if (state == REACTION_WAIT_FOR_MOVE) {
     color = lv_color_hex(0x7bf1a8);
   }
-  lv_obj_set_style_text_color(refs.statusLabel, color, 0);
+  ui_bind_text_color(refs.statusLabel, bound.statusText, color);
 }
 
 void on_root_event(lv_event_t *e) {
@@ -98,62 +149,67 @@ void on_arm_btn_event(lv_event_t *e) {
 }  // namespace
 
 void screen_reaction_attach(lv_obj_t *parent) {
+  ui_styles_init();
   refs.root = parent;
-  lv_obj_set_style_bg_color(refs.root, lv_color_hex(0x0b0f14), 0);
-  lv_obj_set_style_bg_opa(refs.root, LV_OPA_COVER, 0);
+  ui_style_add(refs.root, UI_STYLE_TILE);
   lv_obj_clear_flag(refs.root, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_add_event_cb(refs.root, on_root_event, LV_EVENT_GESTURE, nullptr);
   lv_obj_add_event_cb(refs.root, on_root_event, LV_EVENT_CLICKED, nullptr);
 
   lv_obj_t *title = lv_label_create(refs.root);
   lv_label_set_text(title, "REACTION RACE");
-  lv_obj_set_style_text_color(title, lv_color_hex(0x8fa0b6), 0);
-  lv_obj_set_style_text_font(title, &lv_font_montserrat_20, 0);
+  ui_style_add(title, UI_STYLE_TITLE);
   lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 12);
 
   refs.statusLabel = lv_label_create(refs.root);
   lv_label_set_text(refs.statusLabel, "IDLE");
-  lv_obj_set_style_text_font(refs.statusLabel, &lv_font_montserrat_24, 0);
+  ui_style_add(refs.statusLabel, UI_STYLE_TEXT_24);
   lv_obj_align(refs.statusLabel, LV_ALIGN_TOP_MID, 0, 44);
 
+  if (!amberSprite.data) {
+    ui_glow_sprite_build(&amberSprite, kLightSize, kLightSize + kGlowWidth, kLightSize,
+                         lv_color_hex(0xffc857), kGlowWidth, kGlowOpa);
+  }
+  if (!greenSprite.data) {
+    ui_glow_sprite_build(&greenSprite, kLightSize, kLightSize + kGlowWidth, kLightSize,
+                         lv_color_hex(0x3ddc97), kGlowWidth, kGlowOpa);
+  }
   create_light_column(refs.root, LV_ALIGN_LEFT_MID, 16, -16, refs.amberLeft, &refs.greenLeft);
   create_light_column(refs.root, LV_ALIGN_RIGHT_MID, -16, -16, refs.amberRight, &refs.greenRight);
 
   refs.rtLabel = lv_label_create(refs.root);
   lv_label_set_text(refs.rtLabel, "R/T: ---.---s");
-  lv_obj_set_style_text_font(refs.rtLabel, &lv_font_montserrat_48, 0);
-  lv_obj_set_style_text_color(refs.rtLabel, lv_color_hex(0xf5f8ff), 0);
+  ui_style_add(refs.rtLabel, UI_STYLE_VALUE_48);
   lv_obj_align(refs.rtLabel, LV_ALIGN_CENTER, 0, -48);
 
   refs.bestLabel = lv_label_create(refs.root);
   lv_label_set_text(refs.bestLabel, "Best R/T: ---.---s");
-  lv_obj_set_style_text_font(refs.bestLabel, &lv_font_montserrat_20, 0);
-  lv_obj_set_style_text_color(refs.bestLabel, lv_color_hex(0x8fa0b6), 0);
+  ui_style_add(refs.bestLabel, UI_STYLE_TITLE);
   lv_obj_align(refs.bestLabel, LV_ALIGN_CENTER, 0, 6);
 
   refs.armBtn = lv_btn_create(refs.root);
   lv_obj_set_size(refs.armBtn, 200, 56);
-  lv_obj_set_style_radius(refs.armBtn, 18, 0);
+  ui_style_add(refs.armBtn, UI_STYLE_BUTTON);
   lv_obj_set_style_bg_color(refs.armBtn, lv_color_hex(0x21c17a), 0);
-  lv_obj_set_style_bg_opa(refs.armBtn, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(refs.armBtn, 0, 0);
   lv_obj_align(refs.armBtn, LV_ALIGN_BOTTOM_MID, 0, -8);
   lv_obj_add_event_cb(refs.armBtn, on_arm_btn_event, LV_EVENT_CLICKED, nullptr);
 
   refs.armLabel = lv_label_create(refs.armBtn);
   lv_label_set_text(refs.armLabel, "ARM");
-  lv_obj_set_style_text_font(refs.armLabel, &lv_font_montserrat_24, 0);
+  ui_style_add(refs.armLabel, UI_STYLE_TEXT_24);
   lv_obj_center(refs.armLabel);
 
-  ReactionUiSnapshot snapshot{};
-  snapshot.state = REACTION_IDLE;
-  snapshot.amberCount = 0;
-  snapshot.greenOn = false;
-  snapshot.reactionCaptured = false;
-  snapshot.reactionMs = 0;
-  snapshot.armedCountdownSec = 0;
-  snapshot.bestReactionMs = 0;
-  screen_reaction_update(snapshot);
+  screen_reaction_update(lastSnapshot);
+}
+
+void screen_reaction_detach(void) {
+  if (!refs.root) return;
+  lv_obj_remove_event_cb(refs.root, on_root_event);
+  lv_obj_clean(refs.root);
+  ui_glow_sprite_free(&amberSprite);
+  ui_glow_sprite_free(&greenSprite);
+  refs = ReactionRefs{};
+  bound = ReactionBindings{};
 }
 
 void screen_reaction_set_swipe_left_handler(reaction_handler_t cb) {
@@ -173,13 +229,15 @@ void screen_reaction_set_arm_handler(reaction_handler_t cb) {
 }
 
 void screen_reaction_update(const ReactionUiSnapshot &snapshot) {
-  const lv_color_t amberColor = lv_color_hex(0xffc857);
+  ui_tile_activity_note(UI_TILE_SUBSYSTEM_REACTION_UPDATE);
+  lastSnapshot = snapshot;
+  if (!refs.root) return;
   for (int i = 0; i < 3; ++i) {
-    set_light(refs.amberLeft[i], amberColor, snapshot.amberCount > i);
-    set_light(refs.amberRight[i], amberColor, snapshot.amberCount > i);
+    set_light(refs.amberLeft[i], bound.amberLeft[i], snapshot.amberCount > i);
+    set_light(refs.amberRight[i], bound.amberRight[i], snapshot.amberCount > i);
   }
-  set_light(refs.greenLeft, lv_color_hex(0x3ddc97), snapshot.greenOn);
-  set_light(refs.greenRight, lv_color_hex(0x3ddc97), snapshot.greenOn);
+  set_light(refs.greenLeft, bound.greenLeft, snapshot.greenOn);
+  set_light(refs.greenRight, bound.greenRight, snapshot.greenOn);
 
   const char *stateText = "IDLE";
   switch (snapshot.state) {
@@ -205,34 +263,33 @@ void screen_reaction_update(const ReactionUiSnapshot &snapshot) {
   char stateLine[16];
   if (snapshot.state == REACTION_ARMED && snapshot.armedCountdownSec > 0) {
     snprintf(stateLine, sizeof(stateLine), "%u", (unsigned)snapshot.armedCountdownSec);
-    lv_label_set_text(refs.statusLabel, stateLine);
+    ui_bind_label(refs.statusLabel, stateLine);
   } else {
-    lv_label_set_text(refs.statusLabel, stateText);
+    ui_bind_label(refs.statusLabel, stateText);
   }
   update_status_style(snapshot.state);
 
-  char buffer[32];
+  char buffer[kUiFormatReactionMsMaxLen + 1];
   if (snapshot.reactionCaptured || snapshot.state == REACTION_WAIT_FOR_MOVE) {
-    format_reaction_ms(buffer, sizeof(buffer), snapshot.reactionMs);
-    char line[40];
+    ui_format_reaction_ms(buffer, sizeof(buffer), snapshot.reactionMs);
+    char line[sizeof("R/T: ") + kUiFormatReactionMsMaxLen];
     snprintf(line, sizeof(line), "R/T: %s", buffer);
-    lv_label_set_text(refs.rtLabel, line);
+    ui_bind_label(refs.rtLabel, line);
   } else {
-    lv_label_set_text(refs.rtLabel, "R/T: ---.---s");
+    ui_bind_label(refs.rtLabel, "R/T: ---.---s");
   }
 
   if (snapshot.bestReactionMs > 0) {
-    format_reaction_ms(buffer, sizeof(buffer), snapshot.bestReactionMs);
-    char bestLine[40];
+    ui_format_reaction_ms(buffer, sizeof(buffer), snapshot.bestReactionMs);
+    char bestLine[sizeof("Best R/T: ") + kUiFormatReactionMsMaxLen];
     snprintf(bestLine, sizeof(bestLine), "Best R/T: %s", buffer);
-    lv_label_set_text(refs.bestLabel, bestLine);
+    ui_bind_label(refs.bestLabel, bestLine);
   } else {
-    lv_label_set_text(refs.bestLabel, "Best R/T: ---.---s");
+    ui_bind_label(refs.bestLabel, "Best R/T: ---.---s");
   }
 
   const bool armEnabled = snapshot.state == REACTION_IDLE || snapshot.state == REACTION_FALSE_START;
-  lv_label_set_text(refs.armLabel, armEnabled ? "ARM" : "RESET");
-  lv_obj_set_style_bg_color(refs.armBtn,
-                            armEnabled ? lv_color_hex(0x21c17a) : lv_color_hex(0xe05a63),
-                            0);
+  ui_bind_label(refs.armLabel, armEnabled ? "ARM" : "RESET");
+  ui_bind_bg_color(refs.armBtn, bound.armBtnBg,
+                   armEnabled ? lv_color_hex(0x21c17a) : lv_color_hex(0xe05a63));
 }
@@ -0,0 +1,76 @@
+#include "ui_bind.h"
+
+#include <string.h>
+
+#include "ui_digit_clock.h"
+
+namespace {
+UiBindStats stats{};
+
+bool count(bool apply) {
+  if (apply) {
+    stats.applied++;
+  } else {
+    stats.skipped++;
+  }
+  return apply;
+}
+}  // namespace
+
+bool ui_bind_changed(UiBoundValue &bound, uint32_t value) {
+  if (bound.set && bound.value == value) return count(false);
+  bound.value = value;
+  bound.set = true;
+  return count(true);
+}
+
+bool ui_bind_label(lv_obj_t *label, const char *text) {
+  const char *current = lv_label_get_text(label);
+  if (current && strcmp(current, text) == 0) return count(false);
+  lv_label_set_text(label, text);
+  return count(true);
+}
+
+bool ui_bind_digit_clock(lv_obj_t *clock, const char *text) {
+  return count(ui_digit_clock_set_text(clock, text));
+}
+
+bool ui_bind_table_cell(lv_obj_t *table, uint16_t row, uint16_t col, const char *text) {
+  const char *current = lv_table_get_cell_value(table, row, col);
+  if (current && strcmp(current, text) == 0) return count(false);
+  lv_table_set_cell_value(table, row, col, text);
+  return count(true);
+}
+
+bool ui_bind_spinbox(lv_obj_t *spinbox, int32_t value) {
+  if (lv_spinbox_get_value(spinbox) == value) return count(false);
+  lv_spinbox_set_value(spinbox, value);
+  return count(true);
+}
+
+bool ui_bind_state(lv_obj_t *obj, lv_state_t state, bool on) {
+  if (lv_obj_has_state(obj, state) == on) return count(false);
+  if (on) {
+    lv_obj_add_state(obj, state);
+  } else {
+    lv_obj_clear_state(obj, state);
+  }
+  return count(true);
+}
+
+bool ui_bind_bg_color(lv_obj_t *obj, UiBoundValue &bound, lv_color_t color) {
+  if (!ui_bind_changed(bound, lv_color_to32(color))) return false;
+  lv_obj_set_style_bg_color(obj, color, 0);
+  return true;
+}
+
+bool ui_bind_text_color(lv_obj_t *obj, UiBoundValue &bound, lv_color_t color) {
+  if (!ui_bind_changed(bound, lv_color_to32(color))) return false;
+  lv_obj_set_style_text_color(obj, color, 0);
+  return true;
+}
+
+void ui_bind_take_stats(UiBindStats &out) {
+  out = stats;
+  stats = UiBindStats{};
+}
@@ -0,0 +1,46 @@
+#ifndef UI_BIND_H
+#define UI_BIND_H
+
+#ifndef LV_CONF_INCLUDE_SIMPLE
+#define LV_CONF_INCLUDE_SIMPLE
+#endif
+#include <lvgl.h>
+#include <stdint.h>
+
+// Widget bindings for the snapshot-driven screens. Every UI refresh pushes a whole
+// snapshot, but most fields are unchanged from the previous one; each setter below
+// compares the bound value with what the widget already shows and only calls into LVGL
+// (which reallocates text and invalidates the object) when it differs.
+//
+// Labels, digit clocks, table cells, spinboxes and object states are compared against the widget
+// itself. Style properties are not cheap to read back, so those compare against a
+// UiBoundValue kept next to the widget reference.
+
+struct UiBindStats {
+  uint32_t applied;  // Widget updates that reached LVGL.
+  uint32_t skipped;  // Updates dropped because the widget already showed the value.
+};
+
+// Last value applied through ui_bind_changed(); starts out unset so the first update
+// always applies.
+struct UiBoundValue {
+  uint32_t value;
+  bool set;
+};
+
+// Records value in bound and returns true when it differs from the previous one. For
+// properties the caller applies itself (e.g. several styles keyed on one flag).
+bool ui_bind_changed(UiBoundValue &bound, uint32_t value);
+
+bool ui_bind_label(lv_obj_t *label, const char *text);
+bool ui_bind_table_cell(lv_obj_t *table, uint16_t row, uint16_t col, const char *text);
+bool ui_bind_digit_clock(lv_obj_t *clock, const char *text);
+bool ui_bind_spinbox(lv_obj_t *spinbox, int32_t value);
+bool ui_bind_state(lv_obj_t *obj, lv_state_t state, bool on);
+bool ui_bind_bg_color(lv_obj_t *obj, UiBoundValue &bound, lv_color_t color);
+bool ui_bind_text_color(lv_obj_t *obj, UiBoundValue &bound, lv_color_t color);
+
+// Counters since the previous call.
+void ui_bind_take_stats(UiBindStats &out);
+
+#endif
@@ -0,0 +1,189 @@
+#include "ui_digit_clock.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+constexpr char kGlyphChars[] = "0123456789:.-+";
+constexpr uint8_t kGlyphCount = sizeof(kGlyphChars) - 1;
+constexpr uint8_t kMaxCells = 12;
+constexpr uint8_t kNoGlyph = 0xff;
+
+struct ClockGlyph {
+  lv_img_dsc_t img;
+  int16_t dx;      // Image offset inside the cell.
+  int16_t dy;
+  uint16_t cellW;  // Cell advance.
+};
+
+struct DigitClock {
+  ClockGlyph glyph[kGlyphCount];
+  lv_obj_t *cell[kMaxCells];
+  uint8_t cellGlyph[kMaxCells];
+  char text[kMaxCells + 1];
+  lv_coord_t width;
+  lv_coord_t startX;
+};
+
+uint8_t glyph_index(char ch) {
+  const char *p = strchr(kGlyphChars, ch);
+  return (ch && p) ? (uint8_t)(p - kGlyphChars) : kNoGlyph;
+}
+
+// Digits and signs share the widest digit's advance; ':' and '.' keep their own.
+bool is_fixed_pitch(char ch) {
+  return ch != ':' && ch != '.';
+}
+
+// Renders one glyph into a true-colour + alpha image, so drawing it is a plain alpha
+// blend with no font decoding. The pixels live outside LVGL's heap (LV_MEM_SIZE), which
+// is too small to hold a full set of 48 px glyphs. Returns false only when those pixels
+// cannot be allocated; a character the font lacks or draws empty is left blank.
+bool build_glyph(ClockGlyph &g, const lv_font_t *font, char ch, lv_color_t color) {
+  memset(&g, 0, sizeof(g));
+  lv_font_glyph_dsc_t dsc;
+  if (!lv_font_get_glyph_dsc(font, &dsc, (uint32_t)ch, 0)) return true;
+  g.cellW = dsc.adv_w;
+  g.dx = dsc.ofs_x;
+  g.dy = (int16_t)(font->line_height - font->base_line - dsc.box_h - dsc.ofs_y);
+
+  const uint8_t *bitmap = lv_font_get_glyph_bitmap(font, (uint32_t)ch);
+  const uint32_t pixels = (uint32_t)dsc.box_w * dsc.box_h;
+  if (!bitmap || pixels == 0 || (dsc.bpp != 1 && dsc.bpp != 2 && dsc.bpp != 4 && dsc.bpp != 8)) {
+    return true;
+  }
+  uint8_t *data = static_cast<uint8_t *>(malloc(pixels * LV_IMG_PX_SIZE_ALPHA_BYTE));
+  if (!data) return false;
+
+  // Glyph bitmaps are one MSB-first bit stream, rows are not byte aligned.
+  const uint8_t mask = (uint8_t)((1u << dsc.bpp) - 1);
+  uint8_t *out = data;
+  for (uint32_t i = 0; i < pixels; ++i) {
+    const uint32_t bit = i * dsc.bpp;
+    const uint8_t value = (bitmap[bit >> 3] >> (8 - dsc.bpp - (bit & 7))) & mask;
+    memcpy(out, &color, sizeof(lv_color_t));
+    out[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = (uint8_t)(value * 255u / mask);
+    out += LV_IMG_PX_SIZE_ALPHA_BYTE;
+  }
+
+  g.img.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+  g.img.header.w = dsc.box_w;
+  g.img.header.h = dsc.box_h;
+  g.img.data_size = pixels * LV_IMG_PX_SIZE_ALPHA_BYTE;
+  g.img.data = data;
+  return true;
+}
+
+void free_clock(DigitClock *clock) {
+  for (uint8_t i = 0; i < kGlyphCount; ++i) {
+    free(const_cast<uint8_t *>(clock->glyph[i].img.data));
+  }
+  lv_mem_free(clock);
+}
+
+void clock_delete_event(lv_event_t *e) {
+  free_clock(static_cast<DigitClock *>(lv_event_get_user_data(e)));
+}
+
+DigitClock *get_clock(lv_obj_t *obj) {
+  return static_cast<DigitClock *>(lv_obj_get_user_data(obj));
+}
+}  // namespace
+
+/******************************************************************************
+function : Create a digit clock
+parameter:
+    parent : parent object
+    font   : font the glyphs are rendered from
+    color  : text colour, baked into the glyph images
+    width  : width of the box the text is centred in
+******************************************************************************/
+lv_obj_t *ui_digit_clock_create(lv_obj_t *parent, const lv_font_t *font, lv_color_t color,
+                                lv_coord_t width) {
+  DigitClock *clock = static_cast<DigitClock *>(lv_mem_alloc(sizeof(DigitClock)));
+  if (!clock) return nullptr;
+  memset(clock, 0, sizeof(*clock));
+  clock->width = width;
+
+  lv_coord_t digitPitch = 0;
+  for (uint8_t i = 0; i < kGlyphCount; ++i) {
+    if (!build_glyph(clock->glyph[i], font, kGlyphChars[i], color)) {
+      free_clock(clock);
+      return nullptr;
+    }
+    if (i < 10 && clock->glyph[i].cellW > digitPitch) digitPitch = clock->glyph[i].cellW;
+  }
+  for (uint8_t i = 0; i < kGlyphCount; ++i) {
+    ClockGlyph &g = clock->glyph[i];
+    if (!is_fixed_pitch(kGlyphChars[i])) continue;
+    g.dx += (digitPitch - g.cellW) / 2;
+    g.cellW = digitPitch;
+  }
+
+  lv_obj_t *obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(obj);
+  lv_obj_set_size(obj, width, font->line_height);
+  lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_set_user_data(obj, clock);
+  lv_obj_add_event_cb(obj, clock_delete_event, LV_EVENT_DELETE, clock);
+
+  for (uint8_t i = 0; i < kMaxCells; ++i) {
+    clock->cell[i] = lv_img_create(obj);
+    lv_obj_add_flag(clock->cell[i], LV_OBJ_FLAG_HIDDEN);
+    clock->cellGlyph[i] = kNoGlyph;
+  }
+  return obj;
+}
+
+/******************************************************************************
+function : Show text on a digit clock
+parameter:
+    obj  : clock from ui_digit_clock_create()
+    text : new text, up to 12 characters
+******************************************************************************/
+bool ui_digit_clock_set_text(lv_obj_t *obj, const char *text) {
+  DigitClock *clock = get_clock(obj);
+  if (strncmp(clock->text, text, kMaxCells) == 0) return false;
+
+  uint8_t glyphs[kMaxCells];
+  uint8_t len = 0;
+  lv_coord_t totalW = 0;
+  while (len < kMaxCells && text[len]) {
+    glyphs[len] = glyph_index(text[len]);
+    totalW += glyphs[len] == kNoGlyph ? clock->glyph[0].cellW : clock->glyph[glyphs[len]].cellW;
+    len++;
+  }
+
+  // Cells only move when the width of the text changes; a running time keeps its layout
+  // and only the changed characters are touched.
+  const lv_coord_t startX = (clock->width - totalW) / 2;
+  const bool relayout = startX != clock->startX;
+  clock->startX = startX;
+
+  lv_coord_t x = startX;
+  for (uint8_t i = 0; i < kMaxCells; ++i) {
+    lv_obj_t *cell = clock->cell[i];
+    const uint8_t index = i < len ? glyphs[i] : kNoGlyph;
+    const ClockGlyph *g = index == kNoGlyph ? nullptr : &clock->glyph[index];
+    if (index != clock->cellGlyph[i] || (relayout && g)) {
+      if (g && g->img.data) {
+        lv_img_set_src(cell, &g->img);
+        lv_obj_set_pos(cell, x + g->dx, g->dy);
+        lv_obj_clear_flag(cell, LV_OBJ_FLAG_HIDDEN);
+      } else {
+        lv_obj_add_flag(cell, LV_OBJ_FLAG_HIDDEN);
+      }
+      clock->cellGlyph[i] = index;
+    }
+    if (i < len) x += g ? g->cellW : clock->glyph[0].cellW;
+  }
+
+  strncpy(clock->text, text, kMaxCells);
+  clock->text[kMaxCells] = '\0';
+  return true;
+}
+
+const char *ui_digit_clock_get_text(lv_obj_t *obj) {
+  return get_clock(obj)->text;
+}
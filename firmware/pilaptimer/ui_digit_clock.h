@@ -0,0 +1,26 @@
+#ifndef UI_DIGIT_CLOCK_H
+#define UI_DIGIT_CLOCK_H
+
+#ifndef LV_CONF_INCLUDE_SIMPLE
+#define LV_CONF_INCLUDE_SIMPLE
+#endif
+#include <lvgl.h>
+
+// Fixed-pitch clock text ("m:ss.mmm", "--:--.---", "+1.234") for the running lap time.
+// Each character is its own image cell showing a glyph rendered once at creation, so a
+// new time only invalidates the cells whose character changed; a label redraws its
+// whole box on every set_text. Digits and '-' share the widest digit's advance so the
+// layout does not move while the clock runs.
+//
+// Supported characters: 0-9 : . - +; anything else is left blank.
+
+// width is the box the text is centred in; the height is the font's line height.
+// Returns nullptr, with nothing created, when the clock or one of its glyph images
+// cannot be allocated.
+lv_obj_t *ui_digit_clock_create(lv_obj_t *parent, const lv_font_t *font, lv_color_t color,
+                                lv_coord_t width);
+// Returns false (nothing invalidated) when text is what the clock already shows.
+bool ui_digit_clock_set_text(lv_obj_t *clock, const char *text);
+const char *ui_digit_clock_get_text(lv_obj_t *clock);
+
+#endif
@@ -0,0 +1,601 @@
+/*******************************************************************************
+ * Size: 20 px
+ * Bpp: 4
+ * Subset of LVGL's lv_font_montserrat_20.c: 48 of 157 glyphs.
+ * Generated by firmware/host/font_subset from the UI sources. Do not edit;
+ * run `cmake --build <host build dir> --target ui_fonts` after changing UI text.
+ ******************************************************************************/
+
+#ifndef LV_CONF_INCLUDE_SIMPLE
+#define LV_CONF_INCLUDE_SIMPLE
+#endif
+#include <lvgl.h>
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+002B "+" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xf4, 0x6a, 0xaa,
+    0xfd, 0xaa, 0xa2, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xfa,
+    0x0, 0x0,
+
+    /* U+002D "-" */
+    0x9b, 0xbb, 0xb5, 0xdf, 0xff, 0xf8,
+
+    /* U+002E "." */
+    0x7, 0xb2, 0xf, 0xf8, 0xa, 0xe4,
+
+    /* U+002F */
+    0x0, 0x0, 0x0, 0x7, 0x50, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x0,
+    0xf, 0xc0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0xf, 0xc0, 0x0,
+    0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x5, 0xf6,
+    0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
+    0xbf, 0x10, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
+    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x1, 0x8d, 0xfe, 0xa3, 0x0, 0x0, 0x2, 0xef, 0xfd, 0xef, 0xf6, 0x0, 0x0, 0xdf, 0xa1,
+    0x0, 0x6f, 0xf2, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x7f, 0xb0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0xff,
+    0x0, 0xef, 0x10, 0x0, 0x0, 0xc, 0xf3, 0xf, 0xf0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0xff, 0x0,
+    0x0, 0x0, 0xa, 0xf5, 0xe, 0xf1, 0x0, 0x0, 0x0, 0xcf, 0x30, 0xbf, 0x40, 0x0, 0x0, 0xf,
+    0xf0, 0x6, 0xfc, 0x0, 0x0, 0x7, 0xfb, 0x0, 0xd, 0xfa, 0x10, 0x6, 0xff, 0x20, 0x0, 0x2e,
+    0xff, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x18, 0xdf, 0xea, 0x30, 0x0,
+
+    /* U+0031 "1" */
+    0xdf, 0xff, 0xf4, 0xac, 0xce, 0xf4, 0x0, 0xb, 0xf4, 0x0, 0xb, 0xf4, 0x0, 0xb, 0xf4, 0x0,
+    0xb, 0xf4, 0x0, 0xb, 0xf4, 0x0, 0xb, 0xf4, 0x0, 0xb, 0xf4, 0x0, 0xb, 0xf4, 0x0, 0xb,
+    0xf4, 0x0, 0xb, 0xf4, 0x0, 0xb, 0xf4, 0x0, 0xb, 0xf4,
+
+    /* U+0032 "2" */
+    0x0, 0x6c, 0xef, 0xea, 0x30, 0x2, 0xdf, 0xfe, 0xdf, 0xff, 0x50, 0x5f, 0x91, 0x0, 0x9, 0xfe,
+    0x0, 0x10, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x2f,
+    0xd0, 0x0, 0x0, 0x0, 0x1d, 0xf5, 0x0, 0x0, 0x0, 0x1c, 0xf8, 0x0, 0x0, 0x0, 0x1d, 0xf8,
+    0x0, 0x0, 0x0, 0x1d, 0xf8, 0x0, 0x0, 0x0, 0x2e, 0xf7, 0x0, 0x0, 0x0, 0x2e, 0xf6, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xcc, 0xcc, 0xcc, 0x94, 0xff, 0xff, 0xff, 0xff, 0xfc,
+
+    /* U+0033 "3" */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0x3, 0xcc, 0xcc, 0xcc, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x2f, 0xe2,
+    0x0, 0x0, 0x0, 0x1d, 0xf4, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xfe, 0x80, 0x0, 0x0, 0x6, 0x68, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x50, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x1, 0x0, 0x0, 0x0, 0xaf, 0x77, 0xe6, 0x10, 0x0,
+    0x6f, 0xf2, 0x7f, 0xff, 0xee, 0xff, 0xf6, 0x0, 0x28, 0xcf, 0xfe, 0xa3, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2e, 0xf2, 0x0, 0x6f, 0x70,
+    0x0, 0x0, 0xcf, 0x50, 0x0, 0x6f, 0x70, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2c, 0xcc, 0xcc, 0xcc, 0xdf, 0xec, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0x70, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xfc, 0xcc, 0xcc, 0xc0, 0x2, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xec, 0xca, 0x72,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x2, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xa0, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x2, 0x0, 0x0, 0x0, 0x6f, 0xa3, 0xf8, 0x20, 0x0,
+    0x5f, 0xf4, 0x4f, 0xff, 0xed, 0xff, 0xf9, 0x0, 0x17, 0xce, 0xfe, 0xb5, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x5b, 0xef, 0xeb, 0x60, 0x0, 0xb, 0xff, 0xec, 0xdf, 0xb0, 0x0, 0xaf, 0xb2, 0x0,
+    0x1, 0x10, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
+    0x6c, 0xff, 0xc6, 0x0, 0xf, 0xfa, 0xfd, 0xbc, 0xff, 0xa0, 0xf, 0xff, 0x60, 0x0, 0x2e, 0xf5,
+    0xf, 0xfa, 0x0, 0x0, 0x5, 0xfa, 0xc, 0xf7, 0x0, 0x0, 0x3, 0xfc, 0x7, 0xfa, 0x0, 0x0,
+    0x5, 0xfa, 0x1, 0xef, 0x60, 0x0, 0x2e, 0xf4, 0x0, 0x4f, 0xfe, 0xbc, 0xff, 0x80, 0x0, 0x1,
+    0x9d, 0xfe, 0xb4, 0x0,
+
+    /* U+0037 "7" */
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x6f, 0xec, 0xcc, 0xcc, 0xdf, 0xf1, 0x6f, 0x80, 0x0, 0x0,
+    0x6f, 0xa0, 0x6f, 0x80, 0x0, 0x0, 0xdf, 0x30, 0x14, 0x20, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x0,
+    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0, 0x0, 0x6,
+    0xfb, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x6, 0xce, 0xfe, 0xb5, 0x0, 0x0, 0xcf, 0xfc, 0xac, 0xff, 0xb0, 0x6, 0xfc, 0x10, 0x0,
+    0x2d, 0xf4, 0x9, 0xf6, 0x0, 0x0, 0x8, 0xf7, 0x6, 0xfb, 0x0, 0x0, 0x1d, 0xf4, 0x0, 0xaf,
+    0xea, 0x9a, 0xff, 0x80, 0x0, 0x5e, 0xff, 0xff, 0xfe, 0x40, 0x6, 0xfe, 0x61, 0x2, 0x7f, 0xf4,
+    0xe, 0xf3, 0x0, 0x0, 0x5, 0xfc, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0xff, 0xf, 0xf1, 0x0, 0x0,
+    0x3, 0xfe, 0xa, 0xfb, 0x10, 0x0, 0x2d, 0xf8, 0x1, 0xdf, 0xfc, 0xbc, 0xff, 0xc0, 0x0, 0x7,
+    0xce, 0xfe, 0xb6, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x3a, 0xef, 0xeb, 0x40, 0x0, 0x6, 0xff, 0xda, 0xcf, 0xf8, 0x0, 0x1f, 0xf4, 0x0, 0x1,
+    0xcf, 0x50, 0x5f, 0x90, 0x0, 0x0, 0x2f, 0xd0, 0x6f, 0x90, 0x0, 0x0, 0x3f, 0xf1, 0x2f, 0xf4,
+    0x0, 0x1, 0xcf, 0xf4, 0x8, 0xff, 0xda, 0xbf, 0xec, 0xf5, 0x0, 0x4b, 0xef, 0xd9, 0x1a, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0x90, 0x0, 0x40, 0x0, 0x1a, 0xfe, 0x10, 0x6, 0xfe, 0xdd, 0xff, 0xe3, 0x0, 0x3, 0xad,
+    0xfe, 0xc7, 0x10, 0x0,
+
+    /* U+003A ":" */
+    0xa, 0xe4, 0xf, 0xf8, 0x7, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xb2, 0xf, 0xf8, 0xa, 0xe4,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x1f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xf3, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x3, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0x50, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x5f, 0xb0, 0x0,
+    0x0, 0x8, 0xf7, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x6f, 0xda, 0xaa, 0xaa, 0xaa, 0xff, 0x10, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x9f, 0x80,
+    0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf6,
+
+    /* U+0042 "B" */
+    0xef, 0xff, 0xff, 0xfe, 0xb5, 0x0, 0xe, 0xfb, 0xaa, 0xab, 0xdf, 0xfa, 0x0, 0xef, 0x10, 0x0,
+    0x0, 0x4f, 0xf3, 0xe, 0xf1, 0x0, 0x0, 0x0, 0xaf, 0x60, 0xef, 0x10, 0x0, 0x0, 0xc, 0xf4,
+    0xe, 0xf1, 0x0, 0x0, 0x29, 0xfc, 0x0, 0xef, 0xff, 0xff, 0xff, 0xfd, 0x10, 0xe, 0xfb, 0xaa,
+    0xaa, 0xce, 0xfd, 0x10, 0xef, 0x10, 0x0, 0x0, 0x8, 0xfb, 0xe, 0xf1, 0x0, 0x0, 0x0, 0xf,
+    0xf0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xff, 0x1e, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xe0, 0xef, 0xba,
+    0xaa, 0xab, 0xef, 0xf4, 0xe, 0xff, 0xff, 0xff, 0xfd, 0x92, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x17, 0xce, 0xfe, 0xb5, 0x0, 0x0, 0x5, 0xef, 0xff, 0xde, 0xff, 0xc1, 0x0, 0x5f,
+    0xf9, 0x20, 0x0, 0x3b, 0xf5, 0x2, 0xff, 0x60, 0x0, 0x0, 0x0, 0x30, 0x8, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x0, 0x0, 0x30, 0x0, 0x5f, 0xfa,
+    0x30, 0x0, 0x3b, 0xf5, 0x0, 0x5, 0xef, 0xff, 0xdf, 0xff, 0xc1, 0x0, 0x0, 0x17, 0xce, 0xfe,
+    0xb5, 0x0,
+
+    /* U+0044 "D" */
+    0xef, 0xff, 0xff, 0xfd, 0xa4, 0x0, 0x0, 0xef, 0xdc, 0xcc, 0xdf, 0xff, 0xb1, 0x0, 0xef, 0x10,
+    0x0, 0x0, 0x5d, 0xfd, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0xef, 0x10, 0x0, 0x0,
+    0x0, 0x1f, 0xf1, 0xef, 0x10, 0x0, 0x0, 0x0, 0xa, 0xf6, 0xef, 0x10, 0x0, 0x0, 0x0, 0x8,
+    0xf8, 0xef, 0x10, 0x0, 0x0, 0x0, 0x7, 0xf8, 0xef, 0x10, 0x0, 0x0, 0x0, 0xa, 0xf6, 0xef,
+    0x10, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0xef, 0x10, 0x0, 0x0, 0x0, 0xbf, 0xa0, 0xef, 0x10, 0x0,
+    0x0, 0x5d, 0xfd, 0x10, 0xef, 0xcc, 0xcc, 0xdf, 0xff, 0xb1, 0x0, 0xef, 0xff, 0xff, 0xfd, 0xa4,
+    0x0, 0x0,
+
+    /* U+0045 "E" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xe, 0xfd, 0xcc, 0xcc, 0xcc, 0xc0, 0xef, 0x10, 0x0, 0x0, 0x0,
+    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xff, 0xf2, 0xe, 0xfc, 0xcc, 0xcc, 0xcc, 0x10, 0xef, 0x10, 0x0, 0x0,
+    0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xcc, 0xcc, 0xcc, 0xcc, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xf4,
+
+    /* U+0046 "F" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdc, 0xcc, 0xcc, 0xcc, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef,
+    0x10, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0xcc,
+    0xcc, 0xcc, 0xc1, 0xef, 0xff, 0xff, 0xff, 0xf2, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0,
+    0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0,
+    0x0, 0xef, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x16, 0xce, 0xfe, 0xb6, 0x0, 0x0, 0x5, 0xef, 0xff, 0xde, 0xff, 0xd2, 0x0, 0x5f,
+    0xf9, 0x20, 0x0, 0x29, 0xf7, 0x2, 0xff, 0x60, 0x0, 0x0, 0x0, 0x20, 0x8, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x11, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x8,
+    0xfa, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x1, 0xff, 0x60, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x5f, 0xfa,
+    0x30, 0x0, 0x2a, 0xfb, 0x0, 0x4, 0xef, 0xff, 0xdf, 0xff, 0xe4, 0x0, 0x0, 0x17, 0xce, 0xfe,
+    0xb6, 0x0,
+
+    /* U+0049 "I" */
+    0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef,
+    0x1e, 0xf1, 0xef, 0x1e, 0xf1,
+
+    /* U+004C "L" */
+    0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef,
+    0x10, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0x10,
+    0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0,
+    0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xef, 0xcc, 0xcc, 0xcc,
+    0xc8, 0xef, 0xff, 0xff, 0xff, 0xfb,
+
+    /* U+004D "M" */
+    0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xef,
+    0xf3, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfe, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xef, 0x9f,
+    0x60, 0x0, 0x0, 0x4f, 0xaf, 0xfe, 0xf1, 0xee, 0x10, 0x0, 0xd, 0xf1, 0xff, 0xef, 0x6, 0xf9,
+    0x0, 0x7, 0xf7, 0xe, 0xfe, 0xf0, 0xc, 0xf3, 0x1, 0xfd, 0x0, 0xef, 0xef, 0x0, 0x3f, 0xc0,
+    0xaf, 0x40, 0xe, 0xfe, 0xf0, 0x0, 0x9f, 0x9f, 0xa0, 0x0, 0xef, 0xef, 0x0, 0x1, 0xef, 0xf1,
+    0x0, 0xe, 0xfe, 0xf0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0xef, 0xef, 0x0, 0x0, 0x4, 0x0, 0x0,
+    0xe, 0xfe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+
+    /* U+004E "N" */
+    0xef, 0x20, 0x0, 0x0, 0x0, 0xdf, 0x2e, 0xfd, 0x10, 0x0, 0x0, 0xd, 0xf2, 0xef, 0xfb, 0x0,
+    0x0, 0x0, 0xdf, 0x2e, 0xfe, 0xf8, 0x0, 0x0, 0xd, 0xf2, 0xef, 0x4f, 0xf5, 0x0, 0x0, 0xdf,
+    0x2e, 0xf1, 0x5f, 0xf3, 0x0, 0xd, 0xf2, 0xef, 0x10, 0x8f, 0xe1, 0x0, 0xdf, 0x2e, 0xf1, 0x0,
+    0xbf, 0xc0, 0xd, 0xf2, 0xef, 0x10, 0x1, 0xdf, 0x90, 0xdf, 0x2e, 0xf1, 0x0, 0x2, 0xff, 0x6d,
+    0xf2, 0xef, 0x10, 0x0, 0x5, 0xff, 0xff, 0x2e, 0xf1, 0x0, 0x0, 0x8, 0xff, 0xf2, 0xef, 0x10,
+    0x0, 0x0, 0xb, 0xff, 0x2e, 0xf1, 0x0, 0x0, 0x0, 0xd, 0xf2,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x16, 0xce, 0xfe, 0xb5, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfe, 0xdf, 0xff, 0xd3, 0x0,
+    0x0, 0x5f, 0xf9, 0x20, 0x0, 0x3b, 0xff, 0x20, 0x1, 0xff, 0x60, 0x0, 0x0, 0x0, 0x9f, 0xd0,
+    0x8, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
+    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
+    0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5,
+    0x1, 0xff, 0x60, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x5f, 0xfa, 0x20, 0x0, 0x3b, 0xff, 0x20,
+    0x0, 0x4, 0xef, 0xff, 0xdf, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x17, 0xce, 0xfe, 0xb5, 0x0, 0x0,
+
+    /* U+0050 "P" */
+    0xef, 0xff, 0xff, 0xec, 0x70, 0x0, 0xef, 0xdc, 0xcd, 0xef, 0xfd, 0x20, 0xef, 0x10, 0x0, 0x2,
+    0xbf, 0xc0, 0xef, 0x10, 0x0, 0x0, 0xe, 0xf3, 0xef, 0x10, 0x0, 0x0, 0xa, 0xf5, 0xef, 0x10,
+    0x0, 0x0, 0xb, 0xf5, 0xef, 0x10, 0x0, 0x0, 0x2f, 0xf2, 0xef, 0x10, 0x0, 0x15, 0xdf, 0xa0,
+    0xef, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xef, 0xcc, 0xcc, 0xb9, 0x40, 0x0, 0xef, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0052 "R" */
+    0xef, 0xff, 0xff, 0xec, 0x70, 0x0, 0xef, 0xdc, 0xcd, 0xef, 0xfd, 0x20, 0xef, 0x10, 0x0, 0x2,
+    0xbf, 0xc0, 0xef, 0x10, 0x0, 0x0, 0xe, 0xf3, 0xef, 0x10, 0x0, 0x0, 0xa, 0xf5, 0xef, 0x10,
+    0x0, 0x0, 0xb, 0xf5, 0xef, 0x10, 0x0, 0x0, 0x2f, 0xf2, 0xef, 0x10, 0x0, 0x15, 0xdf, 0xa0,
+    0xef, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xef, 0xcc, 0xcb, 0xdf, 0x90, 0x0, 0xef, 0x10, 0x0, 0x1e,
+    0xf2, 0x0, 0xef, 0x10, 0x0, 0x4, 0xfd, 0x0, 0xef, 0x10, 0x0, 0x0, 0x9f, 0x90, 0xef, 0x10,
+    0x0, 0x0, 0xd, 0xf4,
+
+    /* U+0053 "S" */
+    0x0, 0x6, 0xce, 0xfe, 0xc7, 0x10, 0x0, 0xcf, 0xfd, 0xcd, 0xff, 0xd0, 0x8, 0xfc, 0x20, 0x0,
+    0x17, 0x60, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x71, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xd9, 0x40, 0x0, 0x0, 0x1, 0x6a, 0xef, 0xfe, 0x40,
+    0x0, 0x0, 0x0, 0x3, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x1, 0x0, 0x0, 0x0,
+    0x7, 0xf8, 0xd, 0xb3, 0x0, 0x0, 0x3e, 0xf4, 0xa, 0xff, 0xfc, 0xce, 0xff, 0x90, 0x0, 0x39,
+    0xdf, 0xfe, 0xa4, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbc, 0xcc, 0xdf, 0xfc, 0xcc, 0xc8, 0x0, 0x0, 0x2f, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xd0, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0xf, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xff, 0x0, 0x0, 0x0, 0x2, 0xfd, 0xf, 0xf0, 0x0,
+    0x0, 0x0, 0x2f, 0xd0, 0xff, 0x0, 0x0, 0x0, 0x2, 0xfd, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x2f,
+    0xd0, 0xff, 0x0, 0x0, 0x0, 0x2, 0xfd, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xff, 0x0,
+    0x0, 0x0, 0x2, 0xfc, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0xdf, 0x30, 0x0, 0x0, 0x5,
+    0xfa, 0x9, 0xf9, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x2f, 0xf8, 0x0, 0x1, 0xaf, 0xe0, 0x0, 0x5f,
+    0xff, 0xde, 0xff, 0xe3, 0x0, 0x0, 0x29, 0xdf, 0xfd, 0x81, 0x0,
+
+    /* U+0056 "V" */
+    0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x4, 0xfb, 0x0,
+    0x0, 0x1f, 0xf2, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x2f, 0xd0, 0x0,
+    0x0, 0x2, 0xff, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x1, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xd0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0xe, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xfb, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xef, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x3f, 0xd0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x2, 0xfb, 0xd, 0xf3, 0x0, 0x0, 0x1,
+    0xff, 0xc0, 0x0, 0x0, 0x8, 0xf5, 0x8, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf1, 0x0, 0x0, 0xd,
+    0xf1, 0x3, 0xfd, 0x0, 0x0, 0xc, 0xf8, 0xf7, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0xdf, 0x30, 0x0,
+    0x2f, 0xb2, 0xfc, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x8f, 0x80, 0x0, 0x7f, 0x50, 0xcf, 0x10, 0x0,
+    0xdf, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0xdf, 0x0, 0x7f, 0x70, 0x3, 0xfb, 0x0, 0x0, 0xd, 0xf3,
+    0x2, 0xfa, 0x0, 0x2f, 0xc0, 0x8, 0xf5, 0x0, 0x0, 0x8, 0xf8, 0x8, 0xf5, 0x0, 0xc, 0xf2,
+    0xe, 0xf0, 0x0, 0x0, 0x3, 0xfd, 0xd, 0xf0, 0x0, 0x7, 0xf7, 0x3f, 0xb0, 0x0, 0x0, 0x0,
+    0xdf, 0x6f, 0xa0, 0x0, 0x1, 0xfc, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x40, 0x0, 0x0,
+    0xcf, 0xef, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0x0,
+
+    /* U+0059 "Y" */
+    0xc, 0xf5, 0x0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x2f, 0xe1, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0,
+    0x8f, 0x90, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0xef, 0x30, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x5,
+    0xfc, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xf6, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xe1, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0,
+
+    /* U+0061 "a" */
+    0x5, 0xbe, 0xfe, 0xb4, 0x0, 0x7f, 0xfd, 0xbd, 0xff, 0x50, 0x2a, 0x10, 0x0, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0xd, 0xf2, 0x0, 0x1, 0x11, 0x1c, 0xf3, 0x8, 0xef, 0xff, 0xff, 0xf3, 0x9f, 0xc6,
+    0x44, 0x4c, 0xf3, 0xff, 0x0, 0x0, 0xb, 0xf3, 0xef, 0x10, 0x0, 0x3f, 0xf3, 0x8f, 0xd7, 0x69,
+    0xfe, 0xf3, 0x6, 0xcf, 0xfc, 0x59, 0xf3,
+
+    /* U+0065 "e" */
+    0x0, 0x4, 0xbe, 0xfc, 0x60, 0x0, 0x0, 0x8f, 0xfc, 0xbe, 0xfc, 0x0, 0x5, 0xfd, 0x20, 0x0,
+    0xaf, 0x80, 0xc, 0xf3, 0x0, 0x0, 0xd, 0xf0, 0xf, 0xe1, 0x11, 0x11, 0x19, 0xf4, 0x2f, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0xf, 0xe4, 0x44, 0x44, 0x44, 0x41, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xfe, 0x40, 0x0, 0x2b, 0x20, 0x0, 0x7f, 0xfe, 0xcd, 0xff, 0x60, 0x0, 0x3, 0xae, 0xfe,
+    0xa3, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x6, 0xdf, 0xd6, 0x0, 0x6f, 0xea, 0xc6, 0x0, 0xcf, 0x20, 0x0, 0x0, 0xef, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xf1, 0x7a, 0xff, 0xaa, 0xa0, 0x0, 0xef, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
+    0x0, 0xef, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
+    0x0, 0xef, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
+
+    /* U+0069 "i" */
+    0x3e, 0xb0, 0x7f, 0xf0, 0x8, 0x40, 0x0, 0x0, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0,
+    0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0, 0x3f, 0xb0,
+
+    /* U+006B "k" */
+    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x2, 0xdf, 0x50, 0x3f, 0xb0,
+    0x0, 0x2e, 0xf6, 0x0, 0x3f, 0xb0, 0x3, 0xef, 0x60, 0x0, 0x3f, 0xb0, 0x3f, 0xf6, 0x0, 0x0,
+    0x3f, 0xb4, 0xff, 0x90, 0x0, 0x0, 0x3f, 0xef, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0x59, 0xfd,
+    0x0, 0x0, 0x3f, 0xf4, 0x0, 0xcf, 0x90, 0x0, 0x3f, 0xb0, 0x0, 0x1e, 0xf6, 0x0, 0x3f, 0xb0,
+    0x0, 0x4, 0xff, 0x20, 0x3f, 0xb0, 0x0, 0x0, 0x7f, 0xd0,
+
+    /* U+006E "n" */
+    0x3f, 0xa2, 0xae, 0xfe, 0x91, 0x3, 0xfd, 0xff, 0xcb, 0xef, 0xd0, 0x3f, 0xfc, 0x10, 0x1, 0xcf,
+    0x73, 0xff, 0x20, 0x0, 0x4, 0xfc, 0x3f, 0xd0, 0x0, 0x0, 0x1f, 0xd3, 0xfb, 0x0, 0x0, 0x0,
+    0xfe, 0x3f, 0xb0, 0x0, 0x0, 0xf, 0xe3, 0xfb, 0x0, 0x0, 0x0, 0xfe, 0x3f, 0xb0, 0x0, 0x0,
+    0xf, 0xe3, 0xfb, 0x0, 0x0, 0x0, 0xfe, 0x3f, 0xb0, 0x0, 0x0, 0xf, 0xe0,
+
+    /* U+0070 "p" */
+    0x3f, 0xa2, 0x9e, 0xfd, 0x92, 0x0, 0x3f, 0xce, 0xfb, 0xad, 0xfe, 0x40, 0x3f, 0xfd, 0x20, 0x0,
+    0x6f, 0xe1, 0x3f, 0xf3, 0x0, 0x0, 0x9, 0xf7, 0x3f, 0xd0, 0x0, 0x0, 0x4, 0xfa, 0x3f, 0xb0,
+    0x0, 0x0, 0x2, 0xfc, 0x3f, 0xd0, 0x0, 0x0, 0x4, 0xfa, 0x3f, 0xf3, 0x0, 0x0, 0xa, 0xf7,
+    0x3f, 0xfe, 0x30, 0x0, 0x8f, 0xe1, 0x3f, 0xde, 0xfd, 0xce, 0xff, 0x40, 0x3f, 0xb1, 0x9e, 0xfe,
+    0x92, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x5c, 0xef, 0xea, 0x50, 0x9, 0xff, 0xcb, 0xdf, 0xd0, 0x1f, 0xe1, 0x0, 0x2, 0x30, 0x2f,
+    0xd0, 0x0, 0x0, 0x0, 0xd, 0xfc, 0x63, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xfb, 0x30, 0x0, 0x1,
+    0x47, 0xbf, 0xf2, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x9, 0x30, 0x0, 0xb, 0xf5, 0x5f, 0xfe, 0xbb,
+    0xef, 0xc0, 0x5, 0xae, 0xfe, 0xc7, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x78, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf1,
+    0x7a, 0xff, 0xaa, 0xa0, 0x0, 0xef, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
+    0x0, 0xef, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0,
+    0x0, 0x6f, 0xfb, 0xd7, 0x0, 0x7, 0xdf, 0xd5,
+
+    /* U+0078 "x" */
+    0x2f, 0xe1, 0x0, 0x0, 0xdf, 0x30, 0x6f, 0xb0, 0x0, 0xaf, 0x60, 0x0, 0xaf, 0x70, 0x6f, 0xa0,
+    0x0, 0x0, 0xdf, 0x5f, 0xd1, 0x0, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xf6, 0x0, 0x0, 0x2, 0xfe, 0x2e, 0xf2, 0x0, 0x0, 0xdf, 0x40, 0x3f,
+    0xd0, 0x0, 0x9f, 0x80, 0x0, 0x8f, 0xa0, 0x5f, 0xc0, 0x0, 0x0, 0xcf, 0x60,
+
+    /* U+F00C */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0x60, 0x6, 0xe4, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf6, 0x0, 0x7f, 0xff, 0x40, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0x60, 0x0, 0xff, 0xff, 0xf4, 0x0, 0x4, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0x40, 0x4f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf8, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F021 */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x7, 0xba, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xff,
+    0xb5, 0x0, 0xb, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xb, 0xff, 0x0, 0xa,
+    0xff, 0xff, 0xdb, 0xbe, 0xff, 0xff, 0x9a, 0xff, 0x0, 0xaf, 0xff, 0xa2, 0x0, 0x0, 0x3b, 0xff,
+    0xff, 0xff, 0x5, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xd, 0xff, 0x60, 0x0,
+    0x0, 0x7, 0xba, 0x9c, 0xff, 0xff, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0x7f, 0xf6, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x6f, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xcf, 0xf3, 0xff, 0xff, 0xc9, 0xaa,
+    0x70, 0x0, 0x0, 0x7, 0xff, 0xd0, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x50,
+    0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x3b, 0xff, 0xf9, 0x0, 0xff, 0xa9, 0xff, 0xff, 0xeb, 0xbd,
+    0xff, 0xff, 0xa0, 0x0, 0xff, 0xb0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xff, 0xb0,
+    0x0, 0x5b, 0xff, 0xff, 0xc8, 0x10, 0x0, 0x0, 0xab, 0x70, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 86, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 186, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 50, .adv_w = 123, .box_w = 6, .box_h = 2, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 56, .adv_w = 73, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 62, .adv_w = 113, .box_w = 9, .box_h = 20, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 152, .adv_w = 213, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 243, .adv_w = 118, .box_w = 6, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 285, .adv_w = 184, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 362, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 439, .adv_w = 214, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 537, .adv_w = 184, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 614, .adv_w = 197, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 698, .adv_w = 191, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 782, .adv_w = 206, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 866, .adv_w = 197, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 950, .adv_w = 73, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 972, .adv_w = 234, .box_w = 16, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1084, .adv_w = 242, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1175, .adv_w = 231, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1273, .adv_w = 264, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1371, .adv_w = 214, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1448, .adv_w = 203, .box_w = 10, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1518, .adv_w = 247, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1616, .adv_w = 99, .box_w = 3, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1637, .adv_w = 190, .box_w = 10, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1707, .adv_w = 306, .box_w = 15, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1812, .adv_w = 260, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1903, .adv_w = 269, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2015, .adv_w = 231, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2099, .adv_w = 233, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2183, .adv_w = 199, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2267, .adv_w = 188, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2351, .adv_w = 253, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2442, .adv_w = 228, .box_w = 16, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2554, .adv_w = 360, .box_w = 22, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2708, .adv_w = 207, .box_w = 15, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2813, .adv_w = 191, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2868, .adv_w = 196, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2934, .adv_w = 113, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2994, .adv_w = 89, .box_w = 4, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3024, .adv_w = 197, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3114, .adv_w = 218, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3175, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 3265, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3320, .adv_w = 132, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3376, .adv_w = 177, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3437, .adv_w = 320, .box_w = 20, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3587, .adv_w = 320, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = -3}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+/*Glyph id per code point, 0 = not in the subset*/
+static const uint8_t glyph_id_ofs_list_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 4, 5,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 0, 0, 0, 0, 0,
+    0, 17, 18, 19, 20, 21, 22, 23, 0, 24, 0, 0, 25, 26, 27, 28,
+    29, 0, 30, 31, 32, 33, 34, 35, 0, 36, 0, 0, 0, 0, 0, 0,
+    0, 37, 0, 0, 0, 38, 39, 0, 0, 40, 0, 41, 0, 0, 42, 0,
+    43, 0, 0, 44, 45, 0, 0, 0, 46, 0,
+};
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0x15,
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 89, .glyph_id_start = 0,
+        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 89, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    },
+    {
+        .range_start = 61452, .range_length = 22, .glyph_id_start = 47,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] =
+{
+    0, 0, 2, 2, 3, 4, 5, 0, 6, 7, 8, 9, 10, 11, 12, 5,
+    13, 15, 16, 17, 14, 18, 19, 20, 21, 23, 21, 21, 14, 24, 25, 1,
+    26, 22, 27, 27, 28, 29, 31, 32, 33, 34, 29, 30, 35, 36, 37, 0,
+    0,
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] =
+{
+    0, 0, 2, 2, 3, 4, 5, 6, 7, 8, 9, 10, 5, 11, 12, 13,
+    14, 16, 17, 15, 17, 17, 17, 15, 17, 17, 17, 17, 15, 17, 17, 1,
+    18, 19, 20, 20, 21, 22, 23, 0, 24, 0, 25, 25, 26, 27, 28, 0,
+    0,
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] =
+{
+    0, 5, 6, 0, 0, -3, 0, -2, 3, 0, -3, 0, -3, -2, 0, 0,
+    0, -3, 0, 0, -5, 0, 0, 0, 0, 0, 0, -3, 0, 1, -2, 0,
+    2, -6, -4, -6, 2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 32, -4, -4, 3, 3,
+    -3, 0, -4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -22, -31, -22, -6, 10, 0, 0, -21, 0, 4, -7,
+    0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, -4, -6, 0, -1, -1, -3, 0, 0, -2, 0, 0, 0, 0, -3,
+    0, -6, 0, -8, -11, 0, 0, 0, 0, 0, 3, -3, 0, -2, 3, 3,
+    -1, 0, 0, 0, -6, 0, -1, 0, 0, 0, 0, 1, 0, -2, 0, -4,
+    -5, 0, -3, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, -2,
+    0, -3, -4, 0, 0, 0, 0, 1, 0, -2, 0, -3, -3, 0, 0, 0,
+    0, 0, 0, -4, -2, 3, 6, 9, 0, -8, -1, -4, 0, -1, -15, 3,
+    -2, 2, 3, 0, 0, -17, 0, -17, -28, 9, 4, 0, 0, 0, 1, -4,
+    0, 0, 0, 0, 0, 0, -2, -2, 0, -2, -4, 0, 0, 0, 0, 0,
+    0, -3, 0, -2, -3, 0, 0, 0, 0, 0, 0, -3, 0, 2, 3, 3,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 2, 0, -3, 0, -3,
+    -4, 0, 3, 0, 0, 0, 0, -5, -2, -16, -17, -13, -6, 3, 0, -3,
+    -21, -6, 0, -6, 0, -6, -6, -20, 0, 0, 0, 2, 3, -12, -16, -8,
+    -8, -10, -4, -6, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -3, 0, -5, -7, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -6, -6,
+    0, -3, -3, -4, 0, 0, 0, 0, 0, 0, 0, -3, 0, -3, 0, -7,
+    -10, 0, 0, 0, 0, 0, 2, -4, 0, -6, 11, 10, -3, -13, 0, 3,
+    -5, 0, -16, -2, -4, 3, -3, 4, 0, -11, -5, -12, -13, 0, -2, 0,
+    0, -2, -2, -11, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 0, -2, -5, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, 4, 0, -7, 3, -2, -1, -8, -3, 0, -4, -3, -2, -5, -5,
+    0, -3, -1, -2, -4, -2, -7, 0, 0, -6, 0, -5, 0, -6, 3, 0,
+    -4, 0, -2, -4, -10, -2, -2, -2, -1, -2, -1, 0, 0, 0, 0, -3,
+    -3, -2, -2, 0, 0, -2, -4, -4, -1, 0, -3, -13, -4, 5, 0, 0,
+    -15, -5, 3, -5, 2, 0, -3, -10, 0, 2, 0, 0, 0, -6, -5, -3,
+    -3, -3, 0, -6, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, -4, 0, 0,
+    -3, 0, 0, 0, 0, 0, 0, -2, -2, -3, 10, 7, -7, -12, 0, 1,
+    -10, 0, -16, -2, -3, 6, -4, 1, 0, -21, -4, -17, -23, 1, -2, 0,
+    0, 0, -2, -2, 0, -1, -9, -15, 0, 0, -2, -5, -10, -3, 0, -2,
+    0, 0, 0, -14, -3, -10, -3, -5, -3, -5, -4, -6, -6, 0, 2, -11,
+    0, -1, 0, 0, 0, 0, 0, -2, -6, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, -3, -2, 0, 0, 0, 0, 2, 0, -3, -11, -10, -6,
+    -6, 13, 6, 3, -28, -2, 6, -3, 0, -3, -3, -11, 0, 3, -4, -3,
+    -3, -9, -18, -4, -4, -12, 1, -11, -5, -7, -12, -13, -8, 10, 0, 1,
+    -23, -3, 3, -5, -2, -7, -7, -12, -5, -3, 0, 0, -7, -18, -18, -4,
+    -11, -19, -1, -11, -5, -10, -12, -6, -11, 11, -3, 2, -30, -6, 6, -7,
+    -5, -12, -10, -13, -4, -3, -3, -7, -1, -21, -19, -7, -12, -22, -6, -16,
+    0, 0, 0, 0, 0, -7, -2, 0, 0, 0, -7, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 3, -4, 0,
+    0, -9, -3, -7, 0, 0, -9, 0, -3, 0, 0, -4, 0, -26, -6, -13,
+    -12, -2, 0, 0, 0, 0, 0, -6, 0, 3, 0, 0, 0, -9, -3, -6,
+    0, 0, -9, 0, -3, 0, 0, 0, 0, -31, 0, -6, -16, -5, 0, 0,
+    0, 0, 0, -5, 0, -3, -3, -10, 4, 16, 5, 7, -9, 4, 13, 4,
+    9, 7, 0, 0, 0, 0, 0, 0, 0, -3, -3, 26, 26, 0, 0, 0,
+    -5, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -27, -4, -3, -16, 0, 0, 0, 0, 0, 0, 0, 0, -7, 3, 0,
+    -3, 3, 6, 3, -10, 0, -1, -3, 3, 0, 0, 0, 0, -8, 0, -3,
+    -6, -3, -7, -2, -2, -5, 0, -6, 0, 0, 0, 0, 0, -2, -3, -3,
+    0, 0, -9, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -3, 3, 0, -5, -6, -2, 0, -9, -2, -7, -2,
+    -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0, 0, 0, -4, 0,
+    -3, -7, 0, 3, -3, 3, 0, 0, -11, 0, -2, -1, 0, -3, -3, 0,
+    0, -13, -4, -7, -10, -3, -6, 0, 0, -3, 0, 0,
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes =
+{
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 37,
+    .right_class_cnt     = 28,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t ui_font_montserrat_20 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 22,          /*The maximum line height required by the font*/
+    .base_line = 4,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
@@ -0,0 +1,699 @@
+/*******************************************************************************
+ * Size: 24 px
+ * Bpp: 4
+ * Subset of LVGL's lv_font_montserrat_24.c: 48 of 157 glyphs.
+ * Generated by firmware/host/font_subset from the UI sources. Do not edit;
+ * run `cmake --build <host build dir> --target ui_fonts` after changing UI text.
+ ******************************************************************************/
+
+#ifndef LV_CONF_INCLUDE_SIMPLE
+#define LV_CONF_INCLUDE_SIMPLE
+#endif
+#include <lvgl.h>
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+002B "+" */
+    0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x5e, 0xee, 0xef, 0xfe, 0xee, 0xe5, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
+    0x0, 0x0,
+
+    /* U+002D "-" */
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xd0,
+
+    /* U+002E "." */
+    0x4, 0x10, 0x9f, 0xf1, 0xdf, 0xf4, 0x6f, 0xb0,
+
+    /* U+002F */
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0x9, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0xa, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0xa, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0xb, 0xf6,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0xb, 0xf5,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0xc, 0xf5,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0xd, 0xf4,
+    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x1, 0x8d, 0xff, 0xd8, 0x10, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x1, 0xff,
+    0xe7, 0x33, 0x7e, 0xff, 0x10, 0xb, 0xfe, 0x20, 0x0, 0x2, 0xef, 0xb0, 0x2f, 0xf5, 0x0, 0x0,
+    0x0, 0x5f, 0xf2, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0xe, 0xf7, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0xb,
+    0xfa, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x9, 0xfc, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x8, 0xfd, 0xcf,
+    0x90, 0x0, 0x0, 0x0, 0x9, 0xfc, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0xe, 0xf7, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0xb, 0xfe, 0x10, 0x0, 0x2,
+    0xef, 0xb0, 0x1, 0xff, 0xe7, 0x33, 0x7e, 0xff, 0x10, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xe2, 0x0,
+    0x0, 0x1, 0x7c, 0xee, 0xc7, 0x10, 0x0,
+
+    /* U+0031 "1" */
+    0xdf, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf5, 0x11, 0x11, 0xff, 0x50, 0x0, 0xf, 0xf5, 0x0, 0x0,
+    0xff, 0x50, 0x0, 0xf, 0xf5, 0x0, 0x0, 0xff, 0x50, 0x0, 0xf, 0xf5, 0x0, 0x0, 0xff, 0x50,
+    0x0, 0xf, 0xf5, 0x0, 0x0, 0xff, 0x50, 0x0, 0xf, 0xf5, 0x0, 0x0, 0xff, 0x50, 0x0, 0xf,
+    0xf5, 0x0, 0x0, 0xff, 0x50, 0x0, 0xf, 0xf5, 0x0, 0x0, 0xff, 0x50,
+
+    /* U+0032 "2" */
+    0x0, 0x17, 0xce, 0xfe, 0xc6, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x6f, 0xfc, 0x63,
+    0x35, 0xbf, 0xfa, 0x0, 0x97, 0x0, 0x0, 0x0, 0xaf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0x70, 0x0, 0x0, 0x0, 0x2, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xd1,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xd1, 0x0, 0x0, 0x0, 0x3, 0xef, 0xc1, 0x0, 0x0, 0x0, 0x3,
+    0xef, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc2, 0x11, 0x11,
+    0x11, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+
+    /* U+0033 "3" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1, 0x11, 0x11,
+    0x11, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xfc, 0x71, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x15, 0xef,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x81, 0xa1, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x9f, 0xfa, 0x53, 0x34, 0x9f,
+    0xfd, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x49, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x60, 0x0, 0x9d, 0x70, 0x0,
+    0x0, 0x1e, 0xfa, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0xbf, 0x90, 0x0,
+    0x7, 0xff, 0x41, 0x11, 0x11, 0xbf, 0x91, 0x11, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xbf, 0x81,
+    0x11, 0x11, 0x11, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x31, 0x10, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xfe, 0xa3, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x26, 0xdf,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xd0, 0x93, 0x0, 0x0, 0x0, 0x1e, 0xfa, 0x5f, 0xfb, 0x63, 0x24, 0x7e,
+    0xff, 0x31, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x28, 0xce, 0xfe, 0xc8, 0x10, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xb5, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0xcf,
+    0xf9, 0x42, 0x23, 0x76, 0x0, 0x8, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x5b, 0xef, 0xd9, 0x30,
+    0x0, 0xbf, 0x9a, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xdf, 0xff, 0xc4, 0x1, 0x4c, 0xff, 0x40, 0xcf,
+    0xfc, 0x0, 0x0, 0x0, 0xcf, 0xc0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x8f, 0xf2, 0x0,
+    0x0, 0x0, 0x3f, 0xf1, 0x4f, 0xf4, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0xd, 0xfc, 0x0, 0x0, 0x0,
+    0xbf, 0xb0, 0x4, 0xff, 0xc3, 0x0, 0x3b, 0xff, 0x30, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x1, 0x8d, 0xff, 0xd9, 0x20, 0x0,
+
+    /* U+0037 "7" */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x4f, 0xf2,
+    0x11, 0x11, 0x11, 0x8f, 0xf1, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0xef, 0x90, 0x4f, 0xf0, 0x0, 0x0,
+    0x5, 0xff, 0x20, 0x2, 0x20, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x6, 0xbe, 0xff, 0xd9, 0x20, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xd, 0xff,
+    0x71, 0x0, 0x4b, 0xff, 0x40, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x4f, 0xf1, 0x0, 0x0,
+    0x0, 0x9f, 0xc0, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0xdf, 0x90, 0xa, 0xff, 0x72, 0x1, 0x4c, 0xff,
+    0x20, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x4, 0xdf, 0xff, 0xef, 0xff, 0xf8, 0x0, 0x2f,
+    0xfc, 0x40, 0x0, 0x18, 0xff, 0x90, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x6f, 0xf2, 0xdf, 0x80, 0x0,
+    0x0, 0x0, 0xf, 0xf5, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0xaf, 0xe1, 0x0, 0x0, 0x0,
+    0x8f, 0xf2, 0x3f, 0xfd, 0x51, 0x0, 0x3a, 0xff, 0xa0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x17, 0xce, 0xff, 0xd9, 0x40, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x4, 0xae, 0xfe, 0xc7, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x8, 0xff,
+    0x82, 0x0, 0x4c, 0xfe, 0x10, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x3f, 0xf0, 0x0, 0x0,
+    0x0, 0x6f, 0xf1, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0xcf,
+    0xf8, 0xa, 0xff, 0x82, 0x0, 0x4c, 0xff, 0xf9, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x9c, 0xfa, 0x0,
+    0x6, 0xbe, 0xfe, 0xa4, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x50, 0x0, 0xa7, 0x31, 0x25, 0xcf, 0xf9, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x7b, 0xdf, 0xec, 0x82, 0x0, 0x0,
+
+    /* U+003A ":" */
+    0x5f, 0xb0, 0xdf, 0xf4, 0x9f, 0xf1, 0x4, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x10, 0x9f, 0xf1, 0xdf, 0xf4, 0x6f, 0xb0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0x5d, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x6f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xf7, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x10, 0x8, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
+    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
+    0x2, 0xff, 0x50, 0x0, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x7, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x10, 0x0, 0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0, 0x5f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x50,
+
+    /* U+0042 "B" */
+    0x7f, 0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x7f,
+    0xe0, 0x0, 0x0, 0x2, 0x9f, 0xfa, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf0, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x7f, 0xe0, 0x0,
+    0x0, 0x2, 0x9f, 0xf5, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd4, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x14, 0xcf, 0xf3, 0x7f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xa7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xe7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfc, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x3b, 0xff,
+    0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x30, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xda, 0x50, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x30,
+    0x0, 0x5f, 0xff, 0xb6, 0x43, 0x59, 0xff, 0xf2, 0x3, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x1c, 0x80,
+    0xd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x1c, 0x80,
+    0x0, 0x5f, 0xff, 0xb5, 0x33, 0x49, 0xff, 0xf2, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x5, 0xae, 0xff, 0xda, 0x50, 0x0,
+
+    /* U+0044 "D" */
+    0x7f, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,
+    0x0, 0x7f, 0xe1, 0x11, 0x12, 0x36, 0xbf, 0xff, 0x40, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xfe, 0x20, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf2, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x77, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xf9, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa7, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xf9, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x77, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf2, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb, 0x7, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xfe, 0x20, 0x7f, 0xe1, 0x11, 0x11, 0x35, 0xbf, 0xff, 0x40, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0,
+    0x0,
+
+    /* U+0045 "E" */
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7f, 0xe1, 0x11,
+    0x11, 0x11, 0x11, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x50, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x7, 0xfe, 0x11, 0x11, 0x11, 0x11,
+    0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe1, 0x11, 0x11, 0x11,
+    0x11, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
+
+    /* U+0046 "F" */
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7f, 0xe1, 0x11,
+    0x11, 0x11, 0x11, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x7f, 0xe1, 0x11, 0x11, 0x11, 0x10, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0x50,
+    0x0, 0x5f, 0xff, 0xb6, 0x43, 0x48, 0xef, 0xf5, 0x3, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x9, 0xb0,
+    0xd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7, 0x94, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7,
+    0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7,
+    0xd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x3, 0xff, 0xd3, 0x0, 0x0, 0x0, 0xd, 0xf7,
+    0x0, 0x5f, 0xff, 0xb6, 0x32, 0x47, 0xdf, 0xf7, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x71, 0x0,
+
+    /* U+0049 "I" */
+    0x7f, 0xe7, 0xfe, 0x7f, 0xe7, 0xfe, 0x7f, 0xe7, 0xfe, 0x7f, 0xe7, 0xfe, 0x7f, 0xe7, 0xfe, 0x7f,
+    0xe7, 0xfe, 0x7f, 0xe7, 0xfe, 0x7f, 0xe7, 0xfe, 0x7f, 0xe0,
+
+    /* U+004C "L" */
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe1, 0x11, 0x11, 0x11,
+    0x11, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+
+    /* U+004D "M" */
+    0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x67, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf6, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x67, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf6, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x67,
+    0xfd, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0xcf, 0x8e, 0xf6, 0x7f, 0xd2, 0xff, 0x40, 0x0, 0x0, 0x5f,
+    0xe0, 0xef, 0x67, 0xfd, 0x8, 0xfd, 0x0, 0x0, 0xe, 0xf6, 0xe, 0xf6, 0x7f, 0xd0, 0xe, 0xf7,
+    0x0, 0x8, 0xfc, 0x0, 0xef, 0x67, 0xfd, 0x0, 0x5f, 0xf1, 0x1, 0xff, 0x30, 0xe, 0xf6, 0x7f,
+    0xd0, 0x0, 0xbf, 0xa0, 0xaf, 0x90, 0x0, 0xef, 0x67, 0xfd, 0x0, 0x2, 0xff, 0x7f, 0xe1, 0x0,
+    0xe, 0xf6, 0x7f, 0xd0, 0x0, 0x8, 0xff, 0xf6, 0x0, 0x0, 0xef, 0x67, 0xfd, 0x0, 0x0, 0xe,
+    0xfd, 0x0, 0x0, 0xe, 0xf6, 0x7f, 0xd0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0xef, 0x67, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0x60,
+
+    /* U+004E "N" */
+    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x7f,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0xff, 0xff, 0x40, 0x0, 0x0, 0x7, 0xff, 0x7f, 0xfd,
+    0xfe, 0x20, 0x0, 0x0, 0x7f, 0xf7, 0xfe, 0x3f, 0xfd, 0x0, 0x0, 0x7, 0xff, 0x7f, 0xe0, 0x5f,
+    0xfa, 0x0, 0x0, 0x7f, 0xf7, 0xfe, 0x0, 0x8f, 0xf7, 0x0, 0x7, 0xff, 0x7f, 0xe0, 0x0, 0xbf,
+    0xf4, 0x0, 0x7f, 0xf7, 0xfe, 0x0, 0x1, 0xef, 0xe1, 0x7, 0xff, 0x7f, 0xe0, 0x0, 0x3, 0xff,
+    0xc0, 0x7f, 0xf7, 0xfe, 0x0, 0x0, 0x6, 0xff, 0xa7, 0xff, 0x7f, 0xe0, 0x0, 0x0, 0x9, 0xff,
+    0xdf, 0xf7, 0xfe, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xf7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xb6, 0x33, 0x5a, 0xff, 0xf7, 0x0, 0x0, 0x3f, 0xfd, 0x30,
+    0x0, 0x0, 0x1, 0xcf, 0xf5, 0x0, 0xd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0x4,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x70, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xfc, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0, 0xdf, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0, 0x9f,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x5, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x70, 0xd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0x0, 0x3f, 0xfd, 0x30, 0x0,
+    0x0, 0x1, 0xcf, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0xb5, 0x33, 0x59, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60, 0x0,
+    0x0, 0x0,
+
+    /* U+0050 "P" */
+    0x7f, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x7f,
+    0xe1, 0x11, 0x12, 0x49, 0xff, 0xe1, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0x90, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x9, 0xfe, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0, 0x7f, 0xe0, 0x0, 0x0,
+    0x0, 0x3f, 0xf9, 0x7, 0xfe, 0x11, 0x11, 0x24, 0x8f, 0xfe, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x20, 0x7, 0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0052 "R" */
+    0x7f, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x7f,
+    0xe1, 0x11, 0x12, 0x49, 0xff, 0xe1, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0x90, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x9, 0xfe, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0, 0x7f, 0xe0, 0x0, 0x0,
+    0x0, 0x3f, 0xf8, 0x7, 0xfe, 0x11, 0x11, 0x13, 0x8f, 0xfe, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x20, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x7f, 0xf2,
+    0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0xcf, 0xd0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x1, 0xef, 0x90,
+    0x7, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xff, 0x40, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x10,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x6b, 0xef, 0xfd, 0xa5, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0xef,
+    0xe7, 0x21, 0x14, 0x8e, 0xc0, 0x6, 0xff, 0x20, 0x0, 0x0, 0x0, 0x20, 0x9, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xd9, 0x51, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xc5, 0x0, 0x0,
+    0x0, 0x1, 0x59, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x5, 0x80, 0x0, 0x0, 0x0,
+    0xc, 0xfb, 0xd, 0xfe, 0x84, 0x21, 0x25, 0xcf, 0xf4, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x4, 0x9d, 0xef, 0xec, 0x82, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x11,
+    0x13, 0xff, 0x51, 0x11, 0x11, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x9a, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0xaf,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x9a, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0xaf, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0x9a, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0xaf, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0x9a, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0xaf, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0x99, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x9f, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x87, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0x20, 0xdf, 0xe1, 0x0, 0x0, 0x1, 0xef, 0xc0, 0x3, 0xff, 0xe7, 0x32, 0x38, 0xef, 0xf3,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x1, 0x7c, 0xef, 0xec, 0x71, 0x0, 0x0,
+
+    /* U+0056 "V" */
+    0xd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x6f, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0x70, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x8, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20, 0x0,
+    0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x3, 0xff, 0x50, 0x0, 0x0, 0x2f,
+    0xf4, 0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3,
+    0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x10, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x5, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xe0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x1f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0xbf, 0xb0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xc0, 0x6, 0xff, 0x10, 0x0, 0x0,
+    0x5, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0xef,
+    0xe0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x1f, 0xf4, 0xff, 0x30, 0x0,
+    0x0, 0x8f, 0xc0, 0x0, 0x6, 0xff, 0x10, 0x0, 0x6, 0xfd, 0xc, 0xf8, 0x0, 0x0, 0xd, 0xf6,
+    0x0, 0x0, 0x1f, 0xf5, 0x0, 0x0, 0xbf, 0x70, 0x6f, 0xe0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0,
+    0xcf, 0xb0, 0x0, 0x1f, 0xf2, 0x1, 0xff, 0x30, 0x0, 0x8f, 0xc0, 0x0, 0x0, 0x6, 0xff, 0x0,
+    0x6, 0xfd, 0x0, 0xc, 0xf8, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0xbf, 0x70,
+    0x0, 0x6f, 0xe0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x1f, 0xf2, 0x0, 0x1, 0xff,
+    0x30, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x6, 0xfc, 0x0, 0x0, 0xb, 0xf8, 0xd, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0xcf, 0x70, 0x0, 0x0, 0x6f, 0xe3, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xcf, 0xf2, 0x0, 0x0, 0x1, 0xff, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xc0, 0x0, 0x0, 0x0,
+
+    /* U+0059 "Y" */
+    0xc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x50, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xb0, 0x0, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x1, 0xef, 0x90, 0x0, 0x0, 0xd,
+    0xf8, 0x0, 0x0, 0x6, 0xff, 0x20, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0x1,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0,
+    0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x9d, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0061 "a" */
+    0x0, 0x6b, 0xef, 0xfd, 0x81, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xfe, 0x10, 0xe, 0xb5, 0x10, 0x27,
+    0xff, 0xb0, 0x1, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x37,
+    0xaa, 0xaa, 0xaf, 0xf4, 0xa, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x6f, 0xf6, 0x10, 0x0, 0xf, 0xf4,
+    0xbf, 0x90, 0x0, 0x0, 0xf, 0xf4, 0xcf, 0x80, 0x0, 0x0, 0x5f, 0xf4, 0x8f, 0xe2, 0x0, 0x4,
+    0xff, 0xf4, 0x1d, 0xff, 0xcb, 0xdf, 0xdf, 0xf4, 0x1, 0x8d, 0xff, 0xd8, 0xe, 0xf4,
+
+    /* U+0065 "e" */
+    0x0, 0x5, 0xbe, 0xfd, 0xa3, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xa, 0xfe, 0x61,
+    0x2, 0x8f, 0xf7, 0x4, 0xff, 0x20, 0x0, 0x0, 0x5f, 0xf1, 0xaf, 0x90, 0x0, 0x0, 0x0, 0xcf,
+    0x6d, 0xfc, 0xbb, 0xbb, 0xbb, 0xbd, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0xa, 0xff, 0xa3, 0x11, 0x4b, 0xf8, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x3,
+    0xad, 0xff, 0xd8, 0x10, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x0, 0x8d, 0xfe, 0xa1, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x4f, 0xf5, 0x0, 0x30, 0x0,
+    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0x70, 0x9e, 0xff,
+    0xfe, 0xee, 0x60, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
+    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0,
+    0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
+    0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
+
+    /* U+0069 "i" */
+    0xb, 0xf6, 0x2f, 0xfd, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0xd, 0xf7, 0xd, 0xf7,
+    0xd, 0xf7, 0xd, 0xf7, 0xd, 0xf7, 0xd, 0xf7, 0xd, 0xf7, 0xd, 0xf7, 0xd, 0xf7, 0xd, 0xf7,
+    0xd, 0xf7, 0xd, 0xf7,
+
+    /* U+006B "k" */
+    0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xf7, 0x0, 0x0, 0x3, 0xef, 0xa0, 0xdf, 0x70, 0x0, 0x3, 0xff, 0xb0, 0xd, 0xf7, 0x0,
+    0x4, 0xff, 0xb0, 0x0, 0xdf, 0x70, 0x5, 0xff, 0xb0, 0x0, 0xd, 0xf7, 0x6, 0xff, 0xb0, 0x0,
+    0x0, 0xdf, 0x77, 0xff, 0xf1, 0x0, 0x0, 0xd, 0xfe, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xdf, 0xff,
+    0x87, 0xff, 0x70, 0x0, 0xd, 0xff, 0x70, 0xa, 0xff, 0x40, 0x0, 0xdf, 0x90, 0x0, 0xd, 0xfe,
+    0x10, 0xd, 0xf7, 0x0, 0x0, 0x2e, 0xfc, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x4f, 0xf9, 0xd, 0xf7,
+    0x0, 0x0, 0x0, 0x7f, 0xf5,
+
+    /* U+006E "n" */
+    0xdf, 0x61, 0x8d, 0xff, 0xc7, 0x0, 0xd, 0xf9, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xdf, 0xff, 0x61,
+    0x2, 0x8f, 0xf9, 0xd, 0xff, 0x40, 0x0, 0x0, 0x9f, 0xf0, 0xdf, 0xc0, 0x0, 0x0, 0x3, 0xff,
+    0x2d, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0xdf, 0x70, 0x0, 0x0, 0x0, 0xff, 0x4d, 0xf7, 0x0,
+    0x0, 0x0, 0xf, 0xf4, 0xdf, 0x70, 0x0, 0x0, 0x0, 0xff, 0x4d, 0xf7, 0x0, 0x0, 0x0, 0xf,
+    0xf4, 0xdf, 0x70, 0x0, 0x0, 0x0, 0xff, 0x4d, 0xf7, 0x0, 0x0, 0x0, 0xf, 0xf4, 0xdf, 0x70,
+    0x0, 0x0, 0x0, 0xff, 0x40,
+
+    /* U+0070 "p" */
+    0xdf, 0x61, 0x8d, 0xfe, 0xc7, 0x10, 0x0, 0xdf, 0x8e, 0xff, 0xff, 0xff, 0xe3, 0x0, 0xdf, 0xff,
+    0x92, 0x0, 0x5d, 0xfe, 0x20, 0xdf, 0xf7, 0x0, 0x0, 0x1, 0xef, 0xa0, 0xdf, 0xd0, 0x0, 0x0,
+    0x0, 0x5f, 0xf1, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0xdf, 0x70, 0x0, 0x0, 0x0, 0xf,
+    0xf5, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0xdf, 0xe0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0xdf,
+    0xf8, 0x0, 0x0, 0x2, 0xef, 0xa0, 0xdf, 0xff, 0xa3, 0x12, 0x6e, 0xff, 0x20, 0xdf, 0x9d, 0xff,
+    0xff, 0xff, 0xe3, 0x0, 0xdf, 0x70, 0x7c, 0xfe, 0xc7, 0x10, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x18, 0xcf, 0xfe, 0xb7, 0x10, 0x2, 0xef, 0xff, 0xff, 0xff, 0xb0, 0xb, 0xfe, 0x41, 0x2,
+    0x6c, 0x30, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xd9, 0x52, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xe9, 0x10, 0x0, 0x0, 0x47, 0xad, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3, 0x1, 0x0, 0x0, 0x0, 0xf, 0xf4, 0xe, 0xc6, 0x20, 0x3,
+    0xaf, 0xf1, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x60, 0x1, 0x7b, 0xef, 0xfd, 0x92, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0x70, 0x9e, 0xff, 0xfe, 0xee, 0x60, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f,
+    0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
+    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0x4f, 0xf7, 0x1, 0x50, 0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x9e, 0xfd, 0x81,
+
+    /* U+0078 "x" */
+    0x1e, 0xf8, 0x0, 0x0, 0x4, 0xff, 0x40, 0x4f, 0xf4, 0x0, 0x1, 0xef, 0x80, 0x0, 0x8f, 0xe1,
+    0x0, 0xbf, 0xb0, 0x0, 0x0, 0xcf, 0xb0, 0x7f, 0xe1, 0x0, 0x0, 0x1, 0xef, 0xaf, 0xf4, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x4, 0xff, 0x5e, 0xf7, 0x0, 0x0, 0x1, 0xef, 0x80, 0x4f, 0xf3,
+    0x0, 0x0, 0xcf, 0xc0, 0x0, 0x8f, 0xe1, 0x0, 0x8f, 0xe1, 0x0, 0x0, 0xcf, 0xb0, 0x4f, 0xf4,
+    0x0, 0x0, 0x2, 0xff, 0x80,
+
+    /* U+F00C */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfd, 0x10, 0x2, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xff, 0xd1, 0x0, 0x2e, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfd, 0x10, 0x0,
+    0xdf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xd1, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xc0,
+    0x0, 0xc, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xfc, 0x0, 0xcf, 0xff, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F021 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x32, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x67, 0x75, 0x20, 0x0, 0x0, 0x4f, 0xff, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff, 0xfd,
+    0x70, 0x0, 0x4f, 0xff, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x3f, 0xff,
+    0x0, 0x1, 0xcf, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xfb, 0x3f, 0xff, 0x0, 0xd, 0xff, 0xff,
+    0xb4, 0x0, 0x0, 0x5b, 0xff, 0xff, 0xdf, 0xff, 0x0, 0xaf, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x4d, 0xff, 0xff, 0xff, 0x4, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xc, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x6, 0xff, 0xee, 0xef, 0xff, 0xff, 0x1f, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x4, 0x43, 0x0, 0x0, 0x0, 0x0, 0x1, 0x44, 0x44, 0x44, 0x44, 0x43,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x34, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x34, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf1, 0xff, 0xff, 0xfd, 0xee,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xb0, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xff, 0x40, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xfa, 0x0,
+    0xff, 0xfe, 0xff, 0xff, 0xb5, 0x0, 0x0, 0x4b, 0xff, 0xff, 0xd0, 0x0, 0xff, 0xf3, 0xbf, 0xff,
+    0xff, 0xfe, 0xef, 0xff, 0xff, 0xfc, 0x10, 0x0, 0xff, 0xf3, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0xff, 0xf4, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x0,
+    0xff, 0xf4, 0x0, 0x0, 0x2, 0x67, 0x76, 0x30, 0x0, 0x0, 0x0, 0x0, 0x23, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 103, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 223, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 66, .adv_w = 147, .box_w = 7, .box_h = 3, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 77, .adv_w = 87, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 85, .adv_w = 135, .box_w = 11, .box_h = 23, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 212, .adv_w = 256, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 331, .adv_w = 142, .box_w = 7, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 391, .adv_w = 220, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 502, .adv_w = 220, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 613, .adv_w = 257, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 749, .adv_w = 220, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 860, .adv_w = 237, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 979, .adv_w = 230, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1098, .adv_w = 247, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1217, .adv_w = 237, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1336, .adv_w = 87, .box_w = 4, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1362, .adv_w = 281, .box_w = 19, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1524, .adv_w = 291, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1652, .adv_w = 278, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1788, .adv_w = 317, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1933, .adv_w = 257, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2044, .adv_w = 244, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2155, .adv_w = 296, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2291, .adv_w = 119, .box_w = 3, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2317, .adv_w = 228, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2428, .adv_w = 367, .box_w = 19, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2590, .adv_w = 312, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2718, .adv_w = 323, .box_w = 19, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2880, .adv_w = 277, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3008, .adv_w = 279, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3136, .adv_w = 238, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3255, .adv_w = 225, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3374, .adv_w = 304, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3502, .adv_w = 273, .box_w = 19, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3664, .adv_w = 432, .box_w = 27, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3894, .adv_w = 248, .box_w = 17, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4039, .adv_w = 230, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4117, .adv_w = 235, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4202, .adv_w = 136, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4292, .adv_w = 107, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4328, .adv_w = 237, .box_w = 13, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4445, .adv_w = 262, .box_w = 13, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4530, .adv_w = 262, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 4656, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4734, .adv_w = 159, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4814, .adv_w = 212, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4899, .adv_w = 384, .box_w = 24, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5115, .adv_w = 384, .box_w = 24, .box_h = 26, .ofs_x = 0, .ofs_y = -4}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+/*Glyph id per code point, 0 = not in the subset*/
+static const uint8_t glyph_id_ofs_list_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 4, 5,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 0, 0, 0, 0, 0,
+    0, 17, 18, 19, 20, 21, 22, 23, 0, 24, 0, 0, 25, 26, 27, 28,
+    29, 0, 30, 31, 32, 33, 34, 35, 0, 36, 0, 0, 0, 0, 0, 0,
+    0, 37, 0, 0, 0, 38, 39, 0, 0, 40, 0, 41, 0, 0, 42, 0,
+    43, 0, 0, 44, 45, 0, 0, 0, 46, 0,
+};
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0x15,
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 89, .glyph_id_start = 0,
+        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 89, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    },
+    {
+        .range_start = 61452, .range_length = 22, .glyph_id_start = 47,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] =
+{
+    0, 0, 2, 2, 3, 4, 5, 0, 6, 7, 8, 9, 10, 11, 12, 5,
+    13, 15, 16, 17, 14, 18, 19, 20, 21, 23, 21, 21, 14, 24, 25, 1,
+    26, 22, 27, 27, 28, 29, 31, 32, 33, 34, 29, 30, 35, 36, 37, 0,
+    0,
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] =
+{
+    0, 0, 2, 2, 3, 4, 5, 6, 7, 8, 9, 10, 5, 11, 12, 13,
+    14, 16, 17, 15, 17, 17, 17, 15, 17, 17, 17, 17, 15, 17, 17, 1,
+    18, 19, 20, 20, 21, 22, 23, 0, 24, 0, 25, 25, 26, 27, 28, 0,
+    0,
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] =
+{
+    0, 7, 8, 0, 0, -4, 0, -3, 4, 0, -4, 0, -4, -2, 0, 0,
+    0, -4, 0, 0, -6, 0, 0, 0, 0, 0, 0, -4, 0, 1, -3, 0,
+    3, -7, -5, -8, 3, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 38, -5, -5, 4, 4,
+    -3, 0, -5, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -26, -37, -26, -8, 12, 0, 0, -26, 0, 5, -9,
+    0, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, -5, -8, 0, -1, -1, -4, 0, 0, -3, 0, 0, 0, 0, -3,
+    0, -8, 0, -10, -13, 0, 0, 0, 0, 0, 4, -4, 0, -3, 4, 4,
+    -1, 0, 0, 0, -7, 0, -1, 0, 0, 0, 0, 1, 0, -3, 0, -5,
+    -7, 0, -4, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -2, -2,
+    0, -4, -5, 0, 0, 0, 0, 1, 0, -3, 0, -4, -4, 0, 0, 0,
+    0, 0, 0, -5, -3, 4, 8, 10, 0, -10, -1, -5, 0, -1, -18, 4,
+    -3, 3, 4, 0, 0, -20, 0, -20, -33, 11, 5, 0, 0, 0, 1, -5,
+    0, 0, 0, 0, 0, 0, -2, -2, 0, -2, -5, 0, 0, 0, 0, 0,
+    0, -4, 0, -3, -3, 0, 0, 0, 0, 0, 0, -3, 0, 2, 4, 4,
+    0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 3, 0, -4, 0, -4,
+    -5, 0, 3, 0, 0, 0, 0, -6, -3, -19, -20, -16, -8, 4, 0, -3,
+    -25, -7, 0, -7, 0, -8, -7, -25, 0, 0, 0, 2, 3, -15, -19, -9,
+    -9, -12, -5, -7, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -4, 0, -7, -8, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, -8, -8,
+    0, -4, -4, -5, 0, 0, 0, 0, 0, 0, 0, -4, 0, -4, 0, -8,
+    -12, 0, 0, 0, 0, 0, 2, -5, 0, -7, 13, 12, -3, -16, 0, 4,
+    -6, 0, -19, -2, -5, 4, -4, 5, 0, -13, -6, -14, -16, 0, -2, 0,
+    0, -2, -2, -13, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, 0, -2, -6, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, 5, 0, -8, 4, -3, -1, -10, -4, 0, -5, -4, -3, -6, -7,
+    0, -3, -1, -3, -5, -3, -8, 0, 0, -8, 0, -7, 0, -8, 4, 0,
+    -5, 0, -3, -5, -12, -3, -3, -3, -1, -3, -1, 0, 0, 0, 0, -4,
+    -3, -3, -3, 0, 0, -3, -5, -5, -1, 0, -4, -16, -5, 6, 0, 0,
+    -18, -7, 4, -7, 3, 0, -3, -12, 0, 2, 0, 0, 0, -7, -7, -4,
+    -4, -4, 0, -7, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0, -5, 0, 0,
+    -4, 0, 0, 0, 0, 0, 0, -3, -3, -3, 12, 8, -8, -14, 0, 1,
+    -12, 0, -19, -3, -4, 8, -5, 1, 0, -25, -5, -20, -28, 1, -3, 0,
+    0, 0, -2, -3, 0, -1, -11, -18, 0, 0, -2, -6, -12, -4, 0, -3,
+    0, 0, 0, -17, -4, -12, -3, -7, -4, -6, -5, -7, -7, 0, 2, -13,
+    0, -1, 0, 0, 0, 0, 0, -3, -8, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, -4, -2, 0, 0, 0, 0, 2, 0, -3, -13, -12, -8,
+    -8, 15, 7, 4, -33, -3, 8, -4, 0, -4, -4, -13, 0, 4, -5, -3,
+    -3, -11, -21, -5, -5, -15, 1, -13, -6, -9, -14, -15, -10, 12, 0, 1,
+    -28, -3, 4, -7, -3, -9, -8, -14, -6, -3, 0, 0, -8, -21, -21, -5,
+    -13, -22, -1, -13, -6, -12, -14, -8, -13, 13, -4, 2, -36, -7, 8, -8,
+    -7, -14, -12, -16, -5, -3, -4, -8, -1, -25, -23, -9, -15, -26, -8, -19,
+    0, 0, 0, 0, 0, -8, -2, 0, 0, 0, -8, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 4, -5, 0,
+    0, -10, -4, -9, 0, 0, -10, 0, -4, 0, 0, -4, 0, -31, -7, -15,
+    -14, -2, 0, 0, 0, 0, 0, -7, 0, 4, 0, 0, 0, -10, -4, -8,
+    0, 0, -11, 0, -4, 0, 0, 0, 0, -37, 0, -8, -19, -6, 0, 0,
+    0, 0, 0, -6, 0, -4, -4, -12, 5, 19, 7, 8, -10, 5, 16, 5,
+    11, 8, 0, 0, 0, 0, 0, 0, 0, -4, -3, 31, 31, 0, 0, 0,
+    -6, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -32, -5, -3, -19, 0, 0, 0, 0, 0, 0, 0, 0, -9, 4, 0,
+    -4, 3, 7, 4, -12, 0, -1, -3, 4, 0, 0, 0, 0, -10, 0, -3,
+    -8, -4, -8, -3, -3, -7, 0, -8, 0, 0, 0, 0, 0, -3, -4, -4,
+    0, 0, -10, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, 0, -4, 4, 0, -7, -7, -3, 0, -11, -3, -8, -3,
+    -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7, 0, 0, 0, -5, 0,
+    -3, -9, 0, 4, -4, 3, 0, 0, -13, 0, -3, -1, 0, -4, -3, 0,
+    0, -16, -5, -8, -12, -4, -7, 0, 0, -4, 0, 0,
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes =
+{
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 37,
+    .right_class_cnt     = 28,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t ui_font_montserrat_24 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 27,          /*The maximum line height required by the font*/
+    .base_line = 5,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
@@ -0,0 +1,1663 @@
+/*******************************************************************************
+ * Size: 48 px
+ * Bpp: 4
+ * Subset of LVGL's lv_font_montserrat_48.c: 48 of 157 glyphs.
+ * Generated by firmware/host/font_subset from the UI sources. Do not edit;
+ * run `cmake --build <host build dir> --target ui_fonts` after changing UI text.
+ ******************************************************************************/
+
+#ifndef LV_CONF_INCLUDE_SIMPLE
+#define LV_CONF_INCLUDE_SIMPLE
+#endif
+#include <lvgl.h>
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+002B "+" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x44, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0xad, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xd9, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+002D "-" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x4f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa,
+
+    /* U+002E "." */
+    0x0, 0x79, 0x70, 0x1, 0xdf, 0xff, 0xc0, 0x8f, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xf9, 0xaf, 0xff,
+    0xff, 0x73, 0xff, 0xff, 0xf1, 0x4, 0xcf, 0xc3, 0x0,
+
+    /* U+002F */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x8b, 0xef, 0xfe, 0xc8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfb, 0x75, 0x57,
+    0xbf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0xbf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfb, 0x0,
+    0x2, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x20, 0x8, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x80, 0xd, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xd0, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf1, 0x5f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf7, 0x9f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xf9, 0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfa,
+    0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0xaf, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0xaf, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfa, 0x9f, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf9, 0x7f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf7, 0x5f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf5, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xf1, 0xd, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xd0,
+    0x8, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x90, 0x2, 0xff,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x20, 0x0, 0xbf, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfb, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfb, 0x76, 0x67, 0xbf, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xc8, 0x30, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0031 "1" */
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x23, 0x33, 0x33, 0x34, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb,
+
+    /* U+0032 "2" */
+    0x0, 0x0, 0x0, 0x3, 0x7b, 0xde, 0xff, 0xed, 0x96, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfa, 0x76, 0x55, 0x7a, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x1c, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xbf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x9, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xf5, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+
+    /* U+0033 "3" */
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x38, 0xff, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0xa7, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x13, 0x8e, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xf2, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x6,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0x90, 0xe, 0xff, 0xfe, 0x72,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0x10, 0x8f, 0xff, 0xff, 0xff, 0xd9, 0x76, 0x56,
+    0x7a, 0xef, 0xff, 0xff, 0xf7, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x1, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x26, 0x9c, 0xef, 0xff, 0xec, 0x96, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x3, 0xbb, 0xbb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x7f,
+    0xff, 0xf4, 0x22, 0x22, 0x21, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xdc, 0x96, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x60, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x2, 0x33,
+    0x33, 0x33, 0x33, 0x45, 0x79, 0xdf, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xbf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xfa, 0x0, 0x4a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf6, 0x0,
+    0xdf, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf1, 0x6, 0xff, 0xff, 0xc5,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xff, 0x90, 0xe, 0xff, 0xff, 0xff, 0xfc, 0x87, 0x65,
+    0x68, 0xcf, 0xff, 0xff, 0xfe, 0x10, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe3, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x7b, 0xde, 0xff, 0xfd, 0xb8, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xac, 0xef, 0xfe, 0xdb, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xb7, 0x53, 0x33, 0x57,
+    0xbf, 0xf4, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x17, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0x50, 0x0, 0x5, 0xad, 0xef, 0xfe, 0xb8, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf3,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x9, 0xff, 0xff, 0x22, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xaf, 0xff, 0xf4, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0xb, 0xff, 0xff, 0xef, 0xff, 0xf9, 0x41, 0x0, 0x3, 0x8e, 0xff,
+    0xff, 0xf8, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xf2,
+    0x9, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x90, 0x8f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x6, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf4, 0xb, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0x30, 0x5f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0,
+    0xef, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfd, 0x0, 0x7, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x70, 0x0, 0xd, 0xff, 0xff, 0xc2, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfa, 0x41, 0x0, 0x3,
+    0x8e, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x49, 0xce, 0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+0037 "7" */
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x9f, 0xff, 0xf4, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xdf, 0xff,
+    0xf4, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xc0, 0x9f, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x50, 0x9f, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf7, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xf1, 0x0, 0x25, 0x55, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x0, 0x1, 0x69, 0xce, 0xff, 0xfe, 0xc9, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf8, 0x41, 0x0, 0x1, 0x49, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0xf, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xfe,
+    0x0, 0x5, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf4, 0x0, 0x9f,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x70, 0xa, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf9, 0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf6, 0x0, 0x3f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0x10, 0x0, 0xbf, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0x90, 0x0,
+    0x1, 0xef, 0xff, 0xff, 0x95, 0x20, 0x0, 0x25, 0xaf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xbc, 0xdf, 0xff, 0xff,
+    0xff, 0xc1, 0x0, 0x1, 0xef, 0xff, 0xff, 0x93, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff, 0xff, 0xd1,
+    0x0, 0xbf, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0x90, 0x3f, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x29, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf7, 0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xad, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xfc, 0xdf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xcc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfa, 0x8f,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x73, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0xb, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfa, 0x0, 0x2e, 0xff, 0xff, 0xfd, 0x73, 0x0, 0x0, 0x14,
+    0x8e, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x20, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x27, 0xac, 0xef, 0xff, 0xec, 0xa6, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xff, 0xdb, 0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xb5, 0x10, 0x0, 0x15, 0xbf, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0x70,
+    0x0, 0xe, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0x20, 0x4, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf9, 0x0, 0x8f, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x50, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf9, 0x9, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xc0, 0x6f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x1,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xf1, 0xa, 0xff, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0x20, 0x2f, 0xff, 0xff, 0xfb, 0x52,
+    0x0, 0x1, 0x5b, 0xff, 0xff, 0xef, 0xff, 0xf3, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb8, 0xff, 0xff, 0x40, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0x8f, 0xff, 0xf4, 0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x9, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xec, 0x84, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x4, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xbf, 0xfa, 0x74, 0x33, 0x45, 0x9d, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x69, 0xce, 0xff, 0xfe, 0xb9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+003A ":" */
+    0x4, 0xcf, 0xc3, 0x3, 0xff, 0xff, 0xf2, 0xaf, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xf9, 0x8f, 0xff,
+    0xff, 0x61, 0xef, 0xff, 0xc0, 0x0, 0x79, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0x97, 0x0, 0x1d, 0xff, 0xfc, 0x8, 0xff, 0xff, 0xf6, 0xbf, 0xff, 0xff,
+    0x9a, 0xff, 0xff, 0xf7, 0x3f, 0xff, 0xff, 0x10, 0x4c, 0xfc, 0x30,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf9, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfe, 0xd, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x70, 0x7f, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf9, 0x0,
+    0x9, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0x20, 0x0, 0x2f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0xbf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0, 0x4, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0x40, 0x0, 0x0, 0x9, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfb, 0x0, 0x0, 0x1, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x90, 0x0, 0xe, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x10,
+    0x6, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf8, 0x0, 0xdf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xe0,
+
+    /* U+0042 "B" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb8, 0x40, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x7d, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xf7, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xd0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xf1, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x10, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf0, 0xf,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x70, 0xf, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x14, 0x8e, 0xff, 0xff, 0xf3, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x20, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x40, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x59, 0xff, 0xff,
+    0xff, 0x30, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xfd,
+    0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf5, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xaf, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xef, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xcf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf8, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xaf, 0xff, 0xff, 0x3f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x49, 0xff,
+    0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd1, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xc9, 0x61, 0x0, 0x0, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xad, 0xef, 0xfe, 0xdb, 0x84, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x91, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x65, 0x56, 0x8b, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xf8, 0x0, 0x2, 0xff,
+    0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf8, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe8, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0x90, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0x90, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xfd, 0x97, 0x55, 0x68, 0xbf, 0xff, 0xff, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7a, 0xde, 0xff, 0xfd, 0xb8, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+0044 "D" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdb, 0x96, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xe3, 0x33, 0x33, 0x33, 0x33, 0x45, 0x79, 0xdf, 0xff, 0xff, 0xff, 0xd2,
+    0x0, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff,
+    0xe2, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff,
+    0xff, 0xd0, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0x90, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x30, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xfb, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xf2, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0x80, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xfc, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x2f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf4, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x5f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf5, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x4f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf8, 0xf, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x20, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xb0, 0xf, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf3, 0x0, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf9, 0x0, 0xf, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xfe, 0x20, 0x0, 0xf, 0xff,
+    0xfe, 0x33, 0x33, 0x33, 0x33, 0x34, 0x46, 0x9d, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xc9, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0045 "E" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0xff, 0xff, 0xe3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0xf, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xd2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xf, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+
+    /* U+0046 "F" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xe3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
+    0xff, 0xff, 0xd2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xac, 0xef, 0xff, 0xec, 0x95, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x75, 0x56, 0x7a, 0xef, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x82, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xd0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xfd, 0x10,
+    0x0, 0xd, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc1, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x33, 0x20,
+    0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
+    0x9f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
+    0x8f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
+    0x5f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
+    0x2f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
+    0xd, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
+    0x7, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
+    0x1, 0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
+    0x0, 0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
+    0x0, 0xc, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xe0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x82, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xd9, 0x76, 0x56, 0x7a, 0xdf, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xad, 0xef, 0xff, 0xdb, 0x95, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+0049 "I" */
+    0xff, 0xff, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xff,
+    0xff, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xff, 0xff,
+    0xdf, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xdf,
+    0xff, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xff,
+    0xfd, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xfd,
+    0xff, 0xff, 0xdf, 0xff, 0xfd,
+
+    /* U+004C "L" */
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe3, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+
+    /* U+004D "M" */
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfc, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xfc, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xfc, 0xff, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xff, 0xfc, 0xff, 0xff, 0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xee, 0xff, 0xfc, 0xff, 0xff, 0xab, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0x6d, 0xff, 0xfc, 0xff, 0xff, 0xa2, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xfc, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0x8f, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0xe, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xa0, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0x5,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x10, 0xd, 0xff, 0xfc, 0xff, 0xff,
+    0xa0, 0x0, 0xbf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7, 0x0, 0xd, 0xff, 0xfc,
+    0xff, 0xff, 0xa0, 0x0, 0x2f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xd0, 0x0, 0xd,
+    0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0, 0x8, 0xff, 0xff, 0x30, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40,
+    0x0, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0xd, 0xff,
+    0xfb, 0x0, 0x0, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x5f, 0xff, 0xf6, 0x0, 0x0,
+    0x7f, 0xff, 0xf2, 0x0, 0x0, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xc, 0xff, 0xfe,
+    0x10, 0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0x90, 0xa, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xf2, 0x3f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xfb, 0xcf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xfc, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xfc,
+
+    /* U+004E "N" */
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xff, 0xff, 0xd0, 0xaf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xfd, 0x0, 0xdf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
+    0xd0, 0x2, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x0,
+    0x4, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x8,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x70, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x40, 0x0, 0xdf, 0xff,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xfe, 0x20, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfd, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfa, 0xd, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xad, 0xef, 0xfe, 0xdb, 0x84, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xc9, 0x65, 0x56, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0xff, 0xfc, 0x0, 0x0, 0xe, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf5, 0x0, 0x7, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xc0, 0x0, 0xcf, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x20, 0x1f, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7,
+    0x5, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xa0, 0x8f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xfd, 0x9, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xe0, 0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xa, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf0, 0x9f, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfe, 0x8,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xd0, 0x5f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xfa, 0x1, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x70, 0xc, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf2, 0x0, 0x7f, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfc, 0x0, 0x0, 0xef, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x50, 0x0, 0x7,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6e, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xcf, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xfc,
+    0x96, 0x55, 0x68, 0xbf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7a, 0xde, 0xff, 0xed, 0xb8, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0050 "P" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb8, 0x40, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xff, 0xff, 0xe3, 0x33, 0x33, 0x33, 0x34, 0x56,
+    0xae, 0xff, 0xff, 0xff, 0x90, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xff, 0xf5, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xfe, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x50,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xa0, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xf0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xe0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xa0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x50, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xf5, 0x0, 0xff, 0xff, 0xe3, 0x33, 0x33, 0x33,
+    0x34, 0x56, 0xae, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb8, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0052 "R" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb8, 0x40, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xff, 0xff, 0xe3, 0x33, 0x33, 0x33, 0x34, 0x56,
+    0xae, 0xff, 0xff, 0xff, 0x90, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xff, 0xf5, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xfe, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x50,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xa0, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf1, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xf1, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xe0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xb0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x60, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xf6, 0x0, 0xff, 0xff, 0xd2, 0x22, 0x22, 0x22,
+    0x22, 0x35, 0x8d, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x50, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xe1, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0x70, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
+    0xf3, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfd, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xa0, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf5,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x0, 0x0, 0x16, 0x9c, 0xef, 0xff, 0xec, 0x96, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x10, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xa, 0xff, 0xff, 0xff, 0xa6, 0x42, 0x23, 0x46, 0xad,
+    0xff, 0xff, 0xd0, 0x0, 0x4, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9f, 0xf6,
+    0x0, 0x0, 0xbf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x0, 0x0, 0xf,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0xfd, 0x95, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd9, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x9d, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7e, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0,
+    0x65, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x90, 0xe, 0xfa, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf4, 0x6, 0xff, 0xff, 0xa4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xfd, 0x0, 0xdf, 0xff, 0xff, 0xfe, 0xa6, 0x42, 0x22, 0x35,
+    0x7c, 0xff, 0xff, 0xff, 0x40, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x17, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x16, 0x9c, 0xef, 0xff, 0xed, 0xb8, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+0054 "T" */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0xff, 0xff,
+    0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xf2, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xf2, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xf2, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xf2, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2,
+    0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x4f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x3f, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x2f, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf1, 0x1f, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0, 0xc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xb0, 0x8, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x70, 0x4, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0x30, 0x0, 0xdf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfd, 0x97, 0x55, 0x79, 0xdf, 0xff, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x6a, 0xde, 0xff, 0xec, 0xa6, 0x20, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0056 "V" */
+    0xd, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xf0, 0x6, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0x90, 0x0, 0xef, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0x20, 0x0, 0x8f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0, 0xa, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xf7, 0x0, 0x0, 0xe, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xfd, 0x0, 0x0, 0x6f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x50, 0x0, 0xdf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xc0, 0x4, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf2, 0xb, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf9, 0x2f, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xaf,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x4f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf5, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf0, 0xa, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb0, 0x5, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x50, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0x0, 0x0, 0xaf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfb, 0x0, 0x0, 0x5f, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfd, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf8, 0x5f, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf2, 0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xd0, 0xb, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x80, 0x5, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x20, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x0, 0x0,
+    0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf7, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xf2, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0, 0x0, 0x0, 0xa, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0, 0xe, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf8, 0x0, 0x0, 0x5, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe0,
+    0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x30, 0x0,
+    0xf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0xef, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x80, 0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xf9, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xd0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x0, 0x8,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf3, 0x1, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0xe, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf8, 0x6, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0x90, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xfd, 0xb, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe0, 0x8f, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x4f, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xdf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xfc, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0059 "Y" */
+    0xd, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfe,
+    0x0, 0x4f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x50, 0x0, 0xaf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
+    0xb0, 0x0, 0x1, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xf2, 0x0, 0x0, 0x7, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf7, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xa0, 0x0,
+    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x30,
+    0xd, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfd,
+    0x7, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xf8, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0061 "a" */
+    0x0, 0x0, 0x0, 0x48, 0xbd, 0xef, 0xfd, 0xb8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x3, 0xff,
+    0xff, 0xd9, 0x52, 0x11, 0x25, 0x9f, 0xff, 0xff, 0xf2, 0x0, 0xa, 0xfc, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xff, 0xa0, 0x0, 0x27, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x49, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x6, 0xff, 0xff, 0xfd, 0x86, 0x55, 0x55, 0x55, 0x56, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x5f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0x88, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x9f,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x87, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xf8, 0x4f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0xff, 0x80, 0xef, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff, 0xf8, 0x5, 0xff, 0xff,
+    0xff, 0xda, 0x9a, 0xcf, 0xff, 0xfe, 0xef, 0xff, 0x80, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x2d, 0xff, 0xf8, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0xdf, 0xff, 0x80,
+    0x0, 0x0, 0x49, 0xce, 0xff, 0xdb, 0x72, 0x0, 0xd, 0xff, 0xf8,
+
+    /* U+0065 "e" */
+    0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xeb, 0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xf8, 0x30, 0x0, 0x15, 0xcf, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xf4, 0x0, 0x6, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xfd, 0x0, 0xd, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x50, 0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xa0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xf0, 0xcf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf2, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x51, 0xcf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9c, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0x90,
+    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0x95, 0x31, 0x23, 0x6b, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xbd, 0xff, 0xfe, 0xc8, 0x40, 0x0,
+    0x0, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xef, 0xec, 0x82, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0xde, 0xff, 0xd0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xd4, 0x0, 0x2, 0x86, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xdd, 0xdd, 0xff, 0xff,
+    0xfd, 0xdd, 0xdd, 0xdc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0069 "i" */
+    0x0, 0x37, 0x50, 0x0, 0x8f, 0xff, 0xd1, 0x3f, 0xff, 0xff, 0x96, 0xff, 0xff, 0xfb, 0x4f, 0xff,
+    0xff, 0x90, 0xaf, 0xff, 0xe1, 0x0, 0x58, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0xa, 0xff, 0xff, 0x0, 0xaf, 0xff,
+    0xf0, 0xa, 0xff, 0xff, 0x0, 0xaf, 0xff, 0xf0, 0xa, 0xff, 0xff, 0x0, 0xaf, 0xff, 0xf0, 0xa,
+    0xff, 0xff, 0x0, 0xaf, 0xff, 0xf0, 0xa, 0xff, 0xff, 0x0, 0xaf, 0xff, 0xf0, 0xa, 0xff, 0xff,
+    0x0, 0xaf, 0xff, 0xf0, 0xa, 0xff, 0xff, 0x0, 0xaf, 0xff, 0xf0, 0xa, 0xff, 0xff, 0x0, 0xaf,
+    0xff, 0xf0, 0xa, 0xff, 0xff, 0x0, 0xaf, 0xff, 0xf0, 0xa, 0xff, 0xff, 0x0, 0xaf, 0xff, 0xf0,
+    0xa, 0xff, 0xff, 0x0, 0xaf, 0xff, 0xf0, 0xa, 0xff, 0xff, 0x0, 0xaf, 0xff, 0xf0, 0xa, 0xff,
+    0xff, 0x0,
+
+    /* U+006B "k" */
+    0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfd, 0x10, 0xaf,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xd1, 0x0, 0xaf, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xfd, 0x10, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xff, 0xd1, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xfd,
+    0x10, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x4, 0xff,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x5f, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x6, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfa, 0x5f, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0x90, 0x8, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0x70, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x10, 0x0,
+    0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xc0, 0x0, 0xaf, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xf2,
+
+    /* U+006E "n" */
+    0xaf, 0xff, 0xc0, 0x0, 0x4, 0x9c, 0xef, 0xfe, 0xb7, 0x20, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x0,
+    0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0xaf, 0xff, 0xc0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe4, 0x0, 0xa, 0xff, 0xfc, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfd, 0x85, 0x33, 0x58, 0xef, 0xff, 0xff, 0xe0, 0xa, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x60, 0xaf, 0xff, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfd, 0xa, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xf1, 0xaf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0x4a, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf6, 0xaf, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x7a, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0x8a, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0xaf,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x8a, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0x8a, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xf8, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x8a, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x8a, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xf8, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x8a,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0xaf, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x8a, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xf8,
+
+    /* U+0070 "p" */
+    0xaf, 0xff, 0xc0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xb8, 0x30, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfc,
+    0x0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xc0, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0xa, 0xff, 0xfc, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x95, 0x21, 0x25, 0x9f, 0xff,
+    0xff, 0xfd, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xf9,
+    0x0, 0xaf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf3, 0xa, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xa0, 0xaf, 0xff, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xa, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf5, 0xaf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0x8a, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xfa, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xba,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0xaf, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xaa, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7, 0xaf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xf0, 0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfa,
+    0xa, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x30, 0xaf, 0xff,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0x90, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x52, 0x12, 0x59, 0xff, 0xff, 0xff, 0xd0, 0x0, 0xaf, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0xa, 0xff, 0xff, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb1, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x0, 0x0, 0x38, 0xce, 0xff, 0xeb, 0x83, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x0, 0x0, 0x38, 0xbd, 0xef, 0xfe, 0xc9, 0x61, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x4, 0xff, 0xff, 0xfb,
+    0x52, 0x0, 0x1, 0x48, 0xdf, 0xfa, 0x0, 0xa, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xc2, 0x0, 0xe, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xfd, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0xa7,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x0, 0x0, 0x0,
+    0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x26, 0x9c, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x58, 0xdf, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xfa, 0x1, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8, 0x8, 0xfd, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf5, 0x1f, 0xff, 0xff, 0xa7, 0x32, 0x10, 0x13, 0x7d, 0xff,
+    0xff, 0xe0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x3d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x15, 0x8c, 0xde, 0xff, 0xec, 0x96, 0x10, 0x0, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x0, 0x7, 0x88, 0x85, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xdd, 0xdd, 0xff, 0xff, 0xfd, 0xdd, 0xdd, 0xdc, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x71, 0x0, 0x3a, 0x80, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6a, 0xef, 0xfe, 0xb6, 0x0,
+
+    /* U+0078 "x" */
+    0x7, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xd0, 0x0, 0xbf, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x30, 0x0, 0x1e, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf6, 0x0, 0x0, 0x3, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x60, 0x0, 0x0, 0xcf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xff, 0xf2, 0x0, 0x9, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xfd, 0x0, 0x5f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xa1, 0xef,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xd7, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0x30, 0xaf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf6,
+    0x0, 0x1e, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xa0, 0x0, 0x3, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x60, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xf3, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfd, 0x0, 0x3, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xa0, 0x1e, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xf7,
+
+    /* U+F00C */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x6d, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x30, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4c, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F021 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x7b, 0xef, 0xff, 0xff, 0xfc, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x30, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x30, 0x0, 0x8, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd2, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0xba, 0xab, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x45, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x10, 0x0, 0x0, 0x1, 0x6c, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xa9, 0x87,
+    0x76, 0x54, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xaf, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x9, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x9, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x90,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x45, 0x67,
+    0x78, 0x9a, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb6, 0x10, 0x0, 0x0, 0x1, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xba, 0xab, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x60, 0x2d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x70, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x70, 0x0, 0x4, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xcf, 0xff, 0xff, 0xfe, 0xb8, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 207, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 447, .box_w = 22, .box_h = 22, .ofs_x = 3, .ofs_y = 6},
+    {.bitmap_index = 242, .adv_w = 294, .box_w = 14, .box_h = 5, .ofs_x = 2, .ofs_y = 11},
+    {.bitmap_index = 277, .adv_w = 174, .box_w = 7, .box_h = 7, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 302, .adv_w = 270, .box_w = 21, .box_h = 46, .ofs_x = -2, .ofs_y = -5},
+    {.bitmap_index = 785, .adv_w = 512, .box_w = 28, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1261, .adv_w = 284, .box_w = 13, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1482, .adv_w = 441, .box_w = 26, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1924, .adv_w = 439, .box_w = 26, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2366, .adv_w = 514, .box_w = 31, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2893, .adv_w = 441, .box_w = 26, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3335, .adv_w = 474, .box_w = 27, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3794, .adv_w = 459, .box_w = 26, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4236, .adv_w = 495, .box_w = 27, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4695, .adv_w = 474, .box_w = 27, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5154, .adv_w = 174, .box_w = 7, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5245, .adv_w = 562, .box_w = 37, .box_h = 34, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5874, .adv_w = 581, .box_w = 29, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 6367, .adv_w = 555, .box_w = 31, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6894, .adv_w = 634, .box_w = 33, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 7455, .adv_w = 515, .box_w = 25, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 7880, .adv_w = 488, .box_w = 24, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 8288, .adv_w = 593, .box_w = 32, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8832, .adv_w = 238, .box_w = 5, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 8917, .adv_w = 456, .box_w = 24, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 9325, .adv_w = 733, .box_w = 36, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 9937, .adv_w = 624, .box_w = 29, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 10430, .adv_w = 645, .box_w = 37, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 11059, .adv_w = 554, .box_w = 28, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 11535, .adv_w = 558, .box_w = 28, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 12011, .adv_w = 477, .box_w = 27, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12470, .adv_w = 451, .box_w = 28, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12946, .adv_w = 607, .box_w = 30, .box_h = 34, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 13456, .adv_w = 547, .box_w = 36, .box_h = 34, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 14068, .adv_w = 865, .box_w = 52, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14952, .adv_w = 497, .box_w = 33, .box_h = 34, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 15513, .adv_w = 459, .box_w = 23, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 15812, .adv_w = 470, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 16150, .adv_w = 271, .box_w = 19, .box_h = 36, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16492, .adv_w = 214, .box_w = 7, .box_h = 37, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 16622, .adv_w = 473, .box_w = 26, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 17090, .adv_w = 523, .box_w = 25, .box_h = 26, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 17415, .adv_w = 524, .box_w = 27, .box_h = 35, .ofs_x = 4, .ofs_y = -9},
+    {.bitmap_index = 17888, .adv_w = 385, .box_w = 22, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 18174, .adv_w = 318, .box_w = 19, .box_h = 32, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18478, .adv_w = 424, .box_w = 26, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18816, .adv_w = 768, .box_w = 48, .box_h = 36, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19680, .adv_w = 768, .box_w = 48, .box_h = 48, .ofs_x = 0, .ofs_y = -6}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+/*Glyph id per code point, 0 = not in the subset*/
+static const uint8_t glyph_id_ofs_list_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 4, 5,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 0, 0, 0, 0, 0,
+    0, 17, 18, 19, 20, 21, 22, 23, 0, 24, 0, 0, 25, 26, 27, 28,
+    29, 0, 30, 31, 32, 33, 34, 35, 0, 36, 0, 0, 0, 0, 0, 0,
+    0, 37, 0, 0, 0, 38, 39, 0, 0, 40, 0, 41, 0, 0, 42, 0,
+    43, 0, 0, 44, 45, 0, 0, 0, 46, 0,
+};
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0x15,
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 89, .glyph_id_start = 0,
+        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 89, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    },
+    {
+        .range_start = 61452, .range_length = 22, .glyph_id_start = 47,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] =
+{
+    0, 0, 2, 2, 3, 4, 5, 0, 6, 7, 8, 9, 10, 11, 12, 5,
+    13, 15, 16, 17, 14, 18, 19, 20, 21, 23, 21, 21, 14, 24, 25, 1,
+    26, 22, 27, 27, 28, 29, 31, 32, 33, 34, 29, 30, 35, 36, 37, 0,
+    0,
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] =
+{
+    0, 0, 2, 2, 3, 4, 5, 6, 7, 8, 9, 10, 5, 11, 12, 13,
+    14, 16, 17, 15, 17, 17, 17, 15, 17, 17, 17, 17, 15, 17, 17, 1,
+    18, 19, 20, 20, 21, 22, 23, 0, 24, 0, 25, 25, 26, 27, 28, 0,
+    0,
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] =
+{
+    0, 13, 15, 0, 0, -8, 0, -5, 8, 0, -8, 0, -8, -4, 0, 0,
+    0, -8, 0, 0, -12, 0, 0, 0, 0, 0, 0, -8, 0, 2, -5, 0,
+    5, -14, -10, -15, 5, 0, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 76, -9, -10, 8, 8,
+    -7, 0, -10, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -52, -74, -52, -15, 23, 0, 0, -51, 0, 9, -18,
+    0, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, -9, -15, 0, -2, -2, -8, 0, 0, -5, 0, 0, 0, 0, -6,
+    0, -15, 0, -19, -25, 0, 0, 0, 0, 0, 8, -8, 0, -5, 8, 8,
+    -2, 0, 0, 0, -15, 0, -2, 0, 0, 0, 0, 2, 0, -5, 0, -9,
+    -13, 0, -8, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, -4, -4,
+    0, -8, -9, 0, 0, 0, 0, 2, 0, -5, 0, -8, -8, 0, 0, 0,
+    0, 0, 0, -10, -5, 8, 15, 21, 0, -19, -2, -9, 0, -2, -36, 8,
+    -5, 5, 8, 0, 0, -40, 0, -41, -67, 22, 10, 0, 0, 0, 2, -10,
+    0, 0, 0, 0, 0, 0, -4, -4, 0, -4, -10, 0, 0, 0, 0, 0,
+    0, -8, 0, -5, -6, 0, 0, 0, 0, 0, 0, -6, 0, 4, 8, 8,
+    0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 5, 0, -8, 0, -8,
+    -9, 0, 6, 0, 0, 0, 0, -12, -5, -38, -40, -32, -15, 8, 0, -6,
+    -50, -14, 0, -14, 0, -15, -14, -49, 0, 0, 0, 4, 6, -29, -38, -18,
+    -18, -23, -9, -15, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, 0, -8, 0, -13, -17, 0, 0, 0, 0, 0, 0, -5,
+    0, 0, 0, 37, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, -15, -15,
+    0, -8, -8, -9, 0, 0, 0, 0, 0, 0, 0, -8, 0, -8, 0, -17,
+    -23, 0, 0, 0, 0, 0, 4, -10, 0, -14, 25, 23, -6, -32, 0, 8,
+    -12, 0, -38, -4, -10, 8, -8, 10, 0, -27, -12, -28, -32, 0, -4, 0,
+    0, -4, -4, -25, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -8, 0, -4, -12, 0, 0, 0, 0, 0, 0, 0,
+    -2, -2, 10, 0, -17, 8, -5, -2, -20, -8, 0, -10, -8, -5, -12, -13,
+    0, -6, -2, -5, -9, -5, -17, 0, 0, -15, 0, -13, 0, -15, 8, 0,
+    -11, 0, -5, -9, -24, -5, -5, -5, -2, -5, -2, 0, 0, 0, 0, -8,
+    -6, -5, -5, 0, 0, -5, -9, -9, -2, 0, -8, -32, -10, 12, 1, 0,
+    -36, -13, 8, -13, 5, 0, -6, -25, 0, 4, 0, 0, 0, -15, -13, -8,
+    -8, -8, 0, -15, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, -8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -12, 0, -10, 0, 0,
+    -8, 0, 0, 0, 0, 0, 0, -5, -5, -7, 23, 17, -17, -28, 0, 2,
+    -24, 0, -38, -5, -8, 15, -10, 2, 0, -50, -9, -40, -56, 2, -5, 0,
+    0, 0, -4, -5, 0, -2, -22, -36, 0, 0, -4, -12, -23, -8, 0, -5,
+    0, 0, 0, -35, -8, -25, -6, -13, -8, -12, -9, -15, -15, 0, 4, -25,
+    0, -2, 0, 0, 0, 0, 0, -5, -15, 0, 0, 0, 0, 0, 0, 0,
+    0, -8, 0, 0, -8, -4, 0, 0, 0, 0, 4, 0, -7, -25, -25, -15,
+    -15, 31, 14, 8, -67, -5, 15, -8, 0, -8, -8, -27, 0, 8, -10, -6,
+    -6, -22, -42, -10, -10, -29, 2, -25, -12, -18, -28, -31, -19, 23, 0, 2,
+    -56, -6, 8, -13, -5, -18, -17, -28, -12, -6, 0, 0, -16, -42, -42, -11,
+    -27, -45, -2, -25, -12, -25, -28, -15, -25, 25, -8, 4, -71, -14, 15, -17,
+    -13, -28, -23, -32, -9, -6, -8, -16, -2, -50, -46, -18, -29, -52, -15, -38,
+    0, 0, 0, 0, 0, -17, -4, 0, 0, 0, -17, 0, -9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 8, -9, 0,
+    0, -21, -8, -18, 0, 0, -21, 0, -8, 0, 0, -8, 0, -62, -15, -31,
+    -28, -4, 0, 0, 0, 0, 0, -14, 0, 8, 0, 0, 0, -21, -8, -15,
+    0, 0, -22, 0, -8, 0, 0, 0, 0, -74, 0, -15, -38, -12, 0, 0,
+    0, 0, 0, -12, 0, -8, -8, -23, 9, 38, 13, 17, -21, 9, 32, 9,
+    22, 17, 0, 0, 0, 0, 0, 0, 0, -8, -6, 61, 61, 0, 0, 0,
+    -12, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -65, -9, -6, -38, 0, 0, 0, 0, 0, 0, 0, 0, -18, 8, 0,
+    -8, 6, 14, 8, -23, 0, -2, -6, 8, 0, 0, 0, 0, -19, 0, -7,
+    -15, -8, -17, -5, -5, -13, 0, -15, 0, 0, 0, 0, 0, -5, -8, -8,
+    0, 0, -21, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -8, 0, -8, 8, 0, -13, -15, -5, 0, -22, -5, -17, -5,
+    -9, 0, 0, 0, 0, 0, 0, 0, 0, 0, -14, 0, 0, 0, -10, 0,
+    -7, -18, 0, 8, -8, 6, 1, 0, -25, 0, -5, -2, 0, -8, -6, 0,
+    0, -31, -9, -17, -23, -8, -14, 0, 0, -8, 0, 0,
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes =
+{
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 37,
+    .right_class_cnt     = 28,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t ui_font_montserrat_48 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 52,          /*The maximum line height required by the font*/
+    .base_line = 9,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -4,
+    .underline_thickness = 2,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
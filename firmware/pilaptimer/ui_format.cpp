@@ -0,0 +1,121 @@
+#include "ui_format.h"
+
+#include <string.h>
+
+namespace {
+// Longest result is a signed 32-bit millisecond value: "-2147483.648" plus a suffix.
+constexpr size_t kScratch = 24;
+
+// Writes v right-aligned ending at end, at least minDigits digits; returns the start.
+char *put_uint(char *end, uint32_t v, uint8_t minDigits) {
+  char *p = end;
+  do {
+    *--p = (char)('0' + v % 10);
+    v /= 10;
+  } while (v || (uint8_t)(end - p) < minDigits);
+  return p;
+}
+
+// snprintf()-style copy out of the scratch buffer.
+size_t emit(char *out, size_t size, const char *begin, const char *end) {
+  const size_t len = (size_t)(end - begin);
+  if (size) {
+    const size_t n = len < size - 1 ? len : size - 1;
+    memcpy(out, begin, n);
+    out[n] = '\0';
+  }
+  return len;
+}
+
+// "<int>.<frac digits>" for value = whole + frac / 10^fracDigits, right-aligned at end.
+char *put_fixed(char *end, uint32_t whole, uint32_t frac, uint8_t fracDigits) {
+  char *p = put_uint(end, frac, fracDigits);
+  *--p = '.';
+  return put_uint(p, whole, 1);
+}
+}  // namespace
+
+size_t ui_format_time_ms(char *out, size_t size, uint32_t ms) {
+  char buf[kScratch];
+  char *end = buf + sizeof(buf);
+  const uint32_t totalSec = ms / 1000;
+  char *p = put_uint(end, ms % 1000, 3);
+  *--p = '.';
+  p = put_uint(p, totalSec % 60, 2);
+  *--p = ':';
+  p = put_uint(p, totalSec / 60, 1);
+  return emit(out, size, p, end);
+}
+
+size_t ui_format_time_ms_maybe(char *out, size_t size, bool valid, uint32_t ms) {
+  if (!valid) {
+    static const char kInvalid[] = "--:--.---";
+    return emit(out, size, kInvalid, kInvalid + sizeof(kInvalid) - 1);
+  }
+  return ui_format_time_ms(out, size, ms);
+}
+
+size_t ui_format_delta_ms(char *out, size_t size, int32_t deltaMs) {
+  char buf[kScratch];
+  char *end = buf + sizeof(buf);
+  const uint32_t magnitude = deltaMs < 0 ? 0u - (uint32_t)deltaMs : (uint32_t)deltaMs;
+  char *p = put_fixed(end, magnitude / 1000, magnitude % 1000, 3);
+  *--p = deltaMs < 0 ? '-' : '+';
+  return emit(out, size, p, end);
+}
+
+size_t ui_format_reaction_ms(char *out, size_t size, uint32_t ms) {
+  char buf[kScratch];
+  char *end = buf + sizeof(buf);
+  *--end = 's';
+  char *p = put_fixed(end, ms / 1000, ms % 1000, 3);
+  return emit(out, size, p, buf + sizeof(buf));
+}
+
+size_t ui_format_fixed2(char *out, size_t size, float value) {
+  char buf[kScratch];
+  char *end = buf + sizeof(buf);
+
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  const bool negative = (bits >> 31) != 0;
+  const int32_t exponent = (int32_t)((bits >> 23) & 0xff);
+  uint32_t mantissa = bits & 0x7fffff;
+
+  char *p;
+  if (exponent == 0xff) {
+    static const char kInf[] = "inf";
+    static const char kNan[] = "nan";
+    const char *text = mantissa ? kNan : kInf;
+    p = end - 3;
+    memcpy(p, text, 3);
+  } else {
+    // value = mantissa * 2^shift exactly; scale by 100 and round to nearest, ties to
+    // even, on the exact product so the result matches printf's correctly rounded "%.2f".
+    int32_t shift;
+    if (exponent == 0) {
+      shift = -149;
+    } else {
+      mantissa |= 0x800000;
+      shift = exponent - 150;
+    }
+    uint64_t scaled = (uint64_t)mantissa * 100u;
+    uint64_t centi;
+    if (shift >= 0) {
+      centi = shift < 32 ? scaled << shift : UINT64_MAX;
+    } else if (shift <= -64) {
+      centi = 0;
+    } else {
+      const uint32_t drop = (uint32_t)-shift;
+      centi = scaled >> drop;
+      const uint64_t rest = scaled & ((1ull << drop) - 1);
+      const uint64_t half = 1ull << (drop - 1);
+      if (rest > half || (rest == half && (centi & 1))) centi++;
+    }
+    const uint64_t kMaxCenti = (uint64_t)UINT32_MAX * 100u + 99u;
+    if (centi > kMaxCenti) centi = kMaxCenti;
+    p = put_fixed(end, (uint32_t)(centi / 100), (uint32_t)(centi % 100), 2);
+  }
+  if (negative) *--p = '-';
+  return emit(out, size, p, end);
+}
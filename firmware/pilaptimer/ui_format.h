@@ -0,0 +1,28 @@
+#ifndef UI_FORMAT_H
+#define UI_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Number formatting for the on-screen times and G values, using integer arithmetic only
+// (no newlib float printf, no allocation). Each function writes the same bytes as the
+// snprintf() call it replaces and, like snprintf(), truncates to size - 1 characters,
+// always terminates when size > 0 and returns the untruncated length.
+// firmware/host/bench_format.cpp checks the output against those snprintf() calls.
+
+// "%lu:%02lu.%03lu" of minutes, seconds, milliseconds, e.g. "1:02.345".
+size_t ui_format_time_ms(char *out, size_t size, uint32_t ms);
+// As ui_format_time_ms(), or "--:--.---" when !valid.
+size_t ui_format_time_ms_maybe(char *out, size_t size, bool valid, uint32_t ms);
+// "%+0.3f" of deltaMs / 1000.0f, e.g. "+0.370", "-1.205". Matches the float version for
+// |deltaMs| < 16384000 (4.5 h); beyond that the float quotient no longer held whole ms.
+size_t ui_format_delta_ms(char *out, size_t size, int32_t deltaMs);
+// "%0.3fs" of ms / 1000.0f, e.g. "0.218s"; same range note as ui_format_delta_ms().
+size_t ui_format_reaction_ms(char *out, size_t size, uint32_t ms);
+// Longest ui_format_reaction_ms() output, "4294967.295s", without the terminator.
+static const size_t kUiFormatReactionMsMaxLen = 12;
+// "%.2f" of value, rounded exactly like printf (to nearest, ties to even) from the
+// float's bits. For |value| >= 2^32 the integer part is clamped; G values never get there.
+size_t ui_format_fixed2(char *out, size_t size, float value);
+
+#endif
@@ -0,0 +1,70 @@
+#include "ui_glow_sprite.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+float clamp01(float v) {
+  return v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+}
+}  // namespace
+
+/******************************************************************************
+function : Render a glowing circle sprite
+parameter:
+    img       : image descriptor to fill
+    width     : sprite width
+    height    : sprite height
+    diameter  : circle diameter, centred in the sprite
+    color     : circle and glow colour
+    glowWidth : glow blur width (style shadow_width)
+    glowOpa   : glow opacity (style shadow_opa)
+******************************************************************************/
+bool ui_glow_sprite_build(lv_img_dsc_t *img, lv_coord_t width, lv_coord_t height,
+                          lv_coord_t diameter, lv_color_t color, lv_coord_t glowWidth,
+                          lv_opa_t glowOpa) {
+  memset(img, 0, sizeof(*img));
+  const uint32_t pixels = (uint32_t)width * height;
+  uint8_t *data = static_cast<uint8_t *>(malloc(pixels * LV_IMG_PX_SIZE_ALPHA_BYTE));
+  if (!data) return false;
+
+  const float cx = width / 2.0f;
+  const float cy = height / 2.0f;
+  const float radius = diameter / 2.0f;
+  // Smoothstep from glowWidth / 4 outside the edge to 3/8 glowWidth inside it.
+  const float glowOuter = radius + glowWidth / 4.0f;
+  const float glowSpan = glowWidth * 5.0f / 8.0f;
+  uint8_t *out = data;
+  for (lv_coord_t y = 0; y < height; ++y) {
+    for (lv_coord_t x = 0; x < width; ++x) {
+      const float dx = x + 0.5f - cx;
+      const float dy = y + 0.5f - cy;
+      const float d = sqrtf(dx * dx + dy * dy);
+      // One pixel of anti-aliasing on the edge, like LVGL's radius mask.
+      const float cover = clamp01(radius + 0.5f - d);
+      float glow = 0.0f;
+      if (glowSpan > 0.0f) {
+        const float t = clamp01((glowOuter - d) / glowSpan);
+        glow = t * t * (3.0f - 2.0f * t) * glowOpa / 255.0f;
+      }
+      const float alpha = cover + (1.0f - cover) * glow;
+      memcpy(out, &color, sizeof(lv_color_t));
+      out[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = (uint8_t)(alpha * 255.0f + 0.5f);
+      out += LV_IMG_PX_SIZE_ALPHA_BYTE;
+    }
+  }
+
+  img->header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+  img->header.w = width;
+  img->header.h = height;
+  img->data_size = pixels * LV_IMG_PX_SIZE_ALPHA_BYTE;
+  img->data = data;
+  return true;
+}
+
+void ui_glow_sprite_free(lv_img_dsc_t *img) {
+  if (img->data) lv_img_cache_invalidate_src(img);
+  free(const_cast<uint8_t *>(img->data));
+  memset(img, 0, sizeof(*img));
+}
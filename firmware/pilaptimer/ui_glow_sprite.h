@@ -0,0 +1,24 @@
+#ifndef UI_GLOW_SPRITE_H
+#define UI_GLOW_SPRITE_H
+
+#ifndef LV_CONF_INCLUDE_SIMPLE
+#define LV_CONF_INCLUDE_SIMPLE
+#endif
+#include <lvgl.h>
+
+// A lit circle with its glow, rendered once into a true-colour + alpha image. Drawing it
+// is a plain alpha blend; the same look as a style shadow_width costs LVGL a blurred
+// shadow mask on every redraw. The glow's falloff is fitted to LVGL 8's software shadow
+// of the same width and opacity: it fades to nothing glowWidth / 4 outside the circle.
+//
+// The image is width x height with the circle centred; glow that falls outside is cut
+// off, so a sprite can match a light whose parent clips it. The pixels live outside
+// LVGL's heap (LV_MEM_SIZE), like the digit clock glyphs.
+
+// Returns false (img left empty) when the pixels cannot be allocated.
+bool ui_glow_sprite_build(lv_img_dsc_t *img, lv_coord_t width, lv_coord_t height,
+                          lv_coord_t diameter, lv_color_t color, lv_coord_t glowWidth,
+                          lv_opa_t glowOpa);
+void ui_glow_sprite_free(lv_img_dsc_t *img);
+
+#endif
@@ -0,0 +1,76 @@
+#include "ui_panel_scroll.h"
+
+namespace {
+lv_disp_t *disp = nullptr;
+lv_timer_cb_t nextCb = nullptr;
+lv_obj_t *scroller = nullptr;  // Non-null while a scroll is in progress.
+lv_coord_t shownScrollX = 0;   // Scroller position the panel shows.
+lv_coord_t offset = 0;
+UiPanelScrollStats stats{};
+UiPanelScrollBand lastBand{};
+bool lastBanded = false;
+
+void refr_timer_cb(lv_timer_t *timer) {
+  lastBanded = false;
+  if (scroller && disp->inv_p > 0) {
+    const lv_coord_t scrollX = lv_obj_get_scroll_x(scroller);
+    const lv_coord_t dx = scrollX - shownScrollX;
+    const lv_coord_t width = lv_disp_get_hor_res(disp);
+    const lv_coord_t height = lv_disp_get_ver_res(disp);
+    // A jump of a whole screen or more leaves nothing to reuse: redraw as invalidated.
+    if (dx != 0 && LV_ABS(dx) < width) {
+      lv_area_t band;
+      band.x1 = dx > 0 ? width - dx : 0;
+      band.x2 = dx > 0 ? width - 1 : -dx - 1;
+      band.y1 = 0;
+      band.y2 = height - 1;
+      lastBand.band = band;
+      lastBand.dx = dx;
+      lastBanded = true;
+      disp->inv_areas[0] = band;
+      disp->inv_p = 1;
+      offset = (offset + dx + width) % width;
+      stats.bandFrames++;
+      stats.bandPixels += lv_area_get_size(&band);
+      stats.fullPixels += (uint32_t)width * height;
+    }
+    shownScrollX = scrollX;
+  }
+  nextCb(timer);
+}
+}  // namespace
+
+void ui_panel_scroll_install(lv_disp_t *display) {
+  disp = display;
+  lv_timer_t *timer = _lv_disp_get_refr_timer(disp);
+  nextCb = timer->timer_cb;
+  lv_timer_set_cb(timer, refr_timer_cb);
+}
+
+void ui_panel_scroll_begin(lv_obj_t *obj) {
+  if (!disp || scroller) return;
+  scroller = obj;
+  shownScrollX = lv_obj_get_scroll_x(obj);
+  stats.transitions++;
+}
+
+void ui_panel_scroll_end() {
+  if (!scroller) return;
+  scroller = nullptr;
+  // Drawn through the same offset, so the panel stays where the scroll left it.
+  lv_obj_invalidate(lv_disp_get_scr_act(disp));
+}
+
+bool ui_panel_scroll_active() { return scroller != nullptr; }
+
+lv_coord_t ui_panel_scroll_offset() { return offset; }
+
+bool ui_panel_scroll_last_band(UiPanelScrollBand &out) {
+  if (lastBanded) out = lastBand;
+  return lastBanded;
+}
+
+void ui_panel_scroll_take_stats(UiPanelScrollStats &out) {
+  out = stats;
+  stats = UiPanelScrollStats{};
+}
@@ -0,0 +1,51 @@
+#ifndef UI_PANEL_SCROLL_H
+#define UI_PANEL_SCROLL_H
+
+#include <stdint.h>
+
+#ifndef LV_CONF_INCLUDE_SIMPLE
+#define LV_CONF_INCLUDE_SIMPLE
+#endif
+#include <lvgl.h>
+
+// Tile transitions by panel scrolling. While a full-screen scroller (the tileview) moves
+// horizontally, every refresh that sees it moved by dx pixels draws only the dx columns
+// it uncovered and advances a circular column offset by dx; the display port writes
+// logical column x to panel column (x + offset) mod hor_res and moves the panel's scroll
+// start to match, so the rest of the picture moves in panel memory instead of being
+// redrawn. Anything else invalidated meanwhile is caught up by one full redraw when the
+// scroll ends.
+//
+// The display port installs it (lv_port_disp.cpp with LV_PORT_DISP_HW_SCROLL, sim_display.cpp
+// with sim_ui --panel-scroll); without that the calls below do nothing and the offset
+// stays 0.
+
+struct UiPanelScrollStats {
+  uint32_t transitions;  // Scrolls started.
+  uint32_t bandFrames;   // Refreshes that drew only the uncovered band.
+  uint32_t bandPixels;   // Their size.
+  uint32_t fullPixels;   // What the same refreshes would have drawn as full redraws.
+};
+
+// A refresh the band filter cut down to a band. Every other area invalidated for it was
+// dropped and stays stale until the scroll ends.
+struct UiPanelScrollBand {
+  lv_area_t band;  // Columns drawn.
+  lv_coord_t dx;   // How far the rest of the picture moved left (negative: right).
+};
+
+// Wraps disp's refresh timer callback with the band filter.
+void ui_panel_scroll_install(lv_disp_t *disp);
+// From the scroller's LV_EVENT_SCROLL_BEGIN / LV_EVENT_SCROLL_END. Nested begins (a drag
+// followed by its snap animation) continue the same scroll.
+void ui_panel_scroll_begin(lv_obj_t *scroller);
+void ui_panel_scroll_end();
+bool ui_panel_scroll_active();
+// Circular column offset, 0 .. hor_res - 1, for the refresh in progress.
+lv_coord_t ui_panel_scroll_offset();
+// True (and out filled) when the last refresh drew only a band. For checks on the host.
+bool ui_panel_scroll_last_band(UiPanelScrollBand &out);
+// Copies the counters since the last call and clears them.
+void ui_panel_scroll_take_stats(UiPanelScrollStats &out);
+
+#endif
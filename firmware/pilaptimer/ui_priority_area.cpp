@@ -0,0 +1,105 @@
+#include "ui_priority_area.h"
+
+namespace {
+// Held areas beyond this many are merged into the last slot's bounding box.
+constexpr uint8_t kMaxHeldAreas = 8;
+
+lv_disp_t *disp = nullptr;
+lv_timer_cb_t nextCb = nullptr;
+bool active = false;
+lv_area_t priority[kUiPriorityAreaMax];
+uint8_t priorityCount = 0;
+uint32_t backgroundMs = 0;
+uint32_t lastBackgroundMs = 0;
+lv_area_t held[kMaxHeldAreas];
+uint8_t heldCount = 0;
+UiPriorityAreaStats stats{};
+
+void hold(const lv_area_t &area) {
+  stats.heldAreas++;
+  stats.heldPixels += lv_area_get_size(&area);
+  for (uint8_t i = 0; i < heldCount; ++i) {
+    if (_lv_area_is_in(&area, &held[i], 0)) return;
+  }
+  if (heldCount < kMaxHeldAreas) {
+    held[heldCount++] = area;
+    return;
+  }
+  lv_area_t &last = held[kMaxHeldAreas - 1];
+  _lv_area_join(&last, &last, &area);
+}
+
+// Hands the held areas back to LVGL; they are drawn with whatever else is invalid.
+void release_held() {
+  for (uint8_t i = 0; i < heldCount; ++i) _lv_inv_area(disp, &held[i]);
+  heldCount = 0;
+}
+
+bool touches_priority(const lv_area_t *area) {
+  for (uint8_t i = 0; i < priorityCount; ++i) {
+    if (_lv_area_is_on(area, &priority[i])) return true;
+  }
+  return false;
+}
+
+void refr_timer_cb(lv_timer_t *timer) {
+  if (active && disp->inv_p > 0) {
+    const bool backgroundDue = lv_tick_elaps(lastBackgroundMs) >= backgroundMs;
+    bool background = false;
+    uint16_t kept = 0;
+    for (uint16_t i = 0; i < disp->inv_p; ++i) {
+      const lv_area_t area = disp->inv_areas[i];
+      if (touches_priority(&area)) {
+        disp->inv_areas[kept++] = area;
+      } else if (backgroundDue) {
+        disp->inv_areas[kept++] = area;
+        background = true;
+      } else {
+        hold(area);
+      }
+    }
+    disp->inv_p = kept;
+    if (backgroundDue && heldCount > 0) {
+      release_held();
+      background = true;
+    }
+    if (background) {
+      lastBackgroundMs = lv_tick_get();
+      stats.backgroundFrames++;
+    } else if (kept > 0) {
+      stats.priorityFrames++;
+    }
+  }
+  nextCb(timer);
+  // The refresh pauses its timer once nothing is invalid; held areas still need it.
+  if (heldCount > 0) lv_timer_resume(timer);
+}
+}  // namespace
+
+void ui_priority_area_install(lv_disp_t *display) {
+  disp = display;
+  lv_timer_t *timer = _lv_disp_get_refr_timer(disp);
+  nextCb = timer->timer_cb;
+  lv_timer_set_cb(timer, refr_timer_cb);
+}
+
+void ui_priority_area_set(const lv_area_t *areas, uint8_t count, uint32_t background) {
+  if (!active) lastBackgroundMs = lv_tick_get();
+  active = true;
+  priorityCount = count < kUiPriorityAreaMax ? count : kUiPriorityAreaMax;
+  for (uint8_t i = 0; i < priorityCount; ++i) priority[i] = areas[i];
+  backgroundMs = background;
+}
+
+void ui_priority_area_clear() {
+  if (!active) return;
+  active = false;
+  release_held();
+}
+
+bool ui_priority_area_active() { return active; }
+
+void ui_priority_area_take_stats(UiPriorityAreaStats &out) {
+  out = stats;
+  stats = UiPriorityAreaStats{};
+}
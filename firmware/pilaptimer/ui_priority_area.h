@@ -0,0 +1,42 @@
+#ifndef UI_PRIORITY_AREA_H
+#define UI_PRIORITY_AREA_H
+
+#include <stdint.h>
+
+#ifndef LV_CONF_INCLUDE_SIMPLE
+#define LV_CONF_INCLUDE_SIMPLE
+#endif
+#include <lvgl.h>
+
+// Region-priority refresh. While priority areas are set, every refresh still draws
+// invalidated areas that touch one of them at the display refresh rate, but holds back
+// areas entirely outside them and redraws those at most once per background interval.
+// During a run that keeps the lap clock, lap counter and delta pill on the refresh
+// timer's schedule while the rest of the race tile catches up a few times a second, so a
+// lap's frame only carries what the driver reads.
+//
+// The display port installs it on its refresh timer (lv_port_disp.cpp, and sim_display.cpp
+// on the host); the refresh governor (ui_refresh.h) sets and clears the areas.
+
+static const uint8_t kUiPriorityAreaMax = 4;
+
+struct UiPriorityAreaStats {
+  uint32_t priorityFrames;    // Refreshes that drew only areas touching a priority area.
+  uint32_t backgroundFrames;  // Refreshes that also drew background areas.
+  uint32_t heldAreas;         // Invalidated areas held back for a later background pass.
+  uint32_t heldPixels;        // Their size.
+};
+
+// Wraps disp's refresh timer callback (LVGL's, or a filter installed before) with the
+// area filter.
+void ui_priority_area_install(lv_disp_t *disp);
+// Starts (or moves) the priority areas, in screen coordinates; at most
+// kUiPriorityAreaMax are used.
+void ui_priority_area_set(const lv_area_t *areas, uint8_t count, uint32_t backgroundMs);
+// Stops filtering; anything held back is drawn by the next refresh.
+void ui_priority_area_clear();
+bool ui_priority_area_active();
+// Copies the counters since the last call and clears them.
+void ui_priority_area_take_stats(UiPriorityAreaStats &out);
+
+#endif
@@ -0,0 +1,155 @@
+#include "ui_refresh.h"
+
+#include <lvgl.h>
+
+#include "lv_time_attack_ui.h"
+#include "screen_nav.h"
+#include "ui_priority_area.h"
+
+// 0 keeps the fixed rates (LV_DISP_DEF_REFR_PERIOD, 100 ms snapshots) but still tracks
+// the modes, so the per-mode figures of both builds can be compared.
+#ifndef UI_REFRESH_GOVERNOR
+#define UI_REFRESH_GOVERNOR 1
+#endif
+
+// 1: while the race clock runs on a settled race tile, only the lap counter, clock and
+// delta pill are drawn at the refresh rate; the rest of the tile every
+// kBackgroundRefreshMs (ui_priority_area.h).
+#ifndef UI_REFRESH_PRIORITY_AREA
+#define UI_REFRESH_PRIORITY_AREA 1
+#endif
+
+namespace {
+struct ModeRates {
+  uint16_t refrMs;      // Display refresh timer period.
+  uint16_t snapshotMs;  // Snapshot push interval.
+};
+
+// Indexed by UiRefreshMode. The race clock shows hundredths and the reaction timer
+// milliseconds, so RUNNING pushes snapshots at 25 Hz; everything else changes on events
+// that push immediately anyway.
+constexpr ModeRates kRates[UI_REFRESH_MODE_COUNT] = {
+    {200, 500},  // STATIC
+    {10, 250},   // LIVE
+    {10, 100},   // INTERACTIVE
+    {10, 40},    // RUNNING
+    {10, 100},   // TRANSITION
+};
+#if !UI_REFRESH_GOVERNOR
+constexpr ModeRates kFixedRates = {LV_DISP_DEF_REFR_PERIOD, 100};
+#endif
+constexpr uint32_t kInteractiveHoldMs = 1000;
+constexpr uint32_t kBackgroundRefreshMs = 500;
+
+lv_disp_t *disp = nullptr;
+UiRefreshMode mode = UI_REFRESH_INTERACTIVE;
+UiRefreshModeStats stats[UI_REFRESH_MODE_COUNT]{};
+uint32_t lastUpdateMs = 0;
+uint32_t lastChangeMs = 0;
+UiState lastRaceState = UI_BOOT;
+ReactionState lastReactionState = REACTION_IDLE;
+
+const ModeRates &rates() {
+#if UI_REFRESH_GOVERNOR
+  return kRates[mode];
+#else
+  return kFixedRates;
+#endif
+}
+
+// raceClock: the race is running and its tile is settled on screen. That outranks
+// animations, so the delta pill's lap animation keeps the clock's rates.
+UiRefreshMode pick_mode(uint32_t nowMs, bool raceClock, ReactionState reactionState) {
+  if (raceClock) return UI_REFRESH_RUNNING;
+  if (lv_anim_count_running() > 0 || screen_nav_is_transitioning()) {
+    return UI_REFRESH_TRANSITION;
+  }
+  const LvTimeAttackTile tile = lv_time_attack_ui_get_visible_tile();
+  if (tile == LV_TIME_ATTACK_TILE_REACTION && reactionState == REACTION_WAIT_FOR_MOVE) {
+    return UI_REFRESH_RUNNING;
+  }
+  if (lv_disp_get_inactive_time(disp) < kInteractiveHoldMs ||
+      nowMs - lastChangeMs < kInteractiveHoldMs) {
+    return UI_REFRESH_INTERACTIVE;
+  }
+  if (tile == LV_TIME_ATTACK_TILE_GFORCE) return UI_REFRESH_LIVE;
+  if (tile == LV_TIME_ATTACK_TILE_REACTION && reactionState != REACTION_IDLE &&
+      reactionState != REACTION_FALSE_START) {
+    return UI_REFRESH_RUNNING;
+  }
+  return UI_REFRESH_STATIC;
+}
+}  // namespace
+
+void ui_refresh_init(lv_disp_t *display) {
+  disp = display;
+  mode = UI_REFRESH_INTERACTIVE;
+  lastUpdateMs = lv_tick_get();
+  lastChangeMs = lastUpdateMs;
+  lv_timer_set_period(_lv_disp_get_refr_timer(disp), rates().refrMs);
+}
+
+void ui_refresh_update(uint32_t nowMs, UiState raceState, ReactionState reactionState) {
+  stats[mode].ms += nowMs - lastUpdateMs;
+  lastUpdateMs = nowMs;
+  if (raceState != lastRaceState || reactionState != lastReactionState) {
+    lastRaceState = raceState;
+    lastReactionState = reactionState;
+    lastChangeMs = nowMs;
+  }
+
+  lv_area_t areas[3];
+  const uint8_t areaCount =
+      raceState == UI_RUNNING ? lv_time_attack_ui_get_priority_areas(areas) : 0;
+#if UI_REFRESH_PRIORITY_AREA
+  if (areaCount > 0) {
+    ui_priority_area_set(areas, areaCount, kBackgroundRefreshMs);
+  } else {
+    ui_priority_area_clear();
+  }
+#endif
+
+  const UiRefreshMode next = pick_mode(nowMs, areaCount > 0, reactionState);
+  if (next == mode) return;
+  const uint16_t oldRefrMs = rates().refrMs;
+  mode = next;
+  const uint16_t refrMs = rates().refrMs;
+  if (refrMs == oldRefrMs) return;
+  lv_timer_t *timer = _lv_disp_get_refr_timer(disp);
+  lv_timer_set_period(timer, refrMs);
+  // Whatever was invalidated under the slow period renders on the next pass, not when the
+  // old period would have run out.
+  if (refrMs < oldRefrMs) lv_timer_ready(timer);
+}
+
+UiRefreshMode ui_refresh_mode() { return mode; }
+
+uint32_t ui_refresh_snapshot_ms() { return rates().snapshotMs; }
+
+void ui_refresh_note_frame() { stats[mode].frames++; }
+
+void ui_refresh_add_busy_us(uint32_t us) { stats[mode].busyUs += us; }
+
+void ui_refresh_take_stats(UiRefreshModeStats (&out)[UI_REFRESH_MODE_COUNT]) {
+  for (uint8_t m = 0; m < UI_REFRESH_MODE_COUNT; ++m) {
+    out[m] = stats[m];
+    stats[m] = UiRefreshModeStats{};
+  }
+}
+
+const char *ui_refresh_mode_name(uint8_t m) {
+  switch (m) {
+    case UI_REFRESH_STATIC:
+      return "static";
+    case UI_REFRESH_LIVE:
+      return "live";
+    case UI_REFRESH_INTERACTIVE:
+      return "interactive";
+    case UI_REFRESH_RUNNING:
+      return "running";
+    case UI_REFRESH_TRANSITION:
+      return "transition";
+    default:
+      return "?";
+  }
+}
@@ -0,0 +1,52 @@
+#ifndef UI_REFRESH_H
+#define UI_REFRESH_H
+
+#include <stdint.h>
+
+#include "screen_reaction.h"
+#include "ui_state.h"
+
+struct _lv_disp_t;
+typedef struct _lv_disp_t lv_disp_t;
+
+// Refresh governor: picks how often LVGL may render (the display refresh timer period)
+// and how often loop() pushes UI snapshots, from what the device is doing. Tile scrolls
+// and other animations, touches and state changes, the running race clock and the
+// reaction timer get full rate; a static screen drops to a few Hz. LVGL still only
+// renders what was invalidated, so a slow mode caps the frame rate rather than forcing
+// frames. Counters per mode say how much of the time each rate was in force, what frame
+// rate it actually delivered and how busy the CPU was meanwhile. While the race clock
+// runs, the governor also keeps the race tile's priority areas set (ui_priority_area.h).
+
+enum UiRefreshMode {
+  UI_REFRESH_STATIC,       // Nothing changing: settings, idle race tile, results.
+  UI_REFRESH_LIVE,         // G-force tile: redrawn by its own timer.
+  UI_REFRESH_INTERACTIVE,  // Shortly after a touch or a race/reaction state change.
+  UI_REFRESH_RUNNING,      // Race clock or reaction timer counting on screen.
+  UI_REFRESH_TRANSITION,   // Tile scroll or another LVGL animation in progress.
+  UI_REFRESH_MODE_COUNT
+};
+
+struct UiRefreshModeStats {
+  uint32_t ms;      // Time spent in the mode.
+  uint32_t frames;  // Refresh cycles that rendered something.
+  uint32_t busyUs;  // Time reported through ui_refresh_add_busy_us() in the mode.
+};
+
+void ui_refresh_init(lv_disp_t *disp);
+// Re-evaluates the mode and, when it changes, applies its display refresh period. Call
+// once per loop() pass after the snapshots went out.
+void ui_refresh_update(uint32_t nowMs, UiState raceState, ReactionState reactionState);
+UiRefreshMode ui_refresh_mode();
+// Interval between race/reaction snapshot pushes in the current mode (state changes are
+// still pushed immediately).
+uint32_t ui_refresh_snapshot_ms();
+// From the display driver's monitor_cb: one refresh cycle rendered.
+void ui_refresh_note_frame();
+// UI work done by the caller (lv_timer_handler(), snapshot updates), for the busy share.
+void ui_refresh_add_busy_us(uint32_t us);
+// Copies the counters since the last call (ms up to the last update) and clears them.
+void ui_refresh_take_stats(UiRefreshModeStats (&out)[UI_REFRESH_MODE_COUNT]);
+const char *ui_refresh_mode_name(uint8_t mode);
+
+#endif
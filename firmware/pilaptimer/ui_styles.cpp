@@ -0,0 +1,64 @@
+#include "ui_styles.h"
+
+namespace {
+lv_style_t styles[UI_STYLE_COUNT];
+bool initialised = false;
+
+void init_container(lv_style_t *style) {
+  lv_style_set_bg_opa(style, LV_OPA_TRANSP);
+  lv_style_set_border_width(style, 0);
+}
+
+void init_flex(lv_style_t *style, lv_flex_flow_t flow) {
+  init_container(style);
+  lv_style_set_layout(style, LV_LAYOUT_FLEX);
+  lv_style_set_flex_flow(style, flow);
+  lv_style_set_flex_main_place(style, LV_FLEX_ALIGN_START);
+  lv_style_set_flex_cross_place(style, LV_FLEX_ALIGN_CENTER);
+  lv_style_set_flex_track_place(style, LV_FLEX_ALIGN_CENTER);
+  lv_style_set_pad_row(style, 12);
+  lv_style_set_pad_column(style, 12);
+}
+
+void init_text(lv_style_t *style, uint32_t color, const lv_font_t *font) {
+  lv_style_set_text_color(style, lv_color_hex(color));
+  lv_style_set_text_font(style, font);
+}
+}  // namespace
+
+void ui_styles_init() {
+  if (initialised) return;
+  initialised = true;
+  for (lv_style_t &style : styles) lv_style_init(&style);
+
+  lv_style_set_bg_color(&styles[UI_STYLE_TILE], lv_color_hex(0x0b0f14));
+  lv_style_set_bg_opa(&styles[UI_STYLE_TILE], LV_OPA_COVER);
+
+  init_container(&styles[UI_STYLE_CONTAINER]);
+  init_flex(&styles[UI_STYLE_ROW], LV_FLEX_FLOW_ROW);
+  init_flex(&styles[UI_STYLE_COLUMN], LV_FLEX_FLOW_COLUMN);
+
+  lv_style_set_radius(&styles[UI_STYLE_BUTTON], 18);
+  lv_style_set_bg_color(&styles[UI_STYLE_BUTTON], lv_color_hex(0x1e2a38));
+  lv_style_set_bg_opa(&styles[UI_STYLE_BUTTON], LV_OPA_COVER);
+  lv_style_set_border_width(&styles[UI_STYLE_BUTTON], 0);
+
+  lv_style_set_radius(&styles[UI_STYLE_CIRCLE], LV_RADIUS_CIRCLE);
+  lv_style_set_border_width(&styles[UI_STYLE_CIRCLE], 0);
+
+  init_text(&styles[UI_STYLE_TITLE], 0x8fa0b6, &ui_font_montserrat_20);
+  init_text(&styles[UI_STYLE_CAPTION], 0x8fa0b6, &ui_font_montserrat_24);
+  init_text(&styles[UI_STYLE_VALUE_24], 0xf5f8ff, &ui_font_montserrat_24);
+  init_text(&styles[UI_STYLE_VALUE_32], 0xf5f8ff, &ui_font_montserrat_32);
+  init_text(&styles[UI_STYLE_VALUE_48], 0xf5f8ff, &ui_font_montserrat_48);
+  lv_style_set_text_font(&styles[UI_STYLE_TEXT_24], &ui_font_montserrat_24);
+  lv_style_set_text_font(&styles[UI_STYLE_TEXT_32], &ui_font_montserrat_32);
+}
+
+void ui_style_add(lv_obj_t *obj, UiStyle style) {
+  if (!obj || style >= UI_STYLE_COUNT) return;
+  for (uint32_t i = 0; i < obj->style_cnt; ++i) {
+    if (obj->styles[i].style == &styles[style]) return;
+  }
+  lv_obj_add_style(obj, &styles[style], 0);
+}
@@ -0,0 +1,38 @@
+#ifndef UI_STYLES_H
+#define UI_STYLES_H
+
+#ifndef LV_CONF_INCLUDE_SIMPLE
+#define LV_CONF_INCLUDE_SIMPLE
+#endif
+#include <lvgl.h>
+
+// Looks shared by the LVGL tiles. Each is one statically allocated lv_style_t added to
+// every object that uses it, instead of the same lv_obj_set_style_*() calls repeated per
+// object, which gives every object its own copy of the properties on the LVGL heap.
+// Per-object differences (size, alignment, colours driven by ui_bind.h) stay local and
+// take precedence.
+
+enum UiStyle {
+  UI_STYLE_TILE,         // Opaque tile background.
+  UI_STYLE_CONTAINER,    // Transparent and borderless.
+  UI_STYLE_ROW,          // Container laying out children left to right, 12 px apart.
+  UI_STYLE_COLUMN,       // Container laying out children top to bottom, 12 px apart.
+  UI_STYLE_BUTTON,       // Rounded dark button without border.
+  UI_STYLE_CIRCLE,       // Borderless circle (reaction lights, G-force ball).
+  UI_STYLE_TITLE,        // Muted 20 px heading.
+  UI_STYLE_CAPTION,      // Muted 24 px heading/field label.
+  UI_STYLE_VALUE_24,     // Bright value text, 24 px.
+  UI_STYLE_VALUE_32,     // Bright value text, 32 px.
+  UI_STYLE_VALUE_48,     // Bright value text, 48 px.
+  UI_STYLE_TEXT_24,      // 24 px text whose colour comes from the parent or a binding.
+  UI_STYLE_TEXT_32,      // 32 px text whose colour comes from the parent.
+  UI_STYLE_COUNT
+};
+
+// Initialises the styles on first call; later calls do nothing.
+void ui_styles_init();
+// Adds the shared style to the object's main part. Adding a style the object already has
+// does nothing, so screens re-attached to a kept tile can style it again.
+void ui_style_add(lv_obj_t *obj, UiStyle style);
+
+#endif
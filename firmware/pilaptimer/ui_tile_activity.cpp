@@ -0,0 +1,67 @@
+#include "ui_tile_activity.h"
+
+#include <string.h>
+
+namespace {
+UiTileActivity activity[kUiTileCount]{};
+uint8_t visibleTile = LV_TIME_ATTACK_TILE_UNKNOWN;
+uint32_t visibleSinceMs = 0;
+
+void close_visible_span() {
+  const uint32_t now = lv_tick_get();
+  activity[visibleTile].visibleMs += now - visibleSinceMs;
+  visibleSinceMs = now;
+}
+}  // namespace
+
+void ui_tile_activity_set_visible(LvTimeAttackTile tile) {
+  if (tile > LV_TIME_ATTACK_TILE_UNKNOWN) tile = LV_TIME_ATTACK_TILE_UNKNOWN;
+  close_visible_span();
+  visibleTile = (uint8_t)tile;
+  activity[visibleTile].shows++;
+}
+
+void ui_tile_activity_note(UiTileSubsystem subsystem) {
+  if (subsystem >= UI_TILE_SUBSYSTEM_COUNT) return;
+  activity[visibleTile].runs[subsystem]++;
+}
+
+void ui_tile_activity_built(LvTimeAttackTile tile, uint32_t heapBytes) {
+  if (tile > LV_TIME_ATTACK_TILE_UNKNOWN) tile = LV_TIME_ATTACK_TILE_UNKNOWN;
+  activity[tile].builds++;
+  activity[tile].buildBytes = heapBytes;
+}
+
+void ui_tile_activity_torn_down(LvTimeAttackTile tile) {
+  if (tile > LV_TIME_ATTACK_TILE_UNKNOWN) tile = LV_TIME_ATTACK_TILE_UNKNOWN;
+  activity[tile].teardowns++;
+}
+
+uint32_t ui_tile_activity_heap_used() {
+  lv_mem_monitor_t mem;
+  lv_mem_monitor(&mem);
+  return mem.total_size - mem.free_size;
+}
+
+void ui_tile_activity_sample_heap() {
+  const uint32_t used = ui_tile_activity_heap_used();
+  if (used > activity[visibleTile].heapPeak) activity[visibleTile].heapPeak = used;
+}
+
+void ui_tile_activity_take(UiTileActivity (&out)[kUiTileCount]) {
+  close_visible_span();
+  memcpy(out, activity, sizeof(activity));
+  memset(activity, 0, sizeof(activity));
+}
+
+const char *ui_tile_activity_tile_name(uint8_t tile) {
+  static const char *const kNames[kUiTileCount] = {"settings", "race",   "reaction",
+                                                   "gforce",   "review", "unknown"};
+  return tile < kUiTileCount ? kNames[tile] : "unknown";
+}
+
+const char *ui_tile_activity_subsystem_name(uint8_t subsystem) {
+  static const char *const kNames[UI_TILE_SUBSYSTEM_COUNT] = {"imu", "gforce_tick", "race_ui",
+                                                              "reaction_ui"};
+  return subsystem < UI_TILE_SUBSYSTEM_COUNT ? kNames[subsystem] : "unknown";
+}
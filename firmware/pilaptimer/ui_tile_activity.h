@@ -0,0 +1,46 @@
+#ifndef UI_TILE_ACTIVITY_H
+#define UI_TILE_ACTIVITY_H
+
+#include <stdint.h>
+
+#include "lv_time_attack_ui.h"
+
+// Per-tile record of which background work ran while each tile was the visible one, and
+// of what each tile costs in LVGL heap. lv_time_attack_ui.cpp reports tile changes,
+// builds and teardowns; the subsystems note each run. A subsystem that shows up under a
+// tile it does not draw on is work the tile lifecycle should have paused.
+
+enum UiTileSubsystem {
+  UI_TILE_SUBSYSTEM_IMU_READ,         // Accelerometer/gyro reads over I2C.
+  UI_TILE_SUBSYSTEM_GFORCE_TICK,      // G-force tile update timer.
+  UI_TILE_SUBSYSTEM_RACE_UPDATE,      // lv_time_attack_ui_update() snapshots.
+  UI_TILE_SUBSYSTEM_REACTION_UPDATE,  // screen_reaction_update() snapshots.
+  UI_TILE_SUBSYSTEM_COUNT
+};
+
+static const uint8_t kUiTileCount = LV_TIME_ATTACK_TILE_UNKNOWN + 1;
+
+struct UiTileActivity {
+  uint32_t shows;       // Times the tile became visible.
+  uint32_t visibleMs;   // LVGL tick time spent visible.
+  uint32_t builds;      // Times the tile's widgets were created.
+  uint32_t teardowns;   // Times they were deleted again.
+  uint32_t buildBytes;  // LVGL heap taken by the last build.
+  uint32_t heapPeak;    // Highest LVGL heap use sampled while the tile was visible.
+  uint32_t runs[UI_TILE_SUBSYSTEM_COUNT];
+};
+
+void ui_tile_activity_set_visible(LvTimeAttackTile tile);
+void ui_tile_activity_note(UiTileSubsystem subsystem);
+void ui_tile_activity_built(LvTimeAttackTile tile, uint32_t heapBytes);
+void ui_tile_activity_torn_down(LvTimeAttackTile tile);
+// LVGL heap in use (total - free); 0 with LV_MEM_CUSTOM.
+uint32_t ui_tile_activity_heap_used();
+// Folds the current heap use into the visible tile's heapPeak.
+void ui_tile_activity_sample_heap();
+// Copies the counters since the last call (visibleMs up to now) and clears them.
+void ui_tile_activity_take(UiTileActivity (&out)[kUiTileCount]);
+const char *ui_tile_activity_tile_name(uint8_t tile);
+const char *ui_tile_activity_subsystem_name(uint8_t subsystem);
+
+#endif